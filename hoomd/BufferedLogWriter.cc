@@ -0,0 +1,260 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file BufferedLogWriter.cc
+    \brief Defines the BufferedLogWriter class
+*/
+
+#include "BufferedLogWriter.h"
+#include "Filesystem.h"
+#include "GSD.h"
+#include "HOOMDVersion.h"
+
+#include <sstream>
+#include <stdexcept>
+
+namespace hoomd
+    {
+/** @param sysdef System definition
+    @param trigger Trigger that selects the timesteps to sample
+    @param filename Name of the GSD file to write
+    @param mode File open mode ("ab", "wb", or "xb")
+    @param buffer_size Number of rows to buffer before writing a block
+*/
+BufferedLogWriter::BufferedLogWriter(std::shared_ptr<SystemDefinition> sysdef,
+                                     std::shared_ptr<Trigger> trigger,
+                                     const std::string& filename,
+                                     const std::string& mode,
+                                     unsigned int buffer_size)
+    : Analyzer(sysdef, trigger), m_filename(filename), m_mode(mode), m_buffer_size(buffer_size)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing BufferedLogWriter: " << filename << std::endl;
+
+    if (m_mode != "ab" && m_mode != "wb" && m_mode != "xb")
+        {
+        throw std::invalid_argument("Invalid GSD file mode: " + m_mode);
+        }
+    if (m_buffer_size == 0)
+        {
+        throw std::domain_error("buffer_size must be positive.");
+        }
+
+    m_active.steps.resize(m_buffer_size);
+    }
+
+BufferedLogWriter::~BufferedLogWriter()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying BufferedLogWriter" << std::endl;
+
+    try
+        {
+        flush();
+        join();
+        }
+    catch (const std::exception& e)
+        {
+        m_exec_conf->msg->error() << "BufferedLogWriter: " << e.what() << std::endl;
+        }
+
+    if (m_is_open)
+        {
+        gsd_close(&m_handle);
+        }
+    }
+
+/** @param name Name of the log chunk (written as log/<name>)
+    @param compute Compute that provides the quantity
+    @param quantity Name of the loggable quantity of \a compute
+
+    Adding a quantity writes the rows buffered so far, so every block has the same columns.
+*/
+void BufferedLogWriter::addQuantity(const std::string& name,
+                                    std::shared_ptr<Compute> compute,
+                                    const std::string& quantity)
+    {
+    LogQuantity log_quantity = compute->getLogQuantity(quantity);
+    if (log_quantity.size == 0)
+        {
+        throw std::invalid_argument("Quantity " + quantity + " of " + name
+                                    + " cannot be logged natively.");
+        }
+
+    // the writer thread reads m_columns
+    flush();
+    join();
+
+    Column column;
+    column.chunk = "log/" + name;
+    column.quantity = log_quantity;
+    m_columns.push_back(column);
+    m_active.values.push_back(std::vector<double>(size_t(m_buffer_size) * log_quantity.size));
+    }
+
+/** @param timestep Current time step of the simulation
+ */
+void BufferedLogWriter::analyze(uint64_t timestep)
+    {
+    Analyzer::analyze(timestep);
+
+    const unsigned int row = m_active.n_rows;
+    m_active.steps[row] = timestep;
+    for (size_t i = 0; i < m_columns.size(); i++)
+        {
+        const unsigned int size = m_columns[i].quantity.size;
+        m_columns[i].quantity.sample(timestep, m_active.values[i].data() + size_t(row) * size);
+        }
+    m_active.n_rows++;
+
+    if (m_active.n_rows == m_buffer_size)
+        {
+        flush();
+        }
+    }
+
+/** Wait for the previous block to finish writing, then hand the active block to the writer
+    thread. Only the root rank writes, other ranks discard their rows.
+*/
+void BufferedLogWriter::flush()
+    {
+    join();
+
+    if (m_active.n_rows == 0)
+        {
+        return;
+        }
+
+    if (!m_exec_conf->isRoot())
+        {
+        m_active.n_rows = 0;
+        return;
+        }
+
+    std::swap(m_active, m_writing);
+
+    // the block that was written last becomes the next active block
+    m_active.n_rows = 0;
+    m_active.steps.resize(m_buffer_size);
+    m_active.values.resize(m_columns.size());
+    for (size_t i = 0; i < m_columns.size(); i++)
+        {
+        m_active.values[i].resize(size_t(m_buffer_size) * m_columns[i].quantity.size);
+        }
+
+    m_thread = std::thread(
+        [this]
+        {
+            try
+                {
+                writeBlock(m_writing);
+                }
+            catch (...)
+                {
+                m_error = std::current_exception();
+                }
+        });
+    }
+
+void BufferedLogWriter::join()
+    {
+    if (m_thread.joinable())
+        {
+        m_thread.join();
+        }
+
+    if (m_error)
+        {
+        std::exception_ptr error = m_error;
+        m_error = nullptr;
+        std::rethrow_exception(error);
+        }
+    }
+
+void BufferedLogWriter::openFile()
+    {
+    int retval;
+    if (m_mode == "wb" || m_mode == "xb" || !filesystem::exists(m_filename))
+        {
+        std::ostringstream o;
+        o << "HOOMD-blue " << HOOMD_VERSION;
+        retval = gsd_create_and_open(&m_handle,
+                                     m_filename.c_str(),
+                                     o.str().c_str(),
+                                     "hoomd",
+                                     gsd_make_version(1, 4),
+                                     GSD_OPEN_APPEND,
+                                     m_mode == "xb");
+        }
+    else
+        {
+        retval = gsd_open(&m_handle, m_filename.c_str(), GSD_OPEN_APPEND);
+        }
+    detail::GSDUtils::checkError(retval, m_filename);
+
+    m_is_open = true;
+    }
+
+/** @param block Rows to write
+
+    Each row is one frame of the GSD file.
+*/
+void BufferedLogWriter::writeBlock(const Block& block)
+    {
+    if (!m_is_open)
+        {
+        openFile();
+        }
+
+    for (unsigned int row = 0; row < block.n_rows; row++)
+        {
+        int retval = gsd_write_chunk(&m_handle,
+                                     "configuration/step",
+                                     GSD_TYPE_UINT64,
+                                     1,
+                                     1,
+                                     0,
+                                     &block.steps[row]);
+        detail::GSDUtils::checkError(retval, m_filename);
+
+        for (size_t i = 0; i < m_columns.size(); i++)
+            {
+            const unsigned int size = m_columns[i].quantity.size;
+            retval = gsd_write_chunk(&m_handle,
+                                     m_columns[i].chunk.c_str(),
+                                     GSD_TYPE_DOUBLE,
+                                     size,
+                                     1,
+                                     0,
+                                     block.values[i].data() + size_t(row) * size);
+            detail::GSDUtils::checkError(retval, m_filename);
+            }
+
+        retval = gsd_end_frame(&m_handle);
+        detail::GSDUtils::checkError(retval, m_filename);
+        }
+
+    int retval = gsd_flush(&m_handle);
+    detail::GSDUtils::checkError(retval, m_filename);
+    }
+
+namespace detail
+    {
+void export_BufferedLogWriter(pybind11::module& m)
+    {
+    pybind11::class_<BufferedLogWriter, Analyzer, std::shared_ptr<BufferedLogWriter>>(
+        m,
+        "BufferedLogWriter")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            std::string,
+                            std::string,
+                            unsigned int>())
+        .def("addQuantity", &BufferedLogWriter::addQuantity)
+        .def("flush", &BufferedLogWriter::flush)
+        .def_property_readonly("filename", &BufferedLogWriter::getFilename)
+        .def_property_readonly("mode", &BufferedLogWriter::getMode)
+        .def_property_readonly("buffer_size", &BufferedLogWriter::getBufferSize);
+    }
+
+    } // end namespace detail
+
+    } // end namespace hoomd
@@ -0,0 +1,147 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file BufferedLogWriter.h
+    \brief Declares the BufferedLogWriter class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#pragma once
+
+#include "Analyzer.h"
+#include "Compute.h"
+
+#include "hoomd/extern/gsd.h"
+
+#include <exception>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+/// Sample logged quantities in C++ and write them to GSD log chunks in blocks
+/** BufferedLogWriter samples quantities that Compute objects provide through
+    Compute::getLogQuantity(). Each call to analyze() appends one row to an in-memory columnar
+    buffer: the timestep and the values of every registered quantity. No Python code executes
+    while sampling and ComputeThermo reduces all of its properties in a single compute() call.
+
+    When the buffer holds buffer_size rows, the writer swaps it with a second buffer and writes
+    the full block on a background thread while the simulation continues to fill the other one.
+    Each row becomes one GSD frame with the chunks configuration/step and log/<name>, so the
+    output is readable with gsd.hoomd.read_log. Errors raised by the background thread are
+    rethrown by the next flush.
+
+    All ranks sample the quantities (sampling may be collective) and the root rank writes the file.
+    The file is not opened until the first block is written.
+*/
+class PYBIND11_EXPORT BufferedLogWriter : public Analyzer
+    {
+    public:
+    /// Construct the writer
+    BufferedLogWriter(std::shared_ptr<SystemDefinition> sysdef,
+                      std::shared_ptr<Trigger> trigger,
+                      const std::string& filename,
+                      const std::string& mode,
+                      unsigned int buffer_size);
+
+    /// Destructor
+    virtual ~BufferedLogWriter();
+
+    /// Register a quantity
+    void addQuantity(const std::string& name,
+                     std::shared_ptr<Compute> compute,
+                     const std::string& quantity);
+
+    /// Sample all quantities
+    virtual void analyze(uint64_t timestep);
+
+    /// Write all buffered rows to the file
+    void flush();
+
+    /// Request the optional quantities that thermodynamic loggables read
+    virtual PDataFlags getRequestedPDataFlags()
+        {
+        PDataFlags flags;
+        flags[pdata_flag::pressure_tensor] = 1;
+        flags[pdata_flag::rotational_kinetic_energy] = 1;
+        flags[pdata_flag::external_field_virial] = 1;
+        return flags;
+        }
+
+    std::string getFilename()
+        {
+        return m_filename;
+        }
+
+    std::string getMode()
+        {
+        return m_mode;
+        }
+
+    unsigned int getBufferSize()
+        {
+        return m_buffer_size;
+        }
+
+    private:
+    /// A registered quantity
+    struct Column
+        {
+        /// Name of the GSD chunk
+        std::string chunk;
+
+        /// Quantity to sample
+        LogQuantity quantity;
+        };
+
+    /// Rows of sampled values stored by column
+    struct Block
+        {
+        /// Timestep of each row
+        std::vector<uint64_t> steps;
+
+        /// Values of each column (size values per row)
+        std::vector<std::vector<double>> values;
+
+        /// Number of rows in the block
+        unsigned int n_rows = 0;
+        };
+
+    /// Open the file (called on the writer thread)
+    void openFile();
+
+    /// Write a block to the file (called on the writer thread)
+    void writeBlock(const Block& block);
+
+    /// Wait for the writer thread and rethrow its error
+    void join();
+
+    std::string m_filename;     //!< Name of the file
+    std::string m_mode;         //!< File open mode
+    unsigned int m_buffer_size; //!< Number of rows per block
+
+    std::vector<Column> m_columns; //!< Registered quantities
+    Block m_active;                //!< Block that analyze() fills
+    Block m_writing;               //!< Block that the writer thread writes
+
+    gsd_handle m_handle;        //!< Handle to the file
+    bool m_is_open = false;     //!< True once the file is open
+    std::thread m_thread;       //!< Writer thread
+    std::exception_ptr m_error; //!< Error raised by the writer thread
+    };
+
+namespace detail
+    {
+/// Export BufferedLogWriter to Python
+void export_BufferedLogWriter(pybind11::module& m);
+
+    } // end namespace detail
+
+    } // end namespace hoomd
@@ -56,11 +56,24 @@ CellList::CellList(std::shared_ptr<SystemDefinition> sysdef)
         m_comm = comm_weak.lock();
         }
 #endif
+
+    // every cell reserves room for the fullest cell, the cell lists hold one entry per particle
+    MemoryRegistry* registry = m_exec_conf->getMemoryRegistry();
+    registry->addObject(this);
+    auto n_entries = [this]() { return size_t(m_pdata->getN() + m_pdata->getNGhosts()); };
+    registry->addArray(this, m_cell_size);
+    registry->addArray(this, m_cell_adj);
+    registry->addArray(this, m_xyzf, n_entries);
+    registry->addArray(this, m_type_body, n_entries);
+    registry->addArray(this, m_orientation, n_entries);
+    registry->addArray(this, m_idx, n_entries);
+    registry->addArray(this, m_conditions);
     }
 
 CellList::~CellList()
     {
     m_exec_conf->msg->notice(5) << "Destroying CellList" << endl;
+    m_exec_conf->getMemoryRegistry()->removeObject(this);
     m_pdata->getParticleSortSignal().disconnect<CellList, &CellList::slotParticlesSorted>(this);
     m_pdata->getBoxChangeSignal().disconnect<CellList, &CellList::slotBoxChanged>(this);
     }
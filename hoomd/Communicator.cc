@@ -1297,9 +1297,42 @@ Communicator::Communicator(std::shared_ptr<SystemDefinition> sysdef,
 
     initializeNeighborArrays();
 
-    /* create a type for pdata_element */
+    m_last_exchange_scheme = m_exec_conf->getMPIConfig()->getExchangeScheme();
+    std::fill(m_graph_index_of_dir, m_graph_index_of_dir + NEIGH_MAX, -1);
+    std::fill(m_ghost_update_reqs, m_ghost_update_reqs + 12, MPI_REQUEST_NULL);
+
+    // the buffers keep their capacity between steps, elements past their size are slack
+    MemoryRegistry* registry = m_exec_conf->getMemoryRegistry();
+    registry->addObject(this);
+    registry->addVector(this, m_pos_copybuf);
+    registry->addVector(this, m_charge_copybuf);
+    registry->addVector(this, m_diameter_copybuf);
+    registry->addVector(this, m_body_copybuf);
+    registry->addVector(this, m_image_copybuf);
+    registry->addVector(this, m_velocity_copybuf);
+    registry->addVector(this, m_orientation_copybuf);
+    registry->addVector(this, m_plan_copybuf);
+    registry->addVector(this, m_tag_copybuf);
+    registry->addVector(this, m_netforce_copybuf);
+    registry->addVector(this, m_nettorque_copybuf);
+    registry->addVector(this, m_netvirial_copybuf);
+    registry->addVector(this, m_netvirial_recvbuf);
+    registry->addVector(this, m_plan);
+    registry->addVector(this, m_plan_reverse);
+    registry->addVector(this, m_tag_reverse);
+    registry->addVector(this, m_netforce_reverse_copybuf);
+    registry->addVector(this, m_netforce_reverse_recvbuf);
+    for (unsigned int dir = 0; dir < 6; dir++)
+        {
+        registry->addVector(this, m_copy_ghosts[dir]);
+        registry->addVector(this, m_copy_ghosts_reverse[dir]);
+        registry->addVector(this, m_plan_reverse_copybuf[dir]);
+        registry->addVector(this, m_forward_ghosts_reverse[dir]);
+        }
+
+    /* create a type for pdata_element (body and group_flags are adjacent) */
     const int nitems = 14;
-    int blocklengths[14] = {4, 4, 3, 1, 1, 3, 1, 4, 4, 3, 1, 4, 4, 6};
+    int blocklengths[14] = {4, 4, 3, 1, 1, 3, 2, 4, 4, 3, 1, 4, 4, 6};
     MPI_Datatype types[14] = {MPI_HOOMD_SCALAR,
                               MPI_HOOMD_SCALAR,
                               MPI_HOOMD_SCALAR,
@@ -1344,6 +1377,7 @@ Communicator::Communicator(std::shared_ptr<SystemDefinition> sysdef,
 Communicator::~Communicator()
     {
     m_exec_conf->msg->notice(5) << "Destroying Communicator" << std::endl;
+    m_exec_conf->getMemoryRegistry()->removeObject(this);
     m_pdata->getParticleSortSignal().disconnect<Communicator, &Communicator::forceMigrate>(this);
     m_pdata->getGhostParticlesRemovedSignal()
         .disconnect<Communicator, &Communicator::slotGhostParticlesRemoved>(this);
@@ -1379,6 +1413,19 @@ Communicator::~Communicator()
         }
 
     MPI_Type_free(&m_mpi_pdata_element);
+
+    freeGhostUpdateRequests();
+    freeGhostWindow();
+    if (m_node_comm != MPI_COMM_NULL)
+        {
+        MPI_Comm_free(&m_node_comm);
+        }
+
+    freeNeighborRequest();
+    if (m_graph_comm != MPI_COMM_NULL)
+        {
+        MPI_Comm_free(&m_graph_comm);
+        }
     }
 
 void Communicator::updateMeshDefinition()
@@ -1509,9 +1556,21 @@ void Communicator::initializeNeighborArrays()
 //! Interface to the communication methods.
 void Communicator::communicate(uint64_t timestep)
     {
+    Profiler* profiler = m_exec_conf->getProfiler();
+    ScopedProfile profile(profiler, *this);
+
     // Guard to prevent recursive triggering of migration
     m_is_communicating = true;
 
+    // migrate all particles with the new scheme when the user changes it
+    const MPIConfiguration::ExchangeScheme scheme
+        = m_exec_conf->getMPIConfig()->getExchangeScheme();
+    if (scheme != m_last_exchange_scheme)
+        {
+        m_last_exchange_scheme = scheme;
+        m_force_migrate = true;
+        }
+
     // update ghost communication flags
     m_flags = CommFlags(0);
     m_requested_flags.emit_accumulate([&](CommFlags f) { m_flags |= f; }, timestep);
@@ -1519,8 +1578,11 @@ void Communicator::communicate(uint64_t timestep)
     if (!m_force_migrate && !m_compute_callbacks.empty() && m_has_ghost_particles)
         {
         // do an obligatory update before determining whether to migrate
-        beginUpdateGhosts(timestep);
-        finishUpdateGhosts(timestep);
+            {
+            ScopedProfile profile_update(profiler, "updateGhosts");
+            beginUpdateGhosts(timestep);
+            finishUpdateGhosts(timestep);
+            }
 
         // call subscribers after ghost update, but before distance check
         m_compute_callbacks.emit(timestep);
@@ -1543,6 +1605,7 @@ void Communicator::communicate(uint64_t timestep)
     // Update ghosts if we are not migrating
     if (!migrate && m_compute_callbacks.empty())
         {
+        ScopedProfile profile_update(profiler, "updateGhosts");
         beginUpdateGhosts(timestep);
 
         finishUpdateGhosts(timestep);
@@ -1554,10 +1617,16 @@ void Communicator::communicate(uint64_t timestep)
         m_force_migrate = false;
 
         // If so, migrate atoms
-        migrateParticles();
+            {
+            ScopedProfile profile_migrate(profiler, "migrateParticles");
+            migrateParticles();
+            }
 
         // Construct ghost send lists, exchange ghost atom data
-        exchangeGhosts();
+            {
+            ScopedProfile profile_exchange(profiler, "exchangeGhosts");
+            exchangeGhosts();
+            }
 
         // update particle data now that ghosts are available
         m_compute_callbacks.emit(timestep);
@@ -1581,6 +1650,19 @@ void Communicator::migrateParticles()
     // remove ghost particles from system
     m_pdata->removeAllGhostParticles();
 
+    if (isBisection())
+        {
+        migrateParticlesBisection();
+        return;
+        }
+
+    // bonded groups follow their particles one direction at a time
+    if (useNeighborCollectives() && !hasBondedGroups())
+        {
+        migrateParticlesNeighbor();
+        return;
+        }
+
     // get box dimensions
     const BoxDim& box = m_pdata->getBox();
 
@@ -1729,6 +1811,996 @@ void Communicator::migrateParticles()
         } // end dir loop
     }
 
+bool Communicator::hasBondedGroups() const
+    {
+    return m_sysdef->getBondData()->getNGlobal() > 0 || m_sysdef->getAngleData()->getNGlobal() > 0
+           || m_sysdef->getDihedralData()->getNGlobal() > 0
+           || m_sysdef->getImproperData()->getNGlobal() > 0
+           || m_sysdef->getConstraintData()->getNGlobal() > 0
+           || m_sysdef->getPairData()->getNGlobal() > 0 || m_meshdef;
+    }
+
+/*! The graph connects each rank to its unique neighbors in both directions, so the send and
+    receive blocks of a neighborhood collective are both ordered like m_unique_neighbors. All ranks
+    must call this method.
+*/
+void Communicator::initializeGraphCommunicator()
+    {
+    if (m_graph_comm != MPI_COMM_NULL)
+        {
+        return;
+        }
+
+        {
+        ArrayHandle<unsigned int> h_unique_neighbors(m_unique_neighbors,
+                                                     access_location::host,
+                                                     access_mode::read);
+        m_graph_neighbors.assign(h_unique_neighbors.data,
+                                 h_unique_neighbors.data + m_n_unique_neigh);
+        }
+
+    MPI_Dist_graph_create_adjacent(m_mpi_comm,
+                                   int(m_graph_neighbors.size()),
+                                   m_graph_neighbors.data(),
+                                   MPI_UNWEIGHTED,
+                                   int(m_graph_neighbors.size()),
+                                   m_graph_neighbors.data(),
+                                   MPI_UNWEIGHTED,
+                                   MPI_INFO_NULL,
+                                   0,
+                                   &m_graph_comm);
+
+    // map every offset (ix, iy, iz) to the index of its rank among the graph neighbors
+    Index3D di = m_decomposition->getDomainIndexer();
+    uint3 mypos = m_decomposition->getGridPos();
+    ArrayHandle<unsigned int> h_cart_ranks(m_decomposition->getCartRanks(),
+                                           access_location::host,
+                                           access_mode::read);
+
+    std::fill(m_graph_index_of_dir, m_graph_index_of_dir + NEIGH_MAX, -1);
+    for (int ix = -1; ix <= 1; ix++)
+        for (int iy = -1; iy <= 1; iy++)
+            for (int iz = -1; iz <= 1; iz++)
+                {
+                if ((!ix && !iy && !iz) || (ix && di.getW() == 1) || (iy && di.getH() == 1)
+                    || (iz && di.getD() == 1))
+                    continue;
+
+                int i = (int(mypos.x) + ix + int(di.getW())) % int(di.getW());
+                int j = (int(mypos.y) + iy + int(di.getH())) % int(di.getH());
+                int k = (int(mypos.z) + iz + int(di.getD())) % int(di.getD());
+                int rank = int(h_cart_ranks.data[di(i, j, k)]);
+
+                unsigned int dir = ((iz + 1) * 3 + (iy + 1)) * 3 + (ix + 1);
+                m_graph_index_of_dir[dir] = int(
+                    std::lower_bound(m_graph_neighbors.begin(), m_graph_neighbors.end(), rank)
+                    - m_graph_neighbors.begin());
+                }
+    }
+
+/*! Particles that left the local domain are sent directly to the edge or corner neighbor that
+    owns them in one MPI_Neighbor_alltoallv round, instead of being forwarded through the face
+    neighbors in three sequential passes.
+*/
+void Communicator::migrateParticlesNeighbor()
+    {
+    initializeGraphCommunicator();
+
+    const BoxDim& box = m_pdata->getBox();
+    Index3D di = m_decomposition->getDomainIndexer();
+
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+        ArrayHandle<unsigned int> h_comm_flag(m_pdata->getCommFlags(),
+                                              access_location::host,
+                                              access_mode::readwrite);
+
+        // flag every particle that left the box with its graph neighbor index + 1
+        for (unsigned int idx = 0; idx < m_pdata->getN(); ++idx)
+            {
+            const Scalar4& postype = h_pos.data[idx];
+            Scalar3 f = box.makeFraction(make_scalar3(postype.x, postype.y, postype.z));
+
+            int ix = di.getW() > 1 ? (f.x >= Scalar(1.0) ? 1 : (f.x < Scalar(0.0) ? -1 : 0)) : 0;
+            int iy = di.getH() > 1 ? (f.y >= Scalar(1.0) ? 1 : (f.y < Scalar(0.0) ? -1 : 0)) : 0;
+            int iz = di.getD() > 1 ? (f.z >= Scalar(1.0) ? 1 : (f.z < Scalar(0.0) ? -1 : 0)) : 0;
+
+            unsigned int flag = 0;
+            if (ix || iy || iz)
+                {
+                unsigned int dir = ((iz + 1) * 3 + (iy + 1)) * 3 + (ix + 1);
+                flag = m_graph_index_of_dir[dir] + 1;
+                }
+            h_comm_flag.data[idx] = flag;
+            }
+        }
+
+    std::vector<unsigned int> comm_flag_out;
+    m_pdata->removeParticles(m_sendbuf, comm_flag_out);
+
+    // sort the outgoing particles by destination
+    const unsigned int n_neigh = (unsigned int)m_graph_neighbors.size();
+    std::vector<int> send_counts(n_neigh, 0), send_displs(n_neigh, 0);
+    std::vector<int> recv_counts(n_neigh, 0), recv_displs(n_neigh, 0);
+    for (unsigned int flag : comm_flag_out)
+        {
+        send_counts[flag - 1]++;
+        }
+    for (unsigned int i = 1; i < n_neigh; ++i)
+        {
+        send_displs[i] = send_displs[i - 1] + send_counts[i - 1];
+        }
+
+    std::vector<detail::pdata_element> sorted_sendbuf(m_sendbuf.size());
+        {
+        std::vector<int> offset(send_displs);
+        for (size_t i = 0; i < m_sendbuf.size(); ++i)
+            {
+            sorted_sendbuf[offset[comm_flag_out[i] - 1]++] = m_sendbuf[i];
+            }
+        }
+
+    MPI_Neighbor_alltoall(send_counts.data(),
+                          1,
+                          MPI_INT,
+                          recv_counts.data(),
+                          1,
+                          MPI_INT,
+                          m_graph_comm);
+
+    unsigned int n_recv_ptls = 0;
+    for (unsigned int i = 0; i < n_neigh; ++i)
+        {
+        recv_displs[i] = n_recv_ptls;
+        n_recv_ptls += recv_counts[i];
+        }
+    m_recvbuf.resize(n_recv_ptls);
+
+    MPI_Neighbor_alltoallv(sorted_sendbuf.data(),
+                           send_counts.data(),
+                           send_displs.data(),
+                           m_mpi_pdata_element,
+                           m_recvbuf.data(),
+                           recv_counts.data(),
+                           recv_displs.data(),
+                           m_mpi_pdata_element,
+                           m_graph_comm);
+
+    // wrap received particles across a global boundary back into global box
+    const BoxDim shifted_box = getShiftedBox();
+    for (auto& p : m_recvbuf)
+        {
+        shifted_box.wrap(p.pos, p.image);
+        }
+
+    m_pdata->addParticles(m_recvbuf);
+    }
+
+/*! The staged ghost exchange builds the ghost layer. Afterwards, every rank derives the neighbors
+    that hold a copy of each of its local particles from the particle's plan and sends them the
+    tags. A receiver maps the tags to its ghost slots. Ghosts received more than once (possible when
+    two faces of the domain border the same rank) are filled by copying.
+
+    The plan is only used when every ghost on every rank is covered. Otherwise, the ghost update
+    uses the staged scheme until the next ghost exchange.
+*/
+void Communicator::buildNeighborGhostPlan()
+    {
+    initializeGraphCommunicator();
+
+    // the registered buffers and request refer to the previous plan
+    freeNeighborRequest();
+
+    const unsigned int n_neigh = (unsigned int)m_graph_neighbors.size();
+    const unsigned int N = m_pdata->getN();
+    const unsigned int n_ghosts = m_pdata->getNGhosts();
+    Index3D di = m_decomposition->getDomainIndexer();
+
+    std::vector<std::vector<unsigned int>> send_tags(n_neigh);
+        {
+        ArrayHandle<unsigned int> h_plan(m_plan, access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_tag(m_pdata->getTags(),
+                                        access_location::host,
+                                        access_mode::read);
+
+        std::vector<int> targets;
+        for (unsigned int idx = 0; idx < N; ++idx)
+            {
+            const unsigned int plan = h_plan.data[idx];
+            if (!plan)
+                continue;
+
+            // the staged exchange forwards a ghost along every combination of its plan's faces
+            int x_offsets[3] = {0, 0, 0}, y_offsets[3] = {0, 0, 0}, z_offsets[3] = {0, 0, 0};
+            unsigned int n_x = 1, n_y = 1, n_z = 1;
+            if (di.getW() > 1)
+                {
+                if (plan & send_east)
+                    x_offsets[n_x++] = 1;
+                if (plan & send_west)
+                    x_offsets[n_x++] = -1;
+                }
+            if (di.getH() > 1)
+                {
+                if (plan & send_north)
+                    y_offsets[n_y++] = 1;
+                if (plan & send_south)
+                    y_offsets[n_y++] = -1;
+                }
+            if (di.getD() > 1)
+                {
+                if (plan & send_up)
+                    z_offsets[n_z++] = 1;
+                if (plan & send_down)
+                    z_offsets[n_z++] = -1;
+                }
+
+            targets.clear();
+            for (unsigned int a = 0; a < n_x; ++a)
+                for (unsigned int b = 0; b < n_y; ++b)
+                    for (unsigned int c = 0; c < n_z; ++c)
+                        {
+                        int ix = x_offsets[a], iy = y_offsets[b], iz = z_offsets[c];
+                        if (!ix && !iy && !iz)
+                            continue;
+
+                        unsigned int dir = ((iz + 1) * 3 + (iy + 1)) * 3 + (ix + 1);
+                        int neigh = m_graph_index_of_dir[dir];
+                        if (std::find(targets.begin(), targets.end(), neigh) == targets.end())
+                            {
+                            targets.push_back(neigh);
+                            send_tags[neigh].push_back(h_tag.data[idx]);
+                            }
+                        }
+            }
+        }
+
+    m_neighbor_send_counts.assign(n_neigh, 0);
+    m_neighbor_send_displs.assign(n_neigh, 0);
+    m_neighbor_recv_counts.assign(n_neigh, 0);
+    m_neighbor_recv_displs.assign(n_neigh, 0);
+    m_neighbor_send_tags.clear();
+    for (unsigned int i = 0; i < n_neigh; ++i)
+        {
+        m_neighbor_send_displs[i] = (int)m_neighbor_send_tags.size();
+        m_neighbor_send_counts[i] = (int)send_tags[i].size();
+        m_neighbor_send_tags.insert(m_neighbor_send_tags.end(),
+                                    send_tags[i].begin(),
+                                    send_tags[i].end());
+        }
+
+    MPI_Neighbor_alltoall(m_neighbor_send_counts.data(),
+                          1,
+                          MPI_INT,
+                          m_neighbor_recv_counts.data(),
+                          1,
+                          MPI_INT,
+                          m_graph_comm);
+
+    unsigned int n_recv = 0;
+    for (unsigned int i = 0; i < n_neigh; ++i)
+        {
+        m_neighbor_recv_displs[i] = n_recv;
+        n_recv += m_neighbor_recv_counts[i];
+        }
+
+    std::vector<unsigned int> recv_tags(n_recv);
+    MPI_Neighbor_alltoallv(m_neighbor_send_tags.data(),
+                           m_neighbor_send_counts.data(),
+                           m_neighbor_send_displs.data(),
+                           MPI_UNSIGNED,
+                           recv_tags.data(),
+                           m_neighbor_recv_counts.data(),
+                           m_neighbor_recv_displs.data(),
+                           MPI_UNSIGNED,
+                           m_graph_comm);
+
+    // map the received tags to ghost slots and check that every ghost is covered
+    bool valid = true;
+    m_neighbor_recv_ghost.resize(n_recv);
+    m_neighbor_ghost_copies.clear();
+        {
+        ArrayHandle<unsigned int> h_tag(m_pdata->getTags(),
+                                        access_location::host,
+                                        access_mode::read);
+        ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(),
+                                         access_location::host,
+                                         access_mode::read);
+
+        std::vector<char> covered(n_ghosts, 0);
+        for (unsigned int i = 0; i < n_recv; ++i)
+            {
+            unsigned int idx = h_rtag.data[recv_tags[i]];
+            if (idx == NOT_LOCAL || idx < N || idx >= N + n_ghosts)
+                {
+                valid = false;
+                break;
+                }
+            m_neighbor_recv_ghost[i] = idx - N;
+            covered[idx - N] = 1;
+            }
+
+        for (unsigned int g = 0; valid && g < n_ghosts; ++g)
+            {
+            unsigned int idx = h_rtag.data[h_tag.data[N + g]];
+            if (idx == N + g)
+                {
+                valid = covered[g];
+                }
+            else if (idx >= N && idx < N + n_ghosts)
+                {
+                m_neighbor_ghost_copies.push_back(std::make_pair(g, idx - N));
+                }
+            else
+                {
+                valid = false;
+                }
+            }
+        }
+
+    int all_valid = valid;
+    MPI_Allreduce(MPI_IN_PLACE, &all_valid, 1, MPI_INT, MPI_LAND, m_mpi_comm);
+    m_neighbor_plan_valid = all_valid;
+
+    if (!m_neighbor_plan_valid)
+        {
+        m_exec_conf->msg->notice(6)
+            << "Communicator: ghost layer not covered by direct routes, using staged updates"
+            << std::endl;
+        }
+    }
+
+void Communicator::freeNeighborRequest()
+    {
+    if (m_neighbor_request_persistent && m_neighbor_request != MPI_REQUEST_NULL)
+        {
+        MPI_Request_free(&m_neighbor_request);
+        }
+    m_neighbor_request = MPI_REQUEST_NULL;
+    m_neighbor_request_persistent = false;
+
+    if (m_neighbor_record != MPI_DATATYPE_NULL)
+        {
+        MPI_Type_free(&m_neighbor_record);
+        }
+    m_neighbor_fields = 0;
+    }
+
+/*! \param flags Ghost communication flags
+
+    Each record holds the position, velocity and orientation of one ghost, as requested by the
+    flags. The send and receive buffers are sized once per ghost exchange and registered with a
+    persistent MPI_Neighbor_alltoallv_init request when the MPI library supports MPI 4.0. The
+    request is restarted in every update until the plan or the requested fields change.
+*/
+void Communicator::beginNeighborUpdateGhosts(const CommFlags& flags)
+    {
+    const unsigned int fields = getGhostUpdateFields(flags);
+    if (!fields)
+        {
+        return;
+        }
+
+    const unsigned int n_fields = ((fields & ghost_update_position) ? 1 : 0)
+                                  + ((fields & ghost_update_velocity) ? 1 : 0)
+                                  + ((fields & ghost_update_orientation) ? 1 : 0);
+    const unsigned int n_send = (unsigned int)m_neighbor_send_tags.size();
+    const unsigned int n_recv = (unsigned int)m_neighbor_recv_ghost.size();
+
+    if (fields != m_neighbor_fields)
+        {
+        freeNeighborRequest();
+
+        m_neighbor_sendbuf.resize(size_t(n_send) * n_fields);
+        m_neighbor_recvbuf.resize(size_t(n_recv) * n_fields);
+
+        MPI_Type_contiguous(4 * n_fields, MPI_HOOMD_SCALAR, &m_neighbor_record);
+        MPI_Type_commit(&m_neighbor_record);
+
+#if MPI_VERSION >= 4
+        MPI_Neighbor_alltoallv_init(m_neighbor_sendbuf.data(),
+                                    m_neighbor_send_counts.data(),
+                                    m_neighbor_send_displs.data(),
+                                    m_neighbor_record,
+                                    m_neighbor_recvbuf.data(),
+                                    m_neighbor_recv_counts.data(),
+                                    m_neighbor_recv_displs.data(),
+                                    m_neighbor_record,
+                                    m_graph_comm,
+                                    MPI_INFO_NULL,
+                                    &m_neighbor_request);
+        m_neighbor_request_persistent = true;
+#endif
+        m_neighbor_fields = fields;
+        }
+
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+        ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
+                                   access_location::host,
+                                   access_mode::read);
+        ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                           access_location::host,
+                                           access_mode::read);
+        ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(),
+                                         access_location::host,
+                                         access_mode::read);
+
+        Scalar4* out = m_neighbor_sendbuf.data();
+        for (unsigned int i = 0; i < n_send; ++i)
+            {
+            unsigned int idx = h_rtag.data[m_neighbor_send_tags[i]];
+            assert(idx < m_pdata->getN());
+
+            if (fields & ghost_update_position)
+                *out++ = h_pos.data[idx];
+            if (fields & ghost_update_velocity)
+                *out++ = h_vel.data[idx];
+            if (fields & ghost_update_orientation)
+                *out++ = h_orientation.data[idx];
+            }
+        }
+
+    if (m_neighbor_request_persistent)
+        {
+        MPI_Start(&m_neighbor_request);
+        }
+    else
+        {
+        MPI_Ineighbor_alltoallv(m_neighbor_sendbuf.data(),
+                                m_neighbor_send_counts.data(),
+                                m_neighbor_send_displs.data(),
+                                m_neighbor_record,
+                                m_neighbor_recvbuf.data(),
+                                m_neighbor_recv_counts.data(),
+                                m_neighbor_recv_displs.data(),
+                                m_neighbor_record,
+                                m_graph_comm,
+                                &m_neighbor_request);
+        }
+
+    m_neighbor_update_pending = true;
+    }
+
+void Communicator::finishNeighborUpdateGhosts()
+    {
+    MPI_Wait(&m_neighbor_request, MPI_STATUS_IGNORE);
+    m_neighbor_update_pending = false;
+
+    const unsigned int fields = m_neighbor_fields;
+    const unsigned int N = m_pdata->getN();
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                               access_location::host,
+                               access_mode::readwrite);
+    ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
+                               access_location::host,
+                               access_mode::readwrite);
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                       access_location::host,
+                                       access_mode::readwrite);
+
+    // wrap particles received across a global boundary
+    const BoxDim shifted_box = getShiftedBox();
+    const Scalar4* in = m_neighbor_recvbuf.data();
+    for (unsigned int ghost : m_neighbor_recv_ghost)
+        {
+        unsigned int idx = N + ghost;
+        if (fields & ghost_update_position)
+            {
+            h_pos.data[idx] = *in++;
+            int3 img = make_int3(0, 0, 0);
+            shifted_box.wrap(h_pos.data[idx], img);
+            }
+        if (fields & ghost_update_velocity)
+            h_vel.data[idx] = *in++;
+        if (fields & ghost_update_orientation)
+            h_orientation.data[idx] = *in++;
+        }
+
+    for (const auto& copy : m_neighbor_ghost_copies)
+        {
+        unsigned int dst = N + copy.first, src = N + copy.second;
+        if (fields & ghost_update_position)
+            h_pos.data[dst] = h_pos.data[src];
+        if (fields & ghost_update_velocity)
+            h_vel.data[dst] = h_vel.data[src];
+        if (fields & ghost_update_orientation)
+            h_orientation.data[dst] = h_orientation.data[src];
+        }
+    }
+
+namespace
+    {
+/// Distance between a fractional coordinate and an interval on a periodic axis
+Scalar periodicGap(Scalar f, Scalar lo, Scalar hi)
+    {
+    Scalar gap = Scalar(1.0);
+    for (int shift = -1; shift <= 1; shift++)
+        {
+        Scalar d = std::max(lo + Scalar(shift) - f, f - (hi + Scalar(shift)));
+        gap = std::min(gap, std::max(d, Scalar(0.0)));
+        }
+    return gap;
+    }
+
+/// Check whether a fractional coordinate is within a distance of a domain along every axis
+bool isNearDomain(const Scalar3& f, const Scalar3& lo, const Scalar3& hi, const Scalar3& distance)
+    {
+    // a domain that spans an axis is near every particle along that axis
+    return (hi.x - lo.x >= Scalar(1.0) || periodicGap(f.x, lo.x, hi.x) <= distance.x)
+           && (hi.y - lo.y >= Scalar(1.0) || periodicGap(f.y, lo.y, hi.y) <= distance.y)
+           && (hi.z - lo.z >= Scalar(1.0) || periodicGap(f.z, lo.z, hi.z) <= distance.z);
+    }
+    } // end anonymous namespace
+
+/*! \param data Per-particle array that holds the local particles followed by the ghosts
+
+    The values of the particles listed in m_neighbor_send_tags are sent to the bisection neighbors
+    and the received values are written to the ghost slots in the order of the last ghost exchange.
+*/
+template<class T> void Communicator::exchangeGhostFieldBisection(T* data)
+    {
+    std::vector<T> sendbuf(m_neighbor_send_tags.size());
+        {
+        ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(),
+                                         access_location::host,
+                                         access_mode::read);
+        for (size_t i = 0; i < m_neighbor_send_tags.size(); ++i)
+            {
+            sendbuf[i] = data[h_rtag.data[m_neighbor_send_tags[i]]];
+            }
+        }
+
+    MPI_Datatype element;
+    MPI_Type_contiguous(int(sizeof(T)), MPI_BYTE, &element);
+    MPI_Type_commit(&element);
+    MPI_Neighbor_alltoallv(sendbuf.data(),
+                           m_neighbor_send_counts.data(),
+                           m_neighbor_send_displs.data(),
+                           element,
+                           data + m_pdata->getN(),
+                           m_neighbor_recv_counts.data(),
+                           m_neighbor_recv_displs.data(),
+                           element,
+                           m_graph_comm);
+    MPI_Type_free(&element);
+    }
+
+/*! The graph connects every pair of bisection domains that are closer than the largest ghost layer
+    width in fractions of the global box. It is rebuilt only when the domains or the ghost width
+    change the neighbors of any rank. All ranks must call this method.
+*/
+void Communicator::updateBisectionNeighbors()
+    {
+    Scalar3 ghost_fraction
+        = getGhostLayerMaxWidth() / m_pdata->getGlobalBox().getNearestPlaneDistance();
+    MPI_Allreduce(MPI_IN_PLACE, &ghost_fraction.x, 3, MPI_HOOMD_SCALAR, MPI_MAX, m_mpi_comm);
+    m_bisection_ghost_fraction = ghost_fraction;
+
+    std::vector<unsigned int> nearby = m_decomposition->findNearbyDomains(ghost_fraction);
+    std::vector<int> neighbors(nearby.begin(), nearby.end());
+
+    int changed = m_graph_comm == MPI_COMM_NULL || neighbors != m_graph_neighbors;
+    MPI_Allreduce(MPI_IN_PLACE, &changed, 1, MPI_INT, MPI_LOR, m_mpi_comm);
+    if (!changed)
+        {
+        return;
+        }
+
+    // the registered request of the ghost update refers to the old graph
+    freeNeighborRequest();
+    m_neighbor_plan_valid = false;
+    if (m_graph_comm != MPI_COMM_NULL)
+        {
+        MPI_Comm_free(&m_graph_comm);
+        }
+
+    m_graph_neighbors = neighbors;
+    MPI_Dist_graph_create_adjacent(m_mpi_comm,
+                                   int(m_graph_neighbors.size()),
+                                   m_graph_neighbors.data(),
+                                   MPI_UNWEIGHTED,
+                                   int(m_graph_neighbors.size()),
+                                   m_graph_neighbors.data(),
+                                   MPI_UNWEIGHTED,
+                                   MPI_INFO_NULL,
+                                   0,
+                                   &m_graph_comm);
+
+    m_exec_conf->msg->notice(6) << "Communicator: " << m_graph_neighbors.size()
+                                << " bisection neighbors" << std::endl;
+    }
+
+/*! Every particle that left the local domain is sent to the domain that owns its position wrapped
+    into the global box. Particles normally move to a graph neighbor in one MPI_Neighbor_alltoallv
+    round. After the load balancer moves the domains, particles may belong to any rank and all ranks
+    migrate with a single MPI_Alltoallv instead.
+*/
+void Communicator::migrateParticlesBisection()
+    {
+    if (hasBondedGroups())
+        {
+        throw std::runtime_error(
+            "Bonded groups are not supported with recursive bisection domains.");
+        }
+
+    updateBisectionNeighbors();
+
+    const BoxDim& global_box = m_pdata->getGlobalBox();
+    const unsigned int my_rank = m_exec_conf->getRank();
+    const unsigned int n_ranks = m_exec_conf->getNRanks();
+
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+        ArrayHandle<unsigned int> h_comm_flag(m_pdata->getCommFlags(),
+                                              access_location::host,
+                                              access_mode::readwrite);
+        ArrayHandle<unsigned int> h_cart_ranks(m_decomposition->getCartRanks(),
+                                               access_location::host,
+                                               access_mode::read);
+
+        // flag every particle that left the domain with its destination rank + 1
+        for (unsigned int idx = 0; idx < m_pdata->getN(); ++idx)
+            {
+            const Scalar4& postype = h_pos.data[idx];
+            Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
+            int3 img = make_int3(0, 0, 0);
+            global_box.wrap(pos, img);
+
+            unsigned int rank = m_decomposition->placeParticle(global_box, pos, h_cart_ranks.data);
+            h_comm_flag.data[idx] = rank == my_rank ? 0 : rank + 1;
+            }
+        }
+
+    std::vector<unsigned int> comm_flag_out;
+    m_pdata->removeParticles(m_sendbuf, comm_flag_out);
+
+    // send to graph neighbors when every rank can
+    std::vector<unsigned int> target(comm_flag_out.size());
+    int global = 0;
+    for (size_t i = 0; i < comm_flag_out.size(); ++i)
+        {
+        int rank = int(comm_flag_out[i] - 1);
+        auto it = std::lower_bound(m_graph_neighbors.begin(), m_graph_neighbors.end(), rank);
+        if (it == m_graph_neighbors.end() || *it != rank)
+            {
+            global = 1;
+            break;
+            }
+        target[i] = (unsigned int)(it - m_graph_neighbors.begin());
+        }
+    MPI_Allreduce(MPI_IN_PLACE, &global, 1, MPI_INT, MPI_LOR, m_mpi_comm);
+
+    if (global)
+        {
+        m_exec_conf->msg->notice(6) << "Communicator: migrating particles between all ranks"
+                                    << std::endl;
+        for (size_t i = 0; i < comm_flag_out.size(); ++i)
+            {
+            target[i] = comm_flag_out[i] - 1;
+            }
+        }
+
+    // sort the outgoing particles by destination
+    const unsigned int n_targets = global ? n_ranks : (unsigned int)m_graph_neighbors.size();
+    std::vector<int> send_counts(n_targets, 0), send_displs(n_targets, 0);
+    std::vector<int> recv_counts(n_targets, 0), recv_displs(n_targets, 0);
+    for (unsigned int t : target)
+        {
+        send_counts[t]++;
+        }
+    for (unsigned int i = 1; i < n_targets; ++i)
+        {
+        send_displs[i] = send_displs[i - 1] + send_counts[i - 1];
+        }
+
+    std::vector<detail::pdata_element> sorted_sendbuf(m_sendbuf.size());
+        {
+        std::vector<int> offset(send_displs);
+        for (size_t i = 0; i < m_sendbuf.size(); ++i)
+            {
+            sorted_sendbuf[offset[target[i]]++] = m_sendbuf[i];
+            }
+        }
+
+    if (global)
+        {
+        MPI_Alltoall(send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT, m_mpi_comm);
+        }
+    else
+        {
+        MPI_Neighbor_alltoall(send_counts.data(),
+                              1,
+                              MPI_INT,
+                              recv_counts.data(),
+                              1,
+                              MPI_INT,
+                              m_graph_comm);
+        }
+
+    unsigned int n_recv_ptls = 0;
+    for (unsigned int i = 0; i < n_targets; ++i)
+        {
+        recv_displs[i] = n_recv_ptls;
+        n_recv_ptls += recv_counts[i];
+        }
+    m_recvbuf.resize(n_recv_ptls);
+
+    if (global)
+        {
+        MPI_Alltoallv(sorted_sendbuf.data(),
+                      send_counts.data(),
+                      send_displs.data(),
+                      m_mpi_pdata_element,
+                      m_recvbuf.data(),
+                      recv_counts.data(),
+                      recv_displs.data(),
+                      m_mpi_pdata_element,
+                      m_mpi_comm);
+        }
+    else
+        {
+        MPI_Neighbor_alltoallv(sorted_sendbuf.data(),
+                               send_counts.data(),
+                               send_displs.data(),
+                               m_mpi_pdata_element,
+                               m_recvbuf.data(),
+                               recv_counts.data(),
+                               recv_displs.data(),
+                               m_mpi_pdata_element,
+                               m_graph_comm);
+        }
+
+    // wrap received particles across a global boundary back into global box
+    const BoxDim shifted_box = getShiftedBox();
+    for (auto& p : m_recvbuf)
+        {
+        shifted_box.wrap(p.pos, p.image);
+        }
+
+    m_pdata->addParticles(m_recvbuf);
+    }
+
+/*! Every local particle is sent once to each bisection neighbor whose domain is within the
+    particle's ghost width, measured along every axis in fractions of the global box. The send lists
+    double as the plan of the neighbor ghost update, which needs no further agreement between the
+    ranks because every ghost is received exactly once.
+*/
+void Communicator::exchangeGhostsBisection()
+    {
+    CommFlags flags = getFlags();
+    if (flags[comm_flag::reverse_net_force])
+        {
+        throw std::runtime_error(
+            "Reverse force communication is not supported with recursive bisection domains.");
+        }
+
+    updateGhostWidth();
+
+    const BoxDim& global_box = m_pdata->getGlobalBox();
+    const Scalar3 global_dist = global_box.getNearestPlaneDistance();
+    const unsigned int my_rank = m_exec_conf->getRank();
+    const Scalar3 my_lo = m_decomposition->getDomainLo(my_rank);
+    const Scalar3 my_hi = m_decomposition->getDomainHi(my_rank);
+    const unsigned int n_neigh = (unsigned int)m_graph_neighbors.size();
+    const unsigned int N = m_pdata->getN();
+
+    std::vector<std::vector<unsigned int>> send_tags(n_neigh);
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+        ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
+                                         access_location::host,
+                                         access_mode::read);
+        ArrayHandle<unsigned int> h_tag(m_pdata->getTags(),
+                                        access_location::host,
+                                        access_mode::read);
+        ArrayHandle<Scalar> h_r_ghost(m_r_ghost, access_location::host, access_mode::read);
+        ArrayHandle<Scalar> h_r_ghost_body(m_r_ghost_body,
+                                           access_location::host,
+                                           access_mode::read);
+
+        for (unsigned int idx = 0; idx < N; ++idx)
+            {
+            const Scalar4& postype = h_pos.data[idx];
+            const unsigned int type = __scalar_as_int(postype.w);
+            Scalar ghost_width = h_r_ghost.data[type];
+            if (h_body.data[idx] < MIN_FLOPPY)
+                {
+                ghost_width = std::max(ghost_width, h_r_ghost_body.data[type]);
+                }
+            const Scalar3 ghost_fraction = ghost_width / global_dist;
+
+            Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
+            int3 img = make_int3(0, 0, 0);
+            global_box.wrap(pos, img);
+            const Scalar3 f = global_box.makeFraction(pos);
+
+            // particles farther than the ghost width from every cut face stay local
+            const bool interior
+                = (my_hi.x - my_lo.x >= Scalar(1.0)
+                   || (f.x - my_lo.x > ghost_fraction.x && my_hi.x - f.x > ghost_fraction.x))
+                  && (my_hi.y - my_lo.y >= Scalar(1.0)
+                      || (f.y - my_lo.y > ghost_fraction.y && my_hi.y - f.y > ghost_fraction.y))
+                  && (my_hi.z - my_lo.z >= Scalar(1.0)
+                      || (f.z - my_lo.z > ghost_fraction.z && my_hi.z - f.z > ghost_fraction.z));
+            if (interior)
+                continue;
+
+            for (unsigned int i = 0; i < n_neigh; ++i)
+                {
+                const unsigned int rank = m_graph_neighbors[i];
+                if (isNearDomain(f,
+                                 m_decomposition->getDomainLo(rank),
+                                 m_decomposition->getDomainHi(rank),
+                                 ghost_fraction))
+                    {
+                    send_tags[i].push_back(h_tag.data[idx]);
+                    }
+                }
+            }
+        }
+
+    // the registered buffers and request refer to the previous ghost layer
+    freeNeighborRequest();
+
+    m_neighbor_send_counts.assign(n_neigh, 0);
+    m_neighbor_send_displs.assign(n_neigh, 0);
+    m_neighbor_recv_counts.assign(n_neigh, 0);
+    m_neighbor_recv_displs.assign(n_neigh, 0);
+    m_neighbor_send_tags.clear();
+    for (unsigned int i = 0; i < n_neigh; ++i)
+        {
+        m_neighbor_send_displs[i] = (int)m_neighbor_send_tags.size();
+        m_neighbor_send_counts[i] = (int)send_tags[i].size();
+        m_neighbor_send_tags.insert(m_neighbor_send_tags.end(),
+                                    send_tags[i].begin(),
+                                    send_tags[i].end());
+        }
+
+    MPI_Neighbor_alltoall(m_neighbor_send_counts.data(),
+                          1,
+                          MPI_INT,
+                          m_neighbor_recv_counts.data(),
+                          1,
+                          MPI_INT,
+                          m_graph_comm);
+
+    unsigned int n_recv = 0;
+    for (unsigned int i = 0; i < n_neigh; ++i)
+        {
+        m_neighbor_recv_displs[i] = n_recv;
+        n_recv += m_neighbor_recv_counts[i];
+        }
+
+    // accommodate new ghost particles
+    m_pdata->addGhostParticles(n_recv);
+    m_plan.resize(N + n_recv);
+        {
+        ArrayHandle<unsigned int> h_plan(m_plan, access_location::host, access_mode::overwrite);
+        std::fill(h_plan.data, h_plan.data + N + n_recv, 0);
+        }
+
+        {
+        ArrayHandle<unsigned int> h_tag(m_pdata->getTags(),
+                                        access_location::host,
+                                        access_mode::readwrite);
+        MPI_Neighbor_alltoallv(m_neighbor_send_tags.data(),
+                               m_neighbor_send_counts.data(),
+                               m_neighbor_send_displs.data(),
+                               MPI_UNSIGNED,
+                               h_tag.data + N,
+                               m_neighbor_recv_counts.data(),
+                               m_neighbor_recv_displs.data(),
+                               MPI_UNSIGNED,
+                               m_graph_comm);
+        }
+
+    if (flags[comm_flag::position])
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::readwrite);
+        exchangeGhostFieldBisection(h_pos.data);
+        }
+    if (flags[comm_flag::charge])
+        {
+        ArrayHandle<Scalar> h_charge(m_pdata->getCharges(),
+                                     access_location::host,
+                                     access_mode::readwrite);
+        exchangeGhostFieldBisection(h_charge.data);
+        }
+    if (flags[comm_flag::diameter])
+        {
+        ArrayHandle<Scalar> h_diameter(m_pdata->getDiameters(),
+                                       access_location::host,
+                                       access_mode::readwrite);
+        exchangeGhostFieldBisection(h_diameter.data);
+        }
+    if (flags[comm_flag::body])
+        {
+        ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
+                                         access_location::host,
+                                         access_mode::readwrite);
+        exchangeGhostFieldBisection(h_body.data);
+        }
+    if (flags[comm_flag::image])
+        {
+        ArrayHandle<int3> h_image(m_pdata->getImages(),
+                                  access_location::host,
+                                  access_mode::readwrite);
+        exchangeGhostFieldBisection(h_image.data);
+        }
+    if (flags[comm_flag::velocity])
+        {
+        ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
+                                   access_location::host,
+                                   access_mode::readwrite);
+        exchangeGhostFieldBisection(h_vel.data);
+        }
+    if (flags[comm_flag::orientation])
+        {
+        ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                           access_location::host,
+                                           access_mode::readwrite);
+        exchangeGhostFieldBisection(h_orientation.data);
+        }
+
+    // wrap particles received across a global boundary
+    if (flags[comm_flag::position])
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::readwrite);
+        ArrayHandle<int3> h_image(m_pdata->getImages(),
+                                  access_location::host,
+                                  access_mode::readwrite);
+
+        const BoxDim shifted_box = getShiftedBox();
+        for (unsigned int idx = N; idx < N + n_recv; idx++)
+            {
+            shifted_box.wrap(h_pos.data[idx], h_image.data[idx]);
+            }
+        }
+
+        {
+        // set reverse-lookup tag -> idx
+        ArrayHandle<unsigned int> h_tag(m_pdata->getTags(),
+                                        access_location::host,
+                                        access_mode::read);
+        ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(),
+                                         access_location::host,
+                                         access_mode::readwrite);
+
+        for (unsigned int idx = N; idx < N + n_recv; idx++)
+            {
+            assert(h_rtag.data[h_tag.data[idx]] == NOT_LOCAL);
+            h_rtag.data[h_tag.data[idx]] = idx;
+            }
+        }
+
+    // every ghost is received exactly once, in the order of the send lists
+    m_neighbor_recv_ghost.resize(n_recv);
+    for (unsigned int i = 0; i < n_recv; ++i)
+        {
+        m_neighbor_recv_ghost[i] = i;
+        }
+    m_neighbor_ghost_copies.clear();
+    m_neighbor_plan_valid = true;
+
+    m_ghosts_added = m_pdata->getNGhosts();
+    m_last_flags = flags;
+    m_ghost_update_requests_valid = false;
+    }
+
 void Communicator::updateGhostWidth()
     {
         {
@@ -1799,6 +2871,12 @@ void Communicator::exchangeGhosts()
 
     m_exec_conf->msg->notice(7) << "Communicator: exchange ghosts" << std::endl;
 
+    if (isBisection())
+        {
+        exchangeGhostsBisection();
+        return;
+        }
+
     const BoxDim& box = m_pdata->getBox();
 
     // Sending ghosts proceeds in two stages:
@@ -2363,6 +3441,16 @@ void Communicator::exchangeGhosts()
 
     m_last_flags = flags;
 
+    // the ghost lists changed, resize the buffers of the ghost update on first use
+    m_ghost_update_requests_valid = false;
+
+    // agree on the direct routes used by the neighbor ghost update
+    m_neighbor_plan_valid = false;
+    if (useNeighborCollectives())
+        {
+        buildNeighborGhostPlan();
+        }
+
     /***********************************************************************************************************************************************************
      * For multi-body force fields we must allow particles to send information back through their
      *ghosts. For this purpose, we implement a system for ghosts to be sent back to their original
@@ -2633,97 +3721,150 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
     // to send to neighboring processors
     m_exec_conf->msg->notice(7) << "Communicator: update ghosts" << std::endl;
 
-    // update data in these arrays
+    if (m_neighbor_plan_valid && useNeighborCollectives())
+        {
+        beginNeighborUpdateGhosts(getFlags());
+        return;
+        }
+
+    // ghost communication flags
+    const unsigned int fields = getGhostUpdateFields(getFlags());
+    if (!fields)
+        {
+        return;
+        }
+
+    if (!m_ghost_update_requests_valid || fields != m_ghost_update_fields)
+        {
+        initializeGhostUpdateRequests(fields);
+        }
+
+    unsigned int num_tot_recv_ghosts = 0; // total number of ghosts received
+
+    for (unsigned int dir = 0; dir < 6; dir++)
+        {
+        if (!isCommunicating(dir))
+            continue;
+
+        // only non-permanent fields (position, velocity, orientation) need to be considered here
+        // charge, body, image and diameter are not updated between neighbor list builds
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::readwrite);
+        ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
+                                   access_location::host,
+                                   access_mode::readwrite);
+        ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                           access_location::host,
+                                           access_mode::readwrite);
+        ArrayHandle<unsigned int> h_copy_ghosts(m_copy_ghosts[dir],
+                                                access_location::host,
+                                                access_mode::read);
+        ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(),
+                                         access_location::host,
+                                         access_mode::read);
 
-    unsigned int num_tot_recv_ghosts = 0; // total number of ghosts received
+        // pack all requested fields of a ghost into one record, on-node neighbors read the
+        // records directly from the shared window
+        Scalar4* out = m_ghost_send_shared[dir]
+                           ? m_ghost_window_base + dir * m_ghost_window_capacity
+                           : m_ghost_update_sendbuf[dir].data();
+        for (unsigned int ghost_idx = 0; ghost_idx < m_num_copy_ghosts[dir]; ghost_idx++)
+            {
+            unsigned int idx = h_rtag.data[h_copy_ghosts.data[ghost_idx]];
 
-    for (unsigned int dir = 0; dir < 6; dir++)
-        {
-        if (!isCommunicating(dir))
-            continue;
+            assert(idx < m_pdata->getN() + m_pdata->getNGhosts());
 
-        CommFlags flags = getFlags();
+            if (fields & ghost_update_position)
+                *out++ = h_pos.data[idx];
+            if (fields & ghost_update_velocity)
+                *out++ = h_vel.data[idx];
+            if (fields & ghost_update_orientation)
+                *out++ = h_orientation.data[idx];
+            }
 
-        if (flags[comm_flag::position])
+        // exchange one message per direction using the persistent requests
+        for (unsigned int i = 2 * dir; i < 2 * dir + 2; i++)
             {
-            ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
-                                       access_location::host,
-                                       access_mode::read);
-            ArrayHandle<Scalar4> h_pos_copybuf(m_pos_copybuf,
-                                               access_location::host,
-                                               access_mode::overwrite);
-            ArrayHandle<unsigned int> h_copy_ghosts(m_copy_ghosts[dir],
-                                                    access_location::host,
-                                                    access_mode::read);
-            ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(),
-                                             access_location::host,
-                                             access_mode::read);
-
-            // copy positions of ghost particles
-            for (unsigned int ghost_idx = 0; ghost_idx < m_num_copy_ghosts[dir]; ghost_idx++)
+            if (m_ghost_update_reqs[i] != MPI_REQUEST_NULL)
                 {
-                unsigned int idx = h_rtag.data[h_copy_ghosts.data[ghost_idx]];
-
-                assert(idx < m_pdata->getN() + m_pdata->getNGhosts());
-
-                // copy position into send buffer
-                h_pos_copybuf.data[ghost_idx] = h_pos.data[idx];
+                MPI_Start(&m_ghost_update_reqs[i]);
                 }
             }
 
-        if (flags[comm_flag::velocity])
+        if (m_ghost_window != MPI_WIN_NULL)
             {
-            ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
-                                       access_location::host,
-                                       access_mode::read);
-            ArrayHandle<Scalar4> h_velocity_copybuf(m_velocity_copybuf,
-                                                    access_location::host,
-                                                    access_mode::overwrite);
-            ArrayHandle<unsigned int> h_copy_ghosts(m_copy_ghosts[dir],
-                                                    access_location::host,
-                                                    access_mode::read);
-            ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(),
-                                             access_location::host,
-                                             access_mode::read);
+            // publish the records written to the window and wait for the other ranks on the node
+            MPI_Win_sync(m_ghost_window);
+            MPI_Barrier(m_node_comm);
+            MPI_Win_sync(m_ghost_window);
+            }
 
-            // copy velocity of ghost particles
-            for (unsigned int ghost_idx = 0; ghost_idx < m_num_copy_ghosts[dir]; ghost_idx++)
-                {
-                unsigned int idx = h_rtag.data[h_copy_ghosts.data[ghost_idx]];
+        MPI_Waitall(2, &m_ghost_update_reqs[2 * dir], MPI_STATUSES_IGNORE);
 
-                assert(idx < m_pdata->getN() + m_pdata->getNGhosts());
+        unsigned int start_idx = m_pdata->getN() + num_tot_recv_ghosts;
+        num_tot_recv_ghosts += m_num_recv_ghosts[dir];
 
-                // copy velocity into send buffer
-                h_velocity_copybuf.data[ghost_idx] = h_vel.data[idx];
+        // wrap particles received across a global boundary
+        const BoxDim shifted_box = getShiftedBox();
+        const Scalar4* in = m_ghost_recv_shared[dir] ? m_ghost_window_peer[dir]
+                                                     : m_ghost_update_recvbuf[dir].data();
+        for (unsigned int idx = start_idx; idx < start_idx + m_num_recv_ghosts[dir]; idx++)
+            {
+            if (fields & ghost_update_position)
+                {
+                h_pos.data[idx] = *in++;
+                int3 img = make_int3(0, 0, 0);
+                shifted_box.wrap(h_pos.data[idx], img);
                 }
+            if (fields & ghost_update_velocity)
+                h_vel.data[idx] = *in++;
+            if (fields & ghost_update_orientation)
+                h_orientation.data[idx] = *in++;
             }
+        } // end dir loop
+    }
 
-        if (flags[comm_flag::orientation])
-            {
-            ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
-                                               access_location::host,
-                                               access_mode::read);
-            ArrayHandle<Scalar4> h_orientation_copybuf(m_orientation_copybuf,
-                                                       access_location::host,
-                                                       access_mode::overwrite);
-            ArrayHandle<unsigned int> h_copy_ghosts(m_copy_ghosts[dir],
-                                                    access_location::host,
-                                                    access_mode::read);
-            ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(),
-                                             access_location::host,
-                                             access_mode::read);
+/*! \param flags Ghost communication flags
+    \returns The fields updated between ghost exchanges as a combination of ghost_update_* bits
+*/
+unsigned int Communicator::getGhostUpdateFields(const CommFlags& flags)
+    {
+    return (flags[comm_flag::position] ? ghost_update_position : 0)
+           | (flags[comm_flag::velocity] ? ghost_update_velocity : 0)
+           | (flags[comm_flag::orientation] ? ghost_update_orientation : 0);
+    }
 
-            // copy orientation of ghost particles
-            for (unsigned int ghost_idx = 0; ghost_idx < m_num_copy_ghosts[dir]; ghost_idx++)
-                {
-                unsigned int idx = h_rtag.data[h_copy_ghosts.data[ghost_idx]];
+/*! \param fields Fields to send (combination of ghost_update_* bits)
 
-                assert(idx < m_pdata->getN() + m_pdata->getNGhosts());
+    The ghost update sends a single message per direction that holds all requested fields of every
+    ghost. The buffers are sized from the ghost lists of the last ghost exchange and registered with
+    persistent requests, which the update restarts until the next ghost exchange.
 
-                // copy orientation into send buffer
-                h_orientation_copybuf.data[ghost_idx] = h_orientation.data[idx];
-                }
-            }
+    With shared memory ghosts enabled, neighbors on the same node exchange the records through
+    initializeGhostWindow() instead of messages. All ranks must call this method.
+*/
+void Communicator::initializeGhostUpdateRequests(unsigned int fields)
+    {
+    freeGhostUpdateRequests();
+
+    const unsigned int n_fields = ((fields & ghost_update_position) ? 1 : 0)
+                                  + ((fields & ghost_update_velocity) ? 1 : 0)
+                                  + ((fields & ghost_update_orientation) ? 1 : 0);
+
+    if (m_exec_conf->getMPIConfig()->getSharedMemoryGhosts())
+        {
+        initializeGhostWindow(n_fields);
+        }
+    else
+        {
+        freeGhostWindow();
+        }
+
+    for (unsigned int dir = 0; dir < 6; dir++)
+        {
+        if (!isCommunicating(dir))
+            continue;
 
         unsigned int send_neighbor = m_decomposition->getNeighborRank(dir);
 
@@ -2734,123 +3875,147 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
         else
             recv_neighbor = m_decomposition->getNeighborRank(dir - 1);
 
-        unsigned int start_idx;
+        if (!m_ghost_send_shared[dir])
+            {
+            m_ghost_update_sendbuf[dir].resize(size_t(m_num_copy_ghosts[dir]) * n_fields);
+            MPI_Send_init(m_ghost_update_sendbuf[dir].data(),
+                          int(m_ghost_update_sendbuf[dir].size() * sizeof(Scalar4)),
+                          MPI_BYTE,
+                          send_neighbor,
+                          1,
+                          m_mpi_comm,
+                          &m_ghost_update_reqs[2 * dir]);
+            }
 
-        start_idx = m_pdata->getN() + num_tot_recv_ghosts;
+        if (!m_ghost_recv_shared[dir])
+            {
+            m_ghost_update_recvbuf[dir].resize(size_t(m_num_recv_ghosts[dir]) * n_fields);
+            MPI_Recv_init(m_ghost_update_recvbuf[dir].data(),
+                          int(m_ghost_update_recvbuf[dir].size() * sizeof(Scalar4)),
+                          MPI_BYTE,
+                          recv_neighbor,
+                          1,
+                          m_mpi_comm,
+                          &m_ghost_update_reqs[2 * dir + 1]);
+            }
+        }
 
-        num_tot_recv_ghosts += m_num_recv_ghosts[dir];
+    m_ghost_update_fields = fields;
+    m_ghost_update_requests_valid = true;
+    }
 
-        // only non-permanent fields (position, velocity, orientation) need to be considered here
-        // charge, body, image and diameter are not updated between neighbor list builds
-        if (flags[comm_flag::position])
-            {
-            m_reqs.resize(2);
-            m_stats.resize(2);
+/*! \param n_fields Number of Scalar4 fields in each ghost record
 
-            ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
-                                       access_location::host,
-                                       access_mode::readwrite);
-            ArrayHandle<Scalar4> h_pos_copybuf(m_pos_copybuf,
-                                               access_location::host,
-                                               access_mode::read);
+    Every rank on the node owns one segment per direction in a window allocated with
+    MPI_Win_allocate_shared. A rank writes the records for an on-node neighbor into its own segment
+    and the neighbor reads them in place. All segments have the same capacity, so a rank finds the
+    segment of a peer from the peer's base address. The window only grows, so it is reallocated
+    rarely. All ranks must call this method.
+*/
+void Communicator::initializeGhostWindow(unsigned int n_fields)
+    {
+    if (m_node_comm == MPI_COMM_NULL)
+        {
+        MPI_Comm_split_type(m_mpi_comm, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &m_node_comm);
+        }
 
-            // exchange particle data, write directly to the particle data arrays
-            MPI_Isend(h_pos_copybuf.data,
-                      (unsigned int)(m_num_copy_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      send_neighbor,
-                      1,
-                      m_mpi_comm,
-                      &m_reqs[0]);
-            MPI_Irecv(h_pos.data + start_idx,
-                      (unsigned int)(m_num_recv_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      recv_neighbor,
-                      1,
-                      m_mpi_comm,
-                      &m_reqs[1]);
-            MPI_Waitall(2, &m_reqs.front(), &m_stats.front());
-            }
+    MPI_Group group, node_group;
+    MPI_Comm_group(m_mpi_comm, &group);
+    MPI_Comm_group(m_node_comm, &node_group);
 
-        if (flags[comm_flag::velocity])
-            {
-            m_reqs.resize(2);
-            m_stats.resize(2);
+    // find the neighbors that share this node
+    int node_recv_rank[6];
+    size_t capacity = 1;
+    for (unsigned int dir = 0; dir < 6; dir++)
+        {
+        m_ghost_send_shared[dir] = false;
+        m_ghost_recv_shared[dir] = false;
+        node_recv_rank[dir] = MPI_UNDEFINED;
+        if (!isCommunicating(dir))
+            continue;
 
-            ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
-                                       access_location::host,
-                                       access_mode::readwrite);
-            ArrayHandle<Scalar4> h_vel_copybuf(m_velocity_copybuf,
-                                               access_location::host,
-                                               access_mode::read);
+        int send_neighbor = int(m_decomposition->getNeighborRank(dir));
+        int recv_neighbor = int(m_decomposition->getNeighborRank(dir % 2 == 0 ? dir + 1 : dir - 1));
+        int node_send_rank;
+        MPI_Group_translate_ranks(group, 1, &send_neighbor, node_group, &node_send_rank);
+        MPI_Group_translate_ranks(group, 1, &recv_neighbor, node_group, &node_recv_rank[dir]);
 
-            // exchange particle data, write directly to the particle data arrays
-            MPI_Isend(h_vel_copybuf.data,
-                      (unsigned int)(m_num_copy_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      send_neighbor,
-                      2,
-                      m_mpi_comm,
-                      &m_reqs[0]);
-            MPI_Irecv(h_vel.data + start_idx,
-                      (unsigned int)(m_num_recv_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      recv_neighbor,
-                      2,
-                      m_mpi_comm,
-                      &m_reqs[1]);
-            MPI_Waitall(2, &m_reqs.front(), &m_stats.front());
+        m_ghost_send_shared[dir] = node_send_rank != MPI_UNDEFINED;
+        m_ghost_recv_shared[dir] = node_recv_rank[dir] != MPI_UNDEFINED;
+        if (m_ghost_send_shared[dir])
+            {
+            capacity = std::max(capacity, size_t(m_num_copy_ghosts[dir]) * n_fields);
             }
+        }
 
-        if (flags[comm_flag::orientation])
-            {
-            m_reqs.resize(2);
-            m_stats.resize(2);
+    MPI_Group_free(&group);
+    MPI_Group_free(&node_group);
 
-            ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
-                                               access_location::host,
-                                               access_mode::readwrite);
-            ArrayHandle<Scalar4> h_orientation_copybuf(m_orientation_copybuf,
-                                                       access_location::host,
-                                                       access_mode::read);
+    unsigned long node_capacity = (unsigned long)capacity;
+    MPI_Allreduce(MPI_IN_PLACE, &node_capacity, 1, MPI_UNSIGNED_LONG, MPI_MAX, m_node_comm);
 
-            // exchange particle data, write directly to the particle data arrays
-            MPI_Isend(h_orientation_copybuf.data,
-                      (unsigned int)(m_num_copy_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      send_neighbor,
-                      3,
-                      m_mpi_comm,
-                      &m_reqs[0]);
-            MPI_Irecv(h_orientation.data + start_idx,
-                      (unsigned int)(m_num_recv_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      recv_neighbor,
-                      3,
-                      m_mpi_comm,
-                      &m_reqs[1]);
-            MPI_Waitall(2, &m_reqs.front(), &m_stats.front());
-            }
+    if (m_ghost_window == MPI_WIN_NULL || node_capacity > m_ghost_window_capacity)
+        {
+        freeGhostWindow();
+
+        // leave room for the ghost layer to grow
+        m_ghost_window_capacity = node_capacity + node_capacity / 4;
+        MPI_Win_allocate_shared(MPI_Aint(6 * m_ghost_window_capacity * sizeof(Scalar4)),
+                                sizeof(Scalar4),
+                                MPI_INFO_NULL,
+                                m_node_comm,
+                                &m_ghost_window_base,
+                                &m_ghost_window);
+        MPI_Win_lock_all(MPI_MODE_NOCHECK, m_ghost_window);
+        }
 
-        // wrap particle positions (only if copying positions)
-        if (flags[comm_flag::position])
+    for (unsigned int dir = 0; dir < 6; dir++)
+        {
+        m_ghost_window_peer[dir] = nullptr;
+        if (m_ghost_recv_shared[dir])
             {
-            ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
-                                       access_location::host,
-                                       access_mode::readwrite);
+            MPI_Aint size;
+            int disp_unit;
+            Scalar4* peer_base;
+            MPI_Win_shared_query(m_ghost_window,
+                                 node_recv_rank[dir],
+                                 &size,
+                                 &disp_unit,
+                                 &peer_base);
+
+            // the peer sends in the same direction
+            m_ghost_window_peer[dir] = peer_base + dir * m_ghost_window_capacity;
+            }
+        }
+    }
 
-            const BoxDim shifted_box = getShiftedBox();
-            for (unsigned int idx = start_idx; idx < start_idx + m_num_recv_ghosts[dir]; idx++)
-                {
-                Scalar4& pos = h_pos.data[idx];
+void Communicator::freeGhostWindow()
+    {
+    if (m_ghost_window != MPI_WIN_NULL)
+        {
+        MPI_Win_unlock_all(m_ghost_window);
+        MPI_Win_free(&m_ghost_window);
+        }
+    m_ghost_window_base = nullptr;
+    m_ghost_window_capacity = 0;
+    for (unsigned int dir = 0; dir < 6; dir++)
+        {
+        m_ghost_send_shared[dir] = false;
+        m_ghost_recv_shared[dir] = false;
+        m_ghost_window_peer[dir] = nullptr;
+        }
+    }
 
-                // wrap particles received across a global boundary
-                int3 img = make_int3(0, 0, 0);
-                shifted_box.wrap(pos, img);
-                }
+void Communicator::freeGhostUpdateRequests()
+    {
+    for (unsigned int i = 0; i < 12; i++)
+        {
+        if (m_ghost_update_reqs[i] != MPI_REQUEST_NULL)
+            {
+            MPI_Request_free(&m_ghost_update_reqs[i]);
             }
-
-        } // end dir loop
+        }
+    m_ghost_update_requests_valid = false;
     }
 
 void Communicator::updateNetForce(uint64_t timestep)
@@ -2883,6 +4048,42 @@ void Communicator::updateNetForce(uint64_t timestep)
 
     m_exec_conf->msg->notice(7) << oss.str() << std::endl;
 
+    if (isBisection())
+        {
+        if (flags[comm_flag::reverse_net_force])
+            {
+            throw std::runtime_error(
+                "Reverse force communication is not supported with recursive bisection domains.");
+            }
+
+        if (flags[comm_flag::net_force])
+            {
+            ArrayHandle<Scalar4> h_netforce(m_pdata->getNetForce(),
+                                            access_location::host,
+                                            access_mode::readwrite);
+            exchangeGhostFieldBisection(h_netforce.data);
+            }
+        if (flags[comm_flag::net_torque])
+            {
+            ArrayHandle<Scalar4> h_nettorque(m_pdata->getNetTorqueArray(),
+                                             access_location::host,
+                                             access_mode::readwrite);
+            exchangeGhostFieldBisection(h_nettorque.data);
+            }
+        if (flags[comm_flag::net_virial])
+            {
+            ArrayHandle<Scalar> h_netvirial(m_pdata->getNetVirial(),
+                                            access_location::host,
+                                            access_mode::readwrite);
+            const size_t pitch = m_pdata->getNetVirial().getPitch();
+            for (unsigned int i = 0; i < 6; ++i)
+                {
+                exchangeGhostFieldBisection(h_netvirial.data + i * pitch);
+                }
+            }
+        return;
+        }
+
     // Set some global counters
     unsigned int num_tot_recv_ghosts = 0; // total number of ghosts received
     unsigned int num_tot_recv_ghosts_reverse
@@ -3304,6 +4505,23 @@ const BoxDim Communicator::getShiftedBox() const
     {
     // construct the shifted global box for applying global boundary conditions
     BoxDim shifted_box = m_pdata->getGlobalBox();
+
+    if (isBisection())
+        {
+        // center the global box on the local domain, which is wider than twice the ghost width
+        const unsigned int rank = m_exec_conf->getRank();
+        const Scalar3 lo = m_decomposition->getDomainLo(rank);
+        const Scalar3 hi = m_decomposition->getDomainHi(rank);
+        Scalar3 dx = shifted_box.makeCoordinates(Scalar(0.5) * (lo + hi));
+        shifted_box.setLoHi(shifted_box.getLo() + dx, shifted_box.getHi() + dx);
+
+        // wrap along the axes that the local domain does not span
+        shifted_box.setPeriodic(make_uchar3(hi.x - lo.x < Scalar(1.0),
+                                            hi.y - lo.y < Scalar(1.0),
+                                            hi.z - lo.z < Scalar(1.0)));
+        return shifted_box;
+        }
+
     Scalar3 f = make_scalar3(0.5, 0.5, 0.5);
 
     /* As was done before, shift the global box by half the size of the domain that you received
@@ -21,6 +21,8 @@
 
 #include <hoomd/extern/nano-signal-slot/nano_signal_slot.hpp>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #ifndef __HIPCC__
 #include <pybind11/pybind11.h>
@@ -324,7 +326,10 @@ class PYBIND11_EXPORT Communicator
      */
     virtual void finishUpdateGhosts(uint64_t timestep)
         {
-        // the base class implementation is currently empty
+        if (m_neighbor_update_pending)
+            {
+            finishNeighborUpdateGhosts();
+            }
         m_comm_pending = false;
         }
 
@@ -653,26 +658,28 @@ class PYBIND11_EXPORT Communicator
     void checkBoxSize()
         {
         Scalar3 L = m_pdata->getBox().getNearestPlaneDistance();
-        const Index3D& di = m_decomposition->getDomainIndexer();
+
+        // the local box is periodic along the axes that are not decomposed
+        uchar3 periodic = m_pdata->getBox().getPeriodic();
 
         Scalar r_ghost_max = getGhostLayerMaxWidth();
-        if ((r_ghost_max >= L.x / Scalar(2.0) && di.getW() > 1)
-            || (r_ghost_max >= L.y / Scalar(2.0) && di.getH() > 1)
-            || (r_ghost_max >= L.z / Scalar(2.0) && di.getD() > 1))
+        if ((r_ghost_max >= L.x / Scalar(2.0) && !periodic.x)
+            || (r_ghost_max >= L.y / Scalar(2.0) && !periodic.y)
+            || (r_ghost_max >= L.z / Scalar(2.0) && !periodic.z))
             {
             std::ostringstream msg;
             msg << "Communication error - " << std::endl;
             msg << "Simulation box too small for domain decomposition." << std::endl;
             msg << "r_ghost_max: " << r_ghost_max << std::endl;
-            if (di.getW() > 1)
+            if (!periodic.x)
                 {
                 msg << "d.x/2: " << L.x / Scalar(2.0) << std::endl;
                 }
-            if (di.getH() > 1)
+            if (!periodic.y)
                 {
                 msg << "d.y/2: " << L.y / Scalar(2.0) << std::endl;
                 }
-            if (di.getD() > 1)
+            if (!periodic.z)
                 {
                 msg << "d.z/2: " << L.z / Scalar(2.0) << std::endl;
                 }
@@ -685,6 +692,45 @@ class PYBIND11_EXPORT Communicator
     std::vector<detail::pdata_element> m_sendbuf; //!< Buffer for particles that are sent
     std::vector<detail::pdata_element> m_recvbuf; //!< Buffer for particles that are received
 
+    /* Aggregated ghost update */
+    //! Fields sent by the ghost update between ghost exchanges
+    enum GhostUpdateField
+        {
+        ghost_update_position = 1,
+        ghost_update_velocity = 2,
+        ghost_update_orientation = 4
+        };
+
+    std::vector<Scalar4> m_ghost_update_sendbuf[6]; //!< Per-direction packed ghost records (send)
+    std::vector<Scalar4> m_ghost_update_recvbuf[6]; //!< Per-direction packed ghost records (recv)
+    MPI_Request m_ghost_update_reqs[12]; //!< Persistent send and receive request per direction
+    unsigned int m_ghost_update_fields = 0;     //!< Fields registered with the requests
+    bool m_ghost_update_requests_valid = false; //!< True if the requests match the ghost lists
+
+    //! Select the fields updated between ghost exchanges
+    static unsigned int getGhostUpdateFields(const CommFlags& flags);
+
+    //! Size the ghost update buffers and register them with persistent requests
+    void initializeGhostUpdateRequests(unsigned int fields);
+
+    //! Release the persistent requests of the ghost update
+    void freeGhostUpdateRequests();
+
+    /* Shared memory ghost update between ranks on the same node */
+    MPI_Comm m_node_comm = MPI_COMM_NULL;    //!< Ranks that share memory with this rank
+    MPI_Win m_ghost_window = MPI_WIN_NULL;   //!< Shared window holding the outgoing ghost records
+    Scalar4* m_ghost_window_base = nullptr;  //!< Segments of this rank in the window
+    size_t m_ghost_window_capacity = 0;      //!< Number of Scalar4 in each direction's segment
+    Scalar4* m_ghost_window_peer[6] = {};    //!< Segment of the on-node rank we receive from
+    bool m_ghost_send_shared[6] = {};        //!< True if the send neighbor is on this node
+    bool m_ghost_recv_shared[6] = {};        //!< True if the receive neighbor is on this node
+
+    //! Allocate the shared window and locate the segments of the on-node neighbors
+    void initializeGhostWindow(unsigned int n_fields);
+
+    //! Release the shared window
+    void freeGhostWindow();
+
     /* Communication of bonded groups */
     GroupCommunicator<BondData> m_bond_comm; //!< Communication helper for bonds
     friend class GroupCommunicator<BondData>;
@@ -717,6 +763,82 @@ class PYBIND11_EXPORT Communicator
     //! Helper function to initialize adjacency arrays
     void initializeNeighborArrays();
 
+    /* Neighborhood collective exchange (MPIConfiguration::ExchangeScheme::neighbor) */
+    MPI_Comm m_graph_comm = MPI_COMM_NULL; //!< Distributed graph over the unique neighbors
+    std::vector<int> m_graph_neighbors;    //!< Ranks of the graph neighbors (in graph order)
+    int m_graph_index_of_dir[NEIGH_MAX];   //!< Graph neighbor index of each of the 27 offsets
+
+    MPIConfiguration::ExchangeScheme m_last_exchange_scheme; //!< Scheme used in the last step
+
+    bool m_neighbor_plan_valid = false;     //!< True when the neighbor ghost plan is current
+    bool m_neighbor_update_pending = false; //!< True when a neighbor ghost update is in flight
+
+    std::vector<unsigned int> m_neighbor_send_tags; //!< Tags of the ghosts sent to each neighbor
+    std::vector<unsigned int> m_neighbor_recv_ghost; //!< Ghost offset of each received record
+    std::vector<std::pair<unsigned int, unsigned int>>
+        m_neighbor_ghost_copies; //!< (duplicate, original) ghost offsets filled by a copy
+    std::vector<int> m_neighbor_send_counts;  //!< Number of records sent to each neighbor
+    std::vector<int> m_neighbor_send_displs;  //!< Offset of the records sent to each neighbor
+    std::vector<int> m_neighbor_recv_counts;  //!< Number of records received from each neighbor
+    std::vector<int> m_neighbor_recv_displs;  //!< Offset of the records received per neighbor
+    std::vector<Scalar4> m_neighbor_sendbuf;  //!< Registered send buffer of the ghost update
+    std::vector<Scalar4> m_neighbor_recvbuf;  //!< Registered receive buffer of the ghost update
+    unsigned int m_neighbor_fields = 0;       //!< Fields packed in each record (bit mask)
+    MPI_Datatype m_neighbor_record = MPI_DATATYPE_NULL; //!< Datatype of one ghost record
+    MPI_Request m_neighbor_request = MPI_REQUEST_NULL;  //!< Request of the ghost update
+    bool m_neighbor_request_persistent = false;         //!< True if the request is persistent
+
+    //! Check whether to exchange with neighborhood collectives
+    bool useNeighborCollectives() const
+        {
+        return isBisection()
+               || (m_exec_conf->getMPIConfig()->getExchangeScheme()
+                       == MPIConfiguration::ExchangeScheme::neighbor
+                   && m_n_unique_neigh > 0);
+        }
+
+    /* Recursive bisection domains (always exchanged with neighborhood collectives) */
+    Scalar3 m_bisection_ghost_fraction = {0, 0, 0}; //!< Ghost width of the graph (box fraction)
+
+    //! Check whether the domains are the leaves of a recursive bisection
+    bool isBisection() const
+        {
+        return m_decomposition->isRecursiveBisection();
+        }
+
+    //! Connect the graph communicator to all domains within the ghost width
+    void updateBisectionNeighbors();
+
+    //! Migrate particles to the bisection domains that own them
+    void migrateParticlesBisection();
+
+    //! Exchange the ghost layer with the bisection neighbors
+    void exchangeGhostsBisection();
+
+    //! Send a per-particle field of the ghost sources to the bisection neighbors
+    template<class T> void exchangeGhostFieldBisection(T* data);
+
+    //! Check whether any bonded groups must migrate along with the particles
+    bool hasBondedGroups() const;
+
+    //! Create the distributed graph communicator on first use
+    void initializeGraphCommunicator();
+
+    //! Migrate particles directly to their destination neighbor in a single round
+    void migrateParticlesNeighbor();
+
+    //! Agree with the neighbors on the ghosts sent by the neighbor ghost update
+    void buildNeighborGhostPlan();
+
+    //! Release the registered request and datatype of the neighbor ghost update
+    void freeNeighborRequest();
+
+    //! Pack ghost data and start the neighbor ghost update
+    void beginNeighborUpdateGhosts(const CommFlags& flags);
+
+    //! Complete the neighbor ghost update and unpack the received ghost data
+    void finishNeighborUpdateGhosts();
+
     //! Method that is called when ghost particles are requested to be removed
     void slotGhostParticlesRemoved()
         {
@@ -26,6 +26,12 @@ CommunicatorGPU::CommunicatorGPU(std::shared_ptr<SystemDefinition> sysdef,
       m_pair_comm(*this, m_sysdef->getPairData()), m_meshbond_comm(*this),
       m_meshtriangle_comm(*this)
     {
+    if (m_decomposition->isRecursiveBisection())
+        {
+        throw std::runtime_error(
+            "Recursive bisection domains are not supported on the GPU.");
+        }
+
     if (m_exec_conf->allConcurrentManagedAccess())
         {
         // inform the user to use a cuda-aware MPI
@@ -3,6 +3,7 @@
 
 #include "Action.h"
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -35,6 +36,16 @@
 
 namespace hoomd
     {
+/// A quantity that the native logger samples without calling into Python
+struct LogQuantity
+    {
+    /// Number of values in the quantity (0 when the quantity is not available)
+    unsigned int size = 0;
+
+    /// Write the values of the quantity at the given timestep to the output buffer
+    std::function<void(uint64_t timestep, double* values)> sample;
+    };
+
 //! Performs computations on ParticleData structures
 /*! The Compute is an abstract concept that performs some kind of computation on the
     particles in a ParticleData structure. This computation is to be done by reading
@@ -85,6 +96,19 @@ class PYBIND11_EXPORT Compute : public Action
     /// Python will notify C++ objects when they are detached from Simulation
     virtual void notifyDetach() { };
 
+    /// Get a quantity for the native logger
+    /** @param name Name of the loggable quantity in Python
+
+        Derived classes return the quantities they can evaluate in C++. Sampling a quantity may
+        be a collective call and must produce the same values on all ranks.
+
+        @returns The quantity, with size 0 when this compute does not provide \a name.
+    */
+    virtual LogQuantity getLogQuantity(const std::string& name)
+        {
+        return LogQuantity();
+        }
+
     protected:
     bool m_force_compute;     //!< true if calculation is enforced
     uint64_t m_last_computed; //!< Stores the last timestep compute was called
@@ -154,6 +154,9 @@ void DCDDumpWriter::analyze(uint64_t timestep)
 
     m_pdata->takeSnapshot(snapshot);
 
+    // collect the member tags of distributed groups on all ranks
+    m_group->gatherMemberTags();
+
 #ifdef ENABLE_MPI
     // if we are not the root processor, do not perform file I/O
     if (m_sysdef->isDomainDecomposed() && !m_exec_conf->isRoot())
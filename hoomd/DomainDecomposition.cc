@@ -22,6 +22,38 @@ using namespace std;
 
 namespace hoomd
     {
+namespace
+    {
+/// Get the component of a vector along an axis
+Scalar getAxis(const Scalar3& v, unsigned int axis)
+    {
+    return axis == 0 ? v.x : (axis == 1 ? v.y : v.z);
+    }
+
+/// Set the component of a vector along an axis
+void setAxis(Scalar3& v, unsigned int axis, Scalar value)
+    {
+    if (axis == 0)
+        v.x = value;
+    else if (axis == 1)
+        v.y = value;
+    else
+        v.z = value;
+    }
+
+/// Distance between two intervals of fractional coordinates on a periodic axis
+Scalar periodicGap(Scalar a_lo, Scalar a_hi, Scalar b_lo, Scalar b_hi)
+    {
+    Scalar gap = Scalar(1.0);
+    for (int shift = -1; shift <= 1; shift++)
+        {
+        Scalar d = std::max(b_lo + Scalar(shift) - a_hi, a_lo - (b_hi + Scalar(shift)));
+        gap = std::min(gap, std::max(d, Scalar(0.0)));
+        }
+    return gap;
+    }
+    } // end anonymous namespace
+
 //! Constructor
 /*! The constructor performs a spatial domain decomposition of the simulation box of processor with
  * rank \b exec_conf->getMPIroot(). The domain dimensions are distributed on the other processors.
@@ -100,6 +132,39 @@ DomainDecomposition::DomainDecomposition(std::shared_ptr<ExecutionConfiguration>
     initializeCumulativeFractions(try_fxs, try_fys, try_fzs);
     }
 
+/*!
+ * \param exec_conf The execution configuration
+ * \param L Box lengths of global box to sub-divide
+ * \param method Decomposition method ("bisection")
+ *
+ * The bisection starts with domains of equal volume. Call computeRecursiveBisection() once the
+ * particles are known. The grid is still set up, it orders the ranks but does not define domains.
+ */
+DomainDecomposition::DomainDecomposition(std::shared_ptr<ExecutionConfiguration> exec_conf,
+                                         Scalar3 L,
+                                         const std::string& method)
+    : m_exec_conf(exec_conf), m_mpi_comm(m_exec_conf->getMPICommunicator())
+    {
+    m_exec_conf->msg->notice(5) << "Constructing DomainDecomposition" << endl;
+
+    if (method != "bisection")
+        {
+        throw std::invalid_argument("Unknown domain decomposition method: " + method);
+        }
+
+    initializeDomainGrid(L, 0, 0, 0, false);
+    std::vector<Scalar> cur_fxs(m_nx - 1, Scalar(1.0) / Scalar(m_nx));
+    std::vector<Scalar> cur_fys(m_ny - 1, Scalar(1.0) / Scalar(m_ny));
+    std::vector<Scalar> cur_fzs(m_nz - 1, Scalar(1.0) / Scalar(m_nz));
+    initializeCumulativeFractions(cur_fxs, cur_fys, cur_fzs);
+
+    m_bisection = true;
+    computeRecursiveBisection(BoxDim(L),
+                              std::vector<Scalar3>(),
+                              std::vector<Scalar>(),
+                              make_scalar3(0, 0, 0));
+    }
+
 /*!
  * \param L Box lengths of global box to sub-divide
  * \param nx Requested number of domains along the x direction (0 == choose default)
@@ -482,6 +547,14 @@ unsigned int DomainDecomposition::getNeighborRank(unsigned int dir) const
 //! Determines whether the local box shares a boundary with the global box
 bool DomainDecomposition::isAtBoundary(unsigned int dir) const
     {
+    if (m_bisection)
+        {
+        const unsigned int rank = m_exec_conf->getRank();
+        const Scalar lo = getAxis(m_domain_lo[rank], dir / 2);
+        const Scalar hi = getAxis(m_domain_hi[rank], dir / 2);
+        return dir % 2 == 0 ? hi == Scalar(1.0) : lo == Scalar(0.0);
+        }
+
     return ((dir == 0 && m_grid_pos.x == m_nx - 1) || (dir == 1 && m_grid_pos.x == 0)
             || (dir == 2 && m_grid_pos.y == m_ny - 1) || (dir == 3 && m_grid_pos.y == 0)
             || (dir == 4 && m_grid_pos.z == m_nz - 1) || (dir == 5 && m_grid_pos.z == 0));
@@ -580,16 +653,23 @@ const BoxDim DomainDecomposition::calculateLocalBox(const BoxDim& global_box)
     Scalar3 lo_cumulative_frac = make_scalar3(m_cumulative_frac_x[m_grid_pos.x],
                                               m_cumulative_frac_y[m_grid_pos.y],
                                               m_cumulative_frac_z[m_grid_pos.z]);
-    Scalar3 lo = global_box.getLo() + lo_cumulative_frac * L;
-
     Scalar3 hi_cumulative_frac = make_scalar3(m_cumulative_frac_x[m_grid_pos.x + 1],
                                               m_cumulative_frac_y[m_grid_pos.y + 1],
                                               m_cumulative_frac_z[m_grid_pos.z + 1]);
+    if (m_bisection)
+        {
+        lo_cumulative_frac = m_domain_lo[m_exec_conf->getRank()];
+        hi_cumulative_frac = m_domain_hi[m_exec_conf->getRank()];
+        }
+    Scalar3 lo = global_box.getLo() + lo_cumulative_frac * L;
     Scalar3 hi = global_box.getLo() + hi_cumulative_frac * L;
 
     // set periodic flags
-    // we are periodic in a direction along which there is only one box
-    uchar3 periodic = make_uchar3(m_nx == 1 ? 1 : 0, m_ny == 1 ? 1 : 0, m_nz == 1 ? 1 : 0);
+    // we are periodic in a direction along which the domain spans the whole box
+    uchar3 periodic = make_uchar3(
+        lo_cumulative_frac.x == Scalar(0.0) && hi_cumulative_frac.x == Scalar(1.0) ? 1 : 0,
+        lo_cumulative_frac.y == Scalar(0.0) && hi_cumulative_frac.y == Scalar(1.0) ? 1 : 0,
+        lo_cumulative_frac.z == Scalar(0.0) && hi_cumulative_frac.z == Scalar(1.0) ? 1 : 0);
 
     box.setLoHi(lo, hi);
     box.setPeriodic(periodic);
@@ -627,6 +707,18 @@ unsigned int DomainDecomposition::placeParticle(const BoxDim& global_box,
         throw std::runtime_error(o.str());
         }
 
+    if (m_bisection)
+        {
+        // descend the tree, particles on a cut plane belong to the upper domain
+        unsigned int node = 0;
+        while (m_bisection_tree[node].n_ranks > 1)
+            {
+            const BisectionNode& n = m_bisection_tree[node];
+            node = n.child[getAxis(f, n.axis) < n.cut ? 0 : 1];
+            }
+        return m_bisection_tree[node].first_rank;
+        }
+
     // compute the box the particle should be placed into
     // use the lower_bound (the first element that does not compare last < the search term)
     // then, the domain to place into is it-1 (since we want to place into the one that it actually
@@ -662,6 +754,260 @@ unsigned int DomainDecomposition::placeParticle(const BoxDim& global_box,
     return rank;
     }
 
+/*!
+ * \param global_box The global simulation box
+ * \param fractions Fractional coordinates of the particles held by this rank
+ * \param weights Weight of each particle (empty for unit weights)
+ * \param min_width Minimum width of a domain along each axis (fractional)
+ *
+ * Each node of the tree cuts its box normal to the axis along which the box is widest. The cut
+ * divides the weight in the box in proportion to the number of ranks below and above it. The
+ * ranks locate the cut planes of all nodes at one level of the tree together: they reduce a
+ * weight histogram over the range of each node that contains the cut and refine the range three
+ * times before interpolating within the final bin. A node that holds no weight is cut by volume.
+ *
+ * The particles may be held by any rank, for example all on the root rank. Every rank computes
+ * the same tree from the reduced histograms. All ranks must call this method.
+ */
+void DomainDecomposition::computeRecursiveBisection(const BoxDim& global_box,
+                                                    const std::vector<Scalar3>& fractions,
+                                                    const std::vector<Scalar>& weights,
+                                                    Scalar3 min_width)
+    {
+    const unsigned int n_bins = 64;
+    const unsigned int n_passes = 3;
+    const unsigned int n_ranks = m_exec_conf->getNRanks();
+    const unsigned int n_axes = global_box.getL().z == Scalar(0.0) ? 2 : 3;
+    const Scalar3 box_dist = global_box.getNearestPlaneDistance();
+
+    m_bisection_tree.clear();
+    BisectionNode root;
+    root.first_rank = 0;
+    root.n_ranks = n_ranks;
+    root.axis = 0;
+    root.cut = Scalar(0.0);
+    root.child[0] = root.child[1] = 0;
+    root.lo = make_scalar3(0, 0, 0);
+    root.hi = make_scalar3(1, 1, 1);
+    m_bisection_tree.push_back(root);
+
+    // node of the tree that holds each particle
+    std::vector<unsigned int> particle_node(fractions.size(), 0);
+
+    std::vector<unsigned int> level;
+    if (n_ranks > 1)
+        {
+        level.push_back(0);
+        }
+
+    while (!level.empty())
+        {
+        const unsigned int n_active = (unsigned int)level.size();
+        std::vector<int> active_index(m_bisection_tree.size(), -1);
+        std::vector<Scalar> range_lo(n_active), range_hi(n_active);
+        std::vector<double> below(n_active, 0.0), target(n_active, 0.0), bin_weight(n_active);
+        std::vector<char> empty(n_active, 0);
+
+        for (unsigned int a = 0; a < n_active; a++)
+            {
+            BisectionNode& node = m_bisection_tree[level[a]];
+            active_index[level[a]] = int(a);
+
+            // cut normal to the widest axis
+            node.axis = 0;
+            Scalar max_width(-1.0);
+            for (unsigned int axis = 0; axis < n_axes; axis++)
+                {
+                Scalar width = getAxis(box_dist, axis)
+                               * (getAxis(node.hi, axis) - getAxis(node.lo, axis));
+                if (width > max_width)
+                    {
+                    max_width = width;
+                    node.axis = axis;
+                    }
+                }
+            range_lo[a] = getAxis(node.lo, node.axis);
+            range_hi[a] = getAxis(node.hi, node.axis);
+            }
+
+        std::vector<double> histogram(size_t(n_active) * n_bins);
+        for (unsigned int pass = 0; pass < n_passes; pass++)
+            {
+            std::fill(histogram.begin(), histogram.end(), 0.0);
+            for (size_t i = 0; i < fractions.size(); i++)
+                {
+                int a = active_index[particle_node[i]];
+                if (a < 0)
+                    continue;
+
+                Scalar x = getAxis(fractions[i], m_bisection_tree[level[a]].axis);
+                if (pass > 0 && (x < range_lo[a] || x >= range_hi[a]))
+                    continue;
+
+                int bin = int((x - range_lo[a]) / (range_hi[a] - range_lo[a]) * Scalar(n_bins));
+                bin = std::max(0, std::min(int(n_bins) - 1, bin));
+                histogram[size_t(a) * n_bins + bin] += weights.empty() ? 1.0 : double(weights[i]);
+                }
+
+            MPI_Allreduce(MPI_IN_PLACE,
+                          histogram.data(),
+                          int(histogram.size()),
+                          MPI_DOUBLE,
+                          MPI_SUM,
+                          m_mpi_comm);
+
+            for (unsigned int a = 0; a < n_active; a++)
+                {
+                if (empty[a])
+                    continue;
+
+                const double* h = histogram.data() + size_t(a) * n_bins;
+                if (pass == 0)
+                    {
+                    const BisectionNode& node = m_bisection_tree[level[a]];
+                    double total = std::accumulate(h, h + n_bins, 0.0);
+                    target[a] = total * double(node.n_ranks / 2) / double(node.n_ranks);
+                    if (total <= 0.0)
+                        {
+                        empty[a] = 1;
+                        continue;
+                        }
+                    }
+
+                // narrow the range to the bin that contains the target weight
+                unsigned int bin = 0;
+                while (bin < n_bins - 1 && below[a] + h[bin] < target[a])
+                    {
+                    below[a] += h[bin];
+                    bin++;
+                    }
+                Scalar bin_width = (range_hi[a] - range_lo[a]) / Scalar(n_bins);
+                range_lo[a] += Scalar(bin) * bin_width;
+                range_hi[a] = range_lo[a] + bin_width;
+                bin_weight[a] = h[bin];
+                }
+            }
+
+        std::vector<unsigned int> next_level;
+        for (unsigned int a = 0; a < n_active; a++)
+            {
+            const unsigned int node_idx = level[a];
+            const unsigned int n_lower = m_bisection_tree[node_idx].n_ranks / 2;
+            const unsigned int n_upper = m_bisection_tree[node_idx].n_ranks - n_lower;
+            const unsigned int axis = m_bisection_tree[node_idx].axis;
+            const Scalar lo = getAxis(m_bisection_tree[node_idx].lo, axis);
+            const Scalar hi = getAxis(m_bisection_tree[node_idx].hi, axis);
+            const Scalar min_w = getAxis(min_width, axis);
+
+            Scalar cut = lo + (hi - lo) * Scalar(n_lower) / Scalar(n_lower + n_upper);
+            if (!empty[a])
+                {
+                Scalar t = bin_weight[a] > 0.0 ? Scalar((target[a] - below[a]) / bin_weight[a])
+                                               : Scalar(0.5);
+                cut = range_lo[a] + std::max(Scalar(0.0), std::min(Scalar(1.0), t))
+                                        * (range_hi[a] - range_lo[a]);
+                }
+
+            // keep the domains wide enough for the ghost layer
+            if (hi - lo >= Scalar(n_lower + n_upper) * min_w)
+                {
+                cut = std::max(cut, lo + Scalar(n_lower) * min_w);
+                cut = std::min(cut, hi - Scalar(n_upper) * min_w);
+                }
+
+            BisectionNode lower = m_bisection_tree[node_idx];
+            lower.n_ranks = n_lower;
+            setAxis(lower.hi, axis, cut);
+
+            BisectionNode upper = m_bisection_tree[node_idx];
+            upper.first_rank += n_lower;
+            upper.n_ranks = n_upper;
+            setAxis(upper.lo, axis, cut);
+
+            m_bisection_tree[node_idx].cut = cut;
+            m_bisection_tree[node_idx].child[0] = (unsigned int)m_bisection_tree.size();
+            m_bisection_tree.push_back(lower);
+            m_bisection_tree[node_idx].child[1] = (unsigned int)m_bisection_tree.size();
+            m_bisection_tree.push_back(upper);
+
+            for (unsigned int c = 0; c < 2; c++)
+                {
+                const unsigned int child = m_bisection_tree[node_idx].child[c];
+                if (m_bisection_tree[child].n_ranks > 1)
+                    {
+                    next_level.push_back(child);
+                    }
+                }
+            }
+
+        // move the particles to the child nodes
+        for (size_t i = 0; i < fractions.size(); i++)
+            {
+            const BisectionNode& node = m_bisection_tree[particle_node[i]];
+            if (node.n_ranks > 1)
+                {
+                particle_node[i] = node.child[getAxis(fractions[i], node.axis) < node.cut ? 0 : 1];
+                }
+            }
+
+        level.swap(next_level);
+        }
+
+    m_domain_lo.resize(n_ranks);
+    m_domain_hi.resize(n_ranks);
+    for (const auto& node : m_bisection_tree)
+        {
+        if (node.n_ranks == 1)
+            {
+            m_domain_lo[node.first_rank] = node.lo;
+            m_domain_hi[node.first_rank] = node.hi;
+            }
+        }
+    }
+
+/*!
+ * \param distance Distance along each axis (fractional)
+ * \returns The ranks (in increasing order) whose domains lie within \a distance of this rank's
+ * domain along every axis, taking periodic images into account.
+ *
+ * The relation is symmetric when all ranks pass the same \a distance.
+ */
+std::vector<unsigned int> DomainDecomposition::findNearbyDomains(Scalar3 distance) const
+    {
+    const Scalar tol(1e-6);
+    const unsigned int my_rank = m_exec_conf->getRank();
+    const Scalar3 my_lo = m_domain_lo[my_rank];
+    const Scalar3 my_hi = m_domain_hi[my_rank];
+
+    std::vector<unsigned int> result;
+    for (unsigned int rank = 0; rank < m_exec_conf->getNRanks(); rank++)
+        {
+        if (rank == my_rank)
+            continue;
+
+        bool nearby = true;
+        for (unsigned int axis = 0; axis < 3 && nearby; axis++)
+            {
+            const Scalar a_lo = getAxis(my_lo, axis), a_hi = getAxis(my_hi, axis);
+            const Scalar b_lo = getAxis(m_domain_lo[rank], axis);
+            const Scalar b_hi = getAxis(m_domain_hi[rank], axis);
+
+            // a domain that spans the box is near every other domain along that axis
+            if (a_hi - a_lo >= Scalar(1.0) || b_hi - b_lo >= Scalar(1.0))
+                continue;
+
+            nearby = periodicGap(a_lo, a_hi, b_lo, b_hi) <= getAxis(distance, axis) + tol;
+            }
+
+        if (nearby)
+            {
+            result.push_back(rank);
+            }
+        }
+
+    return result;
+    }
+
 void DomainDecomposition::findCommonNodes()
     {
     // get MPI node name
@@ -731,7 +1077,9 @@ void export_DomainDecomposition(pybind11::module& m)
                             const std::vector<Scalar>&,
                             const std::vector<Scalar>&,
                             const std::vector<Scalar>&>())
-        .def("getCumulativeFractions", &DomainDecomposition::getCumulativeFractions);
+        .def(pybind11::init<std::shared_ptr<ExecutionConfiguration>, Scalar3, const std::string&>())
+        .def("getCumulativeFractions", &DomainDecomposition::getCumulativeFractions)
+        .def("isRecursiveBisection", &DomainDecomposition::isRecursiveBisection);
     }
     } // end namespace detail
 
@@ -15,6 +15,7 @@
 #include "Index1D.h"
 
 #include <set>
+#include <string>
 #include <vector>
 
 #ifndef __HIPCC__
@@ -44,6 +45,12 @@ namespace hoomd
  * box is covered. If the specified number of ranks does not match the number that is available,
  * behavior is reverted to the normal default with uniform cuts along each dimension.
  *
+ *  Regular grids leave whole columns of ranks nearly empty in slab and droplet geometries. The
+ * recursive bisection method instead assigns every rank an axis-aligned box that is a leaf of a
+ * k-d tree. Each node of the tree cuts its box normal to its longest axis so that both halves
+ * hold a share of the particle weight proportional to their number of ranks. The domains no
+ * longer form a grid, so a domain may border any number of other domains.
+ *
  *  The initialization of the domain decomposition scheme is performed in the constructor.
  */
 class PYBIND11_EXPORT DomainDecomposition
@@ -72,6 +79,38 @@ class PYBIND11_EXPORT DomainDecomposition
                         const std::vector<Scalar>& fys,
                         const std::vector<Scalar>& fzs);
 
+    //! Constructor for a named decomposition method
+    DomainDecomposition(std::shared_ptr<ExecutionConfiguration> exec_conf,
+                        Scalar3 L,
+                        const std::string& method);
+
+    //! Check whether the domains are the leaves of a recursive bisection
+    bool isRecursiveBisection() const
+        {
+        return m_bisection;
+        }
+
+    //! Collectively bisect the global box into domains of equal weight
+    void computeRecursiveBisection(const BoxDim& global_box,
+                                   const std::vector<Scalar3>& fractions,
+                                   const std::vector<Scalar>& weights,
+                                   Scalar3 min_width);
+
+    //! Get the lower corner of a bisection domain in fractional coordinates of the global box
+    Scalar3 getDomainLo(unsigned int rank) const
+        {
+        return m_domain_lo[rank];
+        }
+
+    //! Get the upper corner of a bisection domain in fractional coordinates of the global box
+    Scalar3 getDomainHi(unsigned int rank) const
+        {
+        return m_domain_hi[rank];
+        }
+
+    //! Find the bisection domains within a given distance of the local domain
+    std::vector<unsigned int> findNearbyDomains(Scalar3 distance) const;
+
     //! Calculate MPI ranks of neighboring domain.
     unsigned int getNeighborRank(unsigned int dir) const;
 
@@ -228,7 +267,24 @@ class PYBIND11_EXPORT DomainDecomposition
     std::vector<Scalar> m_cumulative_frac_x; //!< Cumulative fractions in x below cut plane index
     std::vector<Scalar> m_cumulative_frac_y; //!< Cumulative fractions in y below cut plane index
     std::vector<Scalar> m_cumulative_frac_z; //!< Cumulative fractions in z below cut plane index
-#endif                                       // ENABLE_MPI
+
+    //! A node of the recursive bisection tree
+    struct BisectionNode
+        {
+        unsigned int first_rank; //!< First rank of the domains in the subtree
+        unsigned int n_ranks;    //!< Number of domains in the subtree
+        unsigned int axis;       //!< Axis normal to the cut plane (0=x, 1=y, 2=z)
+        Scalar cut;              //!< Fractional coordinate of the cut plane
+        unsigned int child[2];   //!< Nodes below and above the cut plane
+        Scalar3 lo;              //!< Lower corner of the subtree (fractional)
+        Scalar3 hi;              //!< Upper corner of the subtree (fractional)
+        };
+
+    bool m_bisection = false;                    //!< True if the domains come from the bisection
+    std::vector<BisectionNode> m_bisection_tree; //!< Nodes of the bisection (root first)
+    std::vector<Scalar3> m_domain_lo;            //!< Lower corner of every bisection domain
+    std::vector<Scalar3> m_domain_hi;            //!< Upper corner of every bisection domain
+#endif                                           // ENABLE_MPI
     };
 
 namespace detail
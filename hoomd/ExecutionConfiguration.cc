@@ -67,6 +67,9 @@ ExecutionConfiguration::ExecutionConfiguration(executionMode mode,
         msg = std::shared_ptr<Messenger>(new Messenger(m_mpi_config));
         }
 
+    m_profiler = std::make_shared<Profiler>(m_mpi_config);
+    m_memory_registry = std::make_shared<MemoryRegistry>(m_mpi_config);
+
     ostringstream s;
     for (auto it = gpu_id.begin(); it != gpu_id.end(); ++it)
         {
@@ -703,6 +706,12 @@ void export_ExecutionConfiguration(pybind11::module& m)
         .def("getNumThreads", &ExecutionConfiguration::getNumThreads)
         .def("setMemoryTracing", &ExecutionConfiguration::setMemoryTracing)
         .def("memoryTracingEnabled", &ExecutionConfiguration::memoryTracingEnabled)
+        .def("getProfiler",
+             &ExecutionConfiguration::getProfiler,
+             pybind11::return_value_policy::reference_internal)
+        .def("getMemoryRegistry",
+             &ExecutionConfiguration::getMemoryRegistry,
+             pybind11::return_value_policy::reference_internal)
         .def_static("getCapableDevices", &ExecutionConfiguration::getCapableDevices)
         .def_static("getScanMessages", &ExecutionConfiguration::getScanMessages)
         .def("getActiveDevices", &ExecutionConfiguration::getActiveDevices);
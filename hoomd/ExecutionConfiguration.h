@@ -30,7 +30,9 @@
 #include <tbb/task_arena.h>
 #endif
 
+#include "MemoryRegistry.h"
 #include "Messenger.h"
+#include "Profiler.h"
 
 /*! \file ExecutionConfiguration.h
     \brief Declares ExecutionConfiguration and related classes
@@ -305,6 +307,18 @@ class PYBIND11_EXPORT ExecutionConfiguration
         return m_memory_tracing;
         }
 
+    /// Get the profiler that records the time spent in each operation
+    Profiler* getProfiler() const
+        {
+        return m_profiler.get();
+        }
+
+    /// Get the registry that accounts for the memory held by the simulation objects
+    MemoryRegistry* getMemoryRegistry() const
+        {
+        return m_memory_registry.get();
+        }
+
     //! Returns true if we are in a multi-GPU block
     bool inMultiGPUBlock() const
         {
@@ -410,6 +424,12 @@ class PYBIND11_EXPORT ExecutionConfiguration
     void setupStats();
 
     bool m_memory_tracing = false;
+
+    /// Profiler for the operations executed on this device
+    std::shared_ptr<Profiler> m_profiler;
+
+    /// Memory held by the objects that use this device
+    std::shared_ptr<MemoryRegistry> m_memory_registry;
     };
 
 #if defined(ENABLE_HIP)
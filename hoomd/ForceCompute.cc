@@ -87,6 +87,14 @@ ForceCompute::ForceCompute(std::shared_ptr<SystemDefinition> sysdef)
     m_pdata->getMaxParticleNumberChangeSignal().connect<ForceCompute, &ForceCompute::reallocate>(
         this);
 
+    // the rows past the local and ghost particles are slack from the particle data resizing
+    MemoryRegistry* registry = m_exec_conf->getMemoryRegistry();
+    registry->addObject(this);
+    auto n_rows = [this]() { return size_t(m_pdata->getN() + m_pdata->getNGhosts()); };
+    registry->addArray(this, m_force, n_rows);
+    registry->addArray(this, m_virial, [n_rows]() { return n_rows() * 6; });
+    registry->addArray(this, m_torque, n_rows);
+
     // reset external virial
     for (unsigned int i = 0; i < 6; ++i)
         m_external_virial[i] = Scalar(0.0);
@@ -206,6 +214,45 @@ ForceCompute::~ForceCompute()
         this);
     m_pdata->getMaxParticleNumberChangeSignal().disconnect<ForceCompute, &ForceCompute::reallocate>(
         this);
+    m_exec_conf->getMemoryRegistry()->removeObject(this);
+    }
+
+/*! \param name Name of the loggable quantity in Python
+
+    Provides energy, additional_energy, and additional_virial.
+*/
+LogQuantity ForceCompute::getLogQuantity(const std::string& name)
+    {
+    LogQuantity quantity;
+    if (name == "energy")
+        {
+        quantity.size = 1;
+        quantity.sample = [this](uint64_t timestep, double* values)
+        {
+            compute(timestep);
+            values[0] = calcEnergySum();
+        };
+        }
+    else if (name == "additional_energy")
+        {
+        quantity.size = 1;
+        quantity.sample = [this](uint64_t timestep, double* values)
+        {
+            compute(timestep);
+            values[0] = getExternalEnergy();
+        };
+        }
+    else if (name == "additional_virial")
+        {
+        quantity.size = 6;
+        quantity.sample = [this](uint64_t timestep, double* values)
+        {
+            compute(timestep);
+            for (unsigned int i = 0; i < 6; i++)
+                values[i] = getExternalVirial(i);
+        };
+        }
+    return quantity;
     }
 
 /*! Sums the total potential energy calculated by the last call to compute() and returns it.
@@ -566,6 +613,8 @@ void ForceCompute::compute(uint64_t timestep)
     // flags do not match
     if (m_particles_sorted || shouldCompute(timestep) || m_pdata->getFlags() != m_computed_flags)
         {
+        ScopedProfile profile(m_exec_conf->getProfiler(), *this);
+        ScopedComputeTime compute_time(m_exec_conf->getProfiler());
         computeForces(timestep);
         }
 
@@ -155,6 +155,9 @@ class PYBIND11_EXPORT ForceCompute : public Compute
         return m_external_energy;
         }
 
+    /// Get a quantity for the native logger
+    virtual LogQuantity getLogQuantity(const std::string& name);
+
 #ifdef ENABLE_MPI
     //! Get requested ghost communication flags
     virtual CommFlags getRequestedCommFlags(uint64_t timestep)
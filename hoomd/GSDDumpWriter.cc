@@ -54,7 +54,8 @@ GSDDumpWriter::GSDDumpWriter(std::shared_ptr<SystemDefinition> sysdef,
                              std::shared_ptr<ParticleGroup> group,
                              std::string mode,
                              bool truncate)
-    : Analyzer(sysdef, trigger), m_fname(fname), m_mode(mode), m_truncate(truncate), m_group(group)
+    : Analyzer(sysdef, trigger), m_fname(fname), m_mode(mode), m_truncate(truncate),
+      m_main_trigger(trigger), m_group(group)
     {
     m_exec_conf->msg->notice(5) << "Constructing GSDDumpWriter: " << m_fname << " " << mode << " "
                                 << truncate << endl;
@@ -146,78 +147,127 @@ pybind11::tuple GSDDumpWriter::getDynamic()
     return pybind11::tuple(result);
     }
 
-void GSDDumpWriter::setDynamic(pybind11::object dynamic)
+std::bitset<GSDDumpWriter::n_gsd_flags> GSDDumpWriter::parseDynamic(pybind11::object dynamic)
     {
     pybind11::list dynamic_list = dynamic;
-    m_dynamic.reset();
-    m_write_topology = false;
+    std::bitset<n_gsd_flags> result;
 
     for (const auto& s_py : dynamic_list)
         {
         std::string s = s_py.cast<std::string>();
         if (s == "configuration/box" || s == "property")
             {
-            m_dynamic[gsd_flag::configuration_box] = true;
+            result[gsd_flag::configuration_box] = true;
             }
         if (s == "particles/N" || s == "property")
             {
-            m_dynamic[gsd_flag::particles_N] = true;
+            result[gsd_flag::particles_N] = true;
             }
         if (s == "particles/position" || s == "property")
             {
-            m_dynamic[gsd_flag::particles_position] = true;
+            result[gsd_flag::particles_position] = true;
             }
         if (s == "particles/orientation" || s == "property")
             {
-            m_dynamic[gsd_flag::particles_orientation] = true;
+            result[gsd_flag::particles_orientation] = true;
             }
         if (s == "particles/velocity" || s == "momentum")
             {
-            m_dynamic[gsd_flag::particles_velocity] = true;
+            result[gsd_flag::particles_velocity] = true;
             }
         if (s == "particles/angmom" || s == "momentum")
             {
-            m_dynamic[gsd_flag::particles_angmom] = true;
+            result[gsd_flag::particles_angmom] = true;
             }
         if (s == "particles/image" || s == "momentum")
             {
-            m_dynamic[gsd_flag::particles_image] = true;
+            result[gsd_flag::particles_image] = true;
             }
         if (s == "particles/types" || s == "attribute")
             {
-            m_dynamic[gsd_flag::particles_types] = true;
+            result[gsd_flag::particles_types] = true;
             }
         if (s == "particles/typeid" || s == "attribute")
             {
-            m_dynamic[gsd_flag::particles_type] = true;
+            result[gsd_flag::particles_type] = true;
             }
         if (s == "particles/mass" || s == "attribute")
             {
-            m_dynamic[gsd_flag::particles_mass] = true;
+            result[gsd_flag::particles_mass] = true;
             }
         if (s == "particles/charge" || s == "attribute")
             {
-            m_dynamic[gsd_flag::particles_charge] = true;
+            result[gsd_flag::particles_charge] = true;
             }
         if (s == "particles/diameter" || s == "attribute")
             {
-            m_dynamic[gsd_flag::particles_diameter] = true;
+            result[gsd_flag::particles_diameter] = true;
             }
         if (s == "particles/body" || s == "attribute")
             {
-            m_dynamic[gsd_flag::particles_body] = true;
+            result[gsd_flag::particles_body] = true;
             }
         if (s == "particles/moment_inertia" || s == "attribute")
             {
-            m_dynamic[gsd_flag::particles_inertia] = true;
+            result[gsd_flag::particles_inertia] = true;
             }
-        if (s == "topology")
+        }
+
+    return result;
+    }
+
+void GSDDumpWriter::setDynamic(pybind11::object dynamic)
+    {
+    m_dynamic = parseDynamic(dynamic);
+    m_write_topology = false;
+
+    pybind11::list dynamic_list = dynamic;
+    for (const auto& s_py : dynamic_list)
+        {
+        if (s_py.cast<std::string>() == "topology")
             {
             m_write_topology = true;
             }
         }
     }
 
+/*! \param trigger Select the timesteps to write
+    \param group Particles to write
+    \param dynamic Field names and categories to write in every frame
+
+    Frames of a sub-stream with the main group write the non-default fields listed in \a dynamic
+    and fall back to frame 0 for the others, as frames of the main stream do. A reader takes the
+    missing fields of any frame from frame 0, so frames of other groups write every field that is
+    non-default in the frame or in frame 0.
+*/
+void GSDDumpWriter::addStream(std::shared_ptr<Trigger> trigger,
+                              std::shared_ptr<ParticleGroup> group,
+                              pybind11::object dynamic)
+    {
+    Stream stream;
+    stream.trigger = trigger;
+    stream.group = group;
+    stream.dynamic = parseDynamic(dynamic);
+    m_streams.push_back(stream);
+    updateTrigger();
+    }
+
+void GSDDumpWriter::updateTrigger()
+    {
+    if (m_streams.empty())
+        {
+        m_trigger = m_main_trigger;
+        return;
+        }
+
+    std::vector<std::shared_ptr<Trigger>> triggers {m_main_trigger};
+    for (const auto& stream : m_streams)
+        {
+        triggers.push_back(stream.trigger);
+        }
+    m_trigger = std::make_shared<OrTrigger>(triggers);
+    }
+
 void GSDDumpWriter::flush()
     {
     if (m_exec_conf->isRoot())
@@ -330,6 +380,13 @@ GSDDumpWriter::~GSDDumpWriter()
         m_exec_conf->msg->notice(5) << "GSD: close gsd file " << m_fname << endl;
         gsd_close(&m_handle);
         }
+
+#ifdef ENABLE_MPI
+    if (m_mpi_file != MPI_FILE_NULL)
+        {
+        MPI_File_close(&m_mpi_file);
+        }
+#endif
     }
 
 //! Get the logged data for the current frame if any.
@@ -366,15 +423,42 @@ void GSDDumpWriter::analyze(uint64_t timestep)
         m_nframes = 0;
         }
 
-    populateLocalFrame(m_local_frame, timestep);
-    auto log_data = getLogData();
-    write(m_local_frame, log_data);
+    // The main stream writes frame 0, so later frames of the main group may omit fields.
+    if (m_streams.empty() || m_nframes == 0 || (*m_main_trigger)(timestep))
+        {
+        populateLocalFrame(m_local_frame, timestep);
+        auto log_data = getLogData();
+        write(m_local_frame, log_data);
+        }
+
+    for (unsigned int i = 0; i < m_streams.size(); i++)
+        {
+        const Stream& stream = m_streams[i];
+        if (!(*stream.trigger)(timestep))
+            continue;
+
+        // logged quantities belong to the main stream
+        populateLocalFrame(m_local_frame, timestep, stream.group, stream.dynamic, i + 1);
+        write(m_local_frame, pybind11::dict());
+        }
     }
 
 void GSDDumpWriter::write(GSDDumpWriter::GSDFrame& frame, pybind11::dict log_data)
     {
 #ifdef ENABLE_MPI
-    if (m_sysdef->isDomainDecomposed())
+    if (m_sysdef->isDomainDecomposed() && m_parallel_write)
+        {
+        if (m_exec_conf->isRoot())
+            {
+            writeFrameHeader(frame);
+            }
+        writeParticleChunksParallel(frame);
+        if (m_exec_conf->isRoot())
+            {
+            writeLogQuantities(log_data);
+            }
+        }
+    else if (m_sysdef->isDomainDecomposed())
         {
         gatherGlobalFrame(frame);
 
@@ -396,8 +480,22 @@ void GSDDumpWriter::write(GSDDumpWriter::GSDFrame& frame, pybind11::dict log_dat
         writeMomenta(frame);
         writeLogQuantities(log_data);
         }
-    // topology is only meaningful if this is the all group
-    if (m_group->getNumMembersGlobal() == m_pdata->getNGlobal()
+    if (!m_streams.empty() && m_exec_conf->isRoot())
+        {
+        m_exec_conf->msg->notice(10) << "GSD: writing log/hoomd/write/GSD/stream" << endl;
+        uint32_t stream = frame.stream;
+        int retval = gsd_write_chunk(&m_handle,
+                                     "log/hoomd/write/GSD/stream",
+                                     GSD_TYPE_UINT32,
+                                     1,
+                                     1,
+                                     0,
+                                     (void*)&stream);
+        GSDUtils::checkError(retval, m_fname);
+        }
+
+    // topology is only meaningful if this is the all group, frames of streams never include it
+    if (frame.stream == 0 && frame.N == m_pdata->getNGlobal()
         && (m_write_topology || m_nframes == 0))
         {
         if (m_exec_conf->isRoot())
@@ -476,7 +574,7 @@ void GSDDumpWriter::writeFrameHeader(const GSDDumpWriter::GSDFrame& frame)
         GSDUtils::checkError(retval, m_fname);
         }
 
-    if (m_nframes == 0 || m_dynamic[gsd_flag::configuration_box])
+    if (m_nframes == 0 || frame.dynamic[gsd_flag::configuration_box])
         {
         m_exec_conf->msg->notice(10) << "GSD: writing configuration/box" << endl;
         float box_a[6];
@@ -496,10 +594,10 @@ void GSDDumpWriter::writeFrameHeader(const GSDDumpWriter::GSDFrame& frame)
         GSDUtils::checkError(retval, m_fname);
         }
 
-    if (m_nframes == 0 || m_dynamic[gsd_flag::particles_N])
+    if (m_nframes == 0 || frame.dynamic[gsd_flag::particles_N])
         {
         m_exec_conf->msg->notice(10) << "GSD: writing particles/N" << endl;
-        uint32_t N = m_group->getNumMembersGlobal();
+        uint32_t N = frame.N;
         retval = gsd_write_chunk(&m_handle, "particles/N", GSD_TYPE_UINT32, 1, 1, 0, (void*)&N);
         GSDUtils::checkError(retval, m_fname);
         }
@@ -510,10 +608,10 @@ void GSDDumpWriter::writeFrameHeader(const GSDDumpWriter::GSDFrame& frame)
 */
 void GSDDumpWriter::writeAttributes(const GSDDumpWriter::GSDFrame& frame)
     {
-    uint32_t N = m_group->getNumMembersGlobal();
+    uint32_t N = frame.N;
     int retval;
 
-    if (m_dynamic[gsd_flag::particles_types] || m_nframes == 0)
+    if (frame.dynamic[gsd_flag::particles_types] || m_nframes == 0)
         {
         writeTypeMapping("particles/types", frame.particle_data.type_mapping);
         }
@@ -628,7 +726,7 @@ void GSDDumpWriter::writeAttributes(const GSDDumpWriter::GSDFrame& frame)
  */
 void GSDDumpWriter::writeProperties(const GSDDumpWriter::GSDFrame& frame)
     {
-    uint32_t N = m_group->getNumMembersGlobal();
+    uint32_t N = frame.N;
     int retval;
 
     if (frame.particle_data.pos.size() != 0)
@@ -670,7 +768,7 @@ void GSDDumpWriter::writeProperties(const GSDDumpWriter::GSDFrame& frame)
  */
 void GSDDumpWriter::writeMomenta(const GSDDumpWriter::GSDFrame& frame)
     {
-    uint32_t N = m_group->getNumMembersGlobal();
+    uint32_t N = frame.N;
     int retval;
 
     if (frame.particle_data.vel.size() != 0)
@@ -1054,19 +1152,45 @@ void GSDDumpWriter::populateNonDefault()
     gsd_close(&m_handle);
     }
 
-void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t timestep)
+/*! \param frame Frame to populate
+    \param timestep Current time step of the simulation
+    \param group Particles to write
+    \param group_dynamic Fields to write when the frame is not frame 0
+    \param stream Index of the stream, 0 for the main stream
+
+    The group caches its sorted member tags between membership changes, so populating a frame
+    gathers the tags from the other ranks only after the filter selects new members.
+*/
+void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame,
+                                       uint64_t timestep,
+                                       std::shared_ptr<ParticleGroup> group,
+                                       const std::bitset<n_gsd_flags>& group_dynamic,
+                                       unsigned int stream)
     {
     frame.timestep = timestep;
     frame.global_box = m_pdata->getGlobalBox();
 
     frame.particle_data.type_mapping = m_pdata->getTypeMapping();
 
-    uint32_t N = m_group->getNumMembersGlobal();
+    uint32_t N = group->getNumMembersGlobal();
+
+    // collect the member tags of distributed groups before acquiring the particle data arrays
+    group->gatherMemberTags();
+
+    // Frame 0 and frames of groups other than the main group write all fields (see addStream).
+    std::bitset<n_gsd_flags> dynamic = group_dynamic;
+    if (m_nframes == 0 || group != m_group)
+        {
+        dynamic.set();
+        }
 
     // Assume values are all default to start, set flags to false when we find a non-default.
     std::bitset<n_gsd_flags> all_default;
     all_default.set();
     frame.clear();
+    frame.stream = stream;
+    frame.N = N;
+    frame.dynamic = dynamic;
 
     ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
 
@@ -1080,7 +1204,7 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
 
         for (unsigned int group_tag_index = 0; group_tag_index < N; group_tag_index++)
             {
-            unsigned int tag = m_group->getMemberTag(group_tag_index);
+            unsigned int tag = group->getMemberTag(group_tag_index);
             unsigned int index = h_rtag.data[tag];
             if (index >= m_pdata->getN())
                 {
@@ -1088,28 +1212,29 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
                 }
 
             frame.particle_tags.push_back(h_tag.data[index]);
+            frame.particle_group_index.push_back(group_tag_index);
             m_index.push_back(index);
             }
         }
 
     if (N > 0
-        && (m_dynamic[gsd_flag::particles_position] || m_dynamic[gsd_flag::particles_type]
-            || m_dynamic[gsd_flag::particles_image] || m_nframes == 0))
+        && (dynamic[gsd_flag::particles_position] || dynamic[gsd_flag::particles_type]
+            || dynamic[gsd_flag::particles_image]))
         {
         ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
                                        access_location::host,
                                        access_mode::read);
         ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::read);
 
-        if (m_dynamic[gsd_flag::particles_position] || m_nframes == 0)
+        if (dynamic[gsd_flag::particles_position])
             {
             frame.particle_data_present[gsd_flag::particles_position] = true;
             }
-        if (m_dynamic[gsd_flag::particles_image] || m_nframes == 0)
+        if (dynamic[gsd_flag::particles_image])
             {
             frame.particle_data_present[gsd_flag::particles_image] = true;
             }
-        if (m_dynamic[gsd_flag::particles_type] || m_nframes == 0)
+        if (dynamic[gsd_flag::particles_type])
             {
             frame.particle_data_present[gsd_flag::particles_type] = true;
             }
@@ -1121,14 +1246,14 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
             unsigned int type = __scalar_as_int(h_postype.data[index].w);
             int3 image = make_int3(0, 0, 0);
 
-            if (m_dynamic[gsd_flag::particles_image] || m_nframes == 0)
+            if (dynamic[gsd_flag::particles_image])
                 {
                 image = h_image.data[index];
                 }
 
             frame.global_box.wrap(position, image);
 
-            if (m_dynamic[gsd_flag::particles_position] || m_nframes == 0)
+            if (dynamic[gsd_flag::particles_position])
                 {
                 if (position != vec3<Scalar>(0, 0, 0))
                     {
@@ -1138,7 +1263,7 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
                 frame.particle_data.pos.push_back(vec3<float>(position));
                 }
 
-            if (m_dynamic[gsd_flag::particles_image] || m_nframes == 0)
+            if (dynamic[gsd_flag::particles_image])
                 {
                 if (image != make_int3(0, 0, 0))
                     {
@@ -1148,7 +1273,7 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
                 frame.particle_data.image.push_back(image);
                 }
 
-            if (m_dynamic[gsd_flag::particles_type] || m_nframes == 0)
+            if (dynamic[gsd_flag::particles_type])
                 {
                 if (type != 0)
                     {
@@ -1160,7 +1285,7 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
             }
         }
 
-    if (N > 0 && (m_dynamic[gsd_flag::particles_orientation] || m_nframes == 0))
+    if (N > 0 && dynamic[gsd_flag::particles_orientation])
         {
         ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
                                            access_location::host,
@@ -1180,19 +1305,17 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
             }
         }
 
-    if (N > 0
-        && (m_dynamic[gsd_flag::particles_velocity] || m_dynamic[gsd_flag::particles_mass]
-            || m_nframes == 0))
+    if (N > 0 && (dynamic[gsd_flag::particles_velocity] || dynamic[gsd_flag::particles_mass]))
         {
         ArrayHandle<Scalar4> h_velocity_mass(m_pdata->getVelocities(),
                                              access_location::host,
                                              access_mode::read);
 
-        if (m_dynamic[gsd_flag::particles_mass] || m_nframes == 0)
+        if (dynamic[gsd_flag::particles_mass])
             {
             frame.particle_data_present[gsd_flag::particles_mass] = true;
             }
-        if (m_dynamic[gsd_flag::particles_velocity] || m_nframes == 0)
+        if (dynamic[gsd_flag::particles_velocity])
             {
             frame.particle_data_present[gsd_flag::particles_velocity] = true;
             }
@@ -1204,7 +1327,7 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
                                                static_cast<float>(h_velocity_mass.data[index].z));
             float mass = static_cast<float>(h_velocity_mass.data[index].w);
 
-            if (m_dynamic[gsd_flag::particles_mass] || m_nframes == 0)
+            if (dynamic[gsd_flag::particles_mass])
                 {
                 if (mass != 1.0f)
                     {
@@ -1214,7 +1337,7 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
                 frame.particle_data.mass.push_back(mass);
                 }
 
-            if (m_dynamic[gsd_flag::particles_velocity] || m_nframes == 0)
+            if (dynamic[gsd_flag::particles_velocity])
                 {
                 if (velocity != vec3<float>(0, 0, 0))
                     {
@@ -1226,7 +1349,7 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
             }
         }
 
-    if (N > 0 && (m_dynamic[gsd_flag::particles_charge] || m_nframes == 0))
+    if (N > 0 && dynamic[gsd_flag::particles_charge])
         {
         ArrayHandle<Scalar> h_charge(m_pdata->getCharges(),
                                      access_location::host,
@@ -1246,7 +1369,7 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
             }
         }
 
-    if (N > 0 && (m_dynamic[gsd_flag::particles_diameter] || m_nframes == 0))
+    if (N > 0 && dynamic[gsd_flag::particles_diameter])
         {
         ArrayHandle<Scalar> h_diameter(m_pdata->getDiameters(),
                                        access_location::host,
@@ -1267,7 +1390,7 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
             }
         }
 
-    if (N > 0 && (m_dynamic[gsd_flag::particles_body] || m_nframes == 0))
+    if (N > 0 && dynamic[gsd_flag::particles_body])
         {
         ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
                                          access_location::host,
@@ -1288,7 +1411,7 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
             }
         }
 
-    if (N > 0 && (m_dynamic[gsd_flag::particles_inertia] || m_nframes == 0))
+    if (N > 0 && dynamic[gsd_flag::particles_inertia])
         {
         ArrayHandle<Scalar3> h_inertia(m_pdata->getMomentsOfInertiaArray(),
                                        access_location::host,
@@ -1309,7 +1432,7 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
             }
         }
 
-    if (N > 0 && (m_dynamic[gsd_flag::particles_angmom] || m_nframes == 0))
+    if (N > 0 && dynamic[gsd_flag::particles_angmom])
         {
         ArrayHandle<Scalar4> h_angmom(m_pdata->getAngularMomentumArray(),
                                       access_location::host,
@@ -1430,14 +1553,13 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
         frame.particle_data_present[gsd_flag::particles_image] = false;
         }
 
-    // capture topology data
-    if (m_group->getNumMembersGlobal() != m_pdata->getNGlobal() && m_write_topology)
+    // capture topology data, only frames of the main stream write topology
+    if (stream == 0 && N != m_pdata->getNGlobal() && m_write_topology)
         {
         throw std::runtime_error("Cannot write topology for a portion of the system");
         }
 
-    if (m_group->getNumMembersGlobal() == m_pdata->getNGlobal()
-        && (m_write_topology || m_nframes == 0))
+    if (stream == 0 && N == m_pdata->getNGlobal() && (m_write_topology || m_nframes == 0))
         {
         m_sysdef->getBondData()->takeSnapshot(frame.bond_data);
         m_sysdef->getAngleData()->takeSnapshot(frame.angle_data);
@@ -1459,6 +1581,9 @@ void GSDDumpWriter::gatherGlobalFrame(const GSDFrame& local_frame)
 
     m_global_frame.timestep = local_frame.timestep;
     m_global_frame.global_box = local_frame.global_box;
+    m_global_frame.stream = local_frame.stream;
+    m_global_frame.N = local_frame.N;
+    m_global_frame.dynamic = local_frame.dynamic;
     m_global_frame.particle_data.type_mapping = local_frame.particle_data.type_mapping;
     m_global_frame.particle_data_present = local_frame.particle_data_present;
 
@@ -1522,6 +1647,179 @@ void GSDDumpWriter::gatherGlobalFrame(const GSDFrame& local_frame)
         }
     }
 
+/*! \param local_frame Local frame with the particles owned by this rank in ascending tag order
+
+    Instead of gathering the frame on the root rank, the root reserves space for each
+    per-particle chunk at the end of the file and broadcasts the chunk locations. Row i of a chunk
+    stores group member i, so each rank knows where its particles go from their group indices.
+    The ranks describe their (generally scattered) rows with an MPI file view and write them with
+    a collective MPI_File_write_all, which lets the MPI-IO layer aggregate the writes on a subset
+    of ranks (two-phase I/O). The data is synced to disk before the root rank writes the frame
+    index, so readers never see an index entry that points to unwritten data.
+*/
+void GSDDumpWriter::writeParticleChunksParallel(const GSDFrame& local_frame)
+    {
+    struct ParallelChunk
+        {
+        const char* name;
+        gsd_type type;
+        uint32_t M;
+        unsigned int flag;
+        const void* data;
+        };
+
+    const SnapshotParticleData<float>& pdata = local_frame.particle_data;
+    std::vector<ParallelChunk> chunks
+        = {{"particles/typeid", GSD_TYPE_UINT32, 1, gsd_flag::particles_type, pdata.type.data()},
+           {"particles/mass", GSD_TYPE_FLOAT, 1, gsd_flag::particles_mass, pdata.mass.data()},
+           {"particles/charge", GSD_TYPE_FLOAT, 1, gsd_flag::particles_charge, pdata.charge.data()},
+           {"particles/body", GSD_TYPE_INT32, 1, gsd_flag::particles_body, pdata.body.data()},
+           {"particles/moment_inertia",
+            GSD_TYPE_FLOAT,
+            3,
+            gsd_flag::particles_inertia,
+            pdata.inertia.data()},
+           {"particles/position", GSD_TYPE_FLOAT, 3, gsd_flag::particles_position, pdata.pos.data()},
+           {"particles/orientation",
+            GSD_TYPE_FLOAT,
+            4,
+            gsd_flag::particles_orientation,
+            pdata.orientation.data()},
+           {"particles/velocity", GSD_TYPE_FLOAT, 3, gsd_flag::particles_velocity, pdata.vel.data()},
+           {"particles/angmom", GSD_TYPE_FLOAT, 4, gsd_flag::particles_angmom, pdata.angmom.data()},
+           {"particles/image", GSD_TYPE_INT32, 3, gsd_flag::particles_image, pdata.image.data()}};
+
+    if (m_write_diameter)
+        {
+        chunks.push_back(ParallelChunk {"particles/diameter",
+                                        GSD_TYPE_FLOAT,
+                                        1,
+                                        gsd_flag::particles_diameter,
+                                        pdata.diameter.data()});
+        }
+
+    MPI_Comm mpi_comm = m_exec_conf->getMPICommunicator();
+    const uint64_t N = local_frame.N;
+
+    auto check_mpi_error = [this](int retval)
+    {
+        if (retval != MPI_SUCCESS)
+            {
+            char message[MPI_MAX_ERROR_STRING];
+            int length = 0;
+            MPI_Error_string(retval, message, &length);
+            throw std::runtime_error("GSD: MPI-IO error writing " + m_fname + ": "
+                                     + std::string(message, length));
+            }
+    };
+
+    // the root rank reserves the chunks in the file
+    std::vector<uint64_t> locations(chunks.size(), 0);
+    if (m_exec_conf->isRoot())
+        {
+        if (local_frame.dynamic[gsd_flag::particles_types] || m_nframes == 0)
+            {
+            writeTypeMapping("particles/types", pdata.type_mapping);
+            }
+
+        for (size_t c = 0; c < chunks.size(); c++)
+            {
+            if (N == 0 || !local_frame.particle_data_present[chunks[c].flag])
+                continue;
+
+            m_exec_conf->msg->notice(10) << "GSD: reserving " << chunks[c].name << endl;
+            int retval = gsd_reserve_chunk(&m_handle,
+                                           chunks[c].name,
+                                           chunks[c].type,
+                                           N,
+                                           chunks[c].M,
+                                           0,
+                                           &locations[c]);
+            GSDUtils::checkError(retval, m_fname);
+            }
+        }
+    bcast(locations, 0, mpi_comm);
+
+    if (m_mpi_file == MPI_FILE_NULL)
+        {
+        MPI_Info info;
+        MPI_Info_create(&info);
+        MPI_Info_set(info, "romio_cb_write", "enable");
+        int retval = MPI_File_open(mpi_comm, m_fname.c_str(), MPI_MODE_WRONLY, info, &m_mpi_file);
+        MPI_Info_free(&info);
+        check_mpi_error(retval);
+        }
+
+    // coalesce consecutive group indices into blocks of rows
+    std::vector<int> block_rows;
+    std::vector<uint64_t> block_first_row;
+    for (unsigned int group_index : local_frame.particle_group_index)
+        {
+        if (!block_rows.empty() && block_first_row.back() + block_rows.back() == group_index)
+            {
+            block_rows.back()++;
+            }
+        else
+            {
+            block_first_row.push_back(group_index);
+            block_rows.push_back(1);
+            }
+        }
+
+    const int n_local = static_cast<int>(local_frame.particle_group_index.size());
+    std::vector<MPI_Aint> block_displacements(block_rows.size());
+
+    for (size_t c = 0; c < chunks.size(); c++)
+        {
+        if (N == 0 || !local_frame.particle_data_present[chunks[c].flag])
+            continue;
+
+        const int row_size = static_cast<int>(chunks[c].M * gsd_sizeof_type(chunks[c].type));
+        for (size_t b = 0; b < block_rows.size(); b++)
+            {
+            block_displacements[b] = static_cast<MPI_Aint>(block_first_row[b] * row_size);
+            }
+
+        MPI_Datatype row_type, file_type;
+        MPI_Type_contiguous(row_size, MPI_BYTE, &row_type);
+        MPI_Type_create_hindexed(static_cast<int>(block_rows.size()),
+                                 block_rows.data(),
+                                 block_displacements.data(),
+                                 row_type,
+                                 &file_type);
+        MPI_Type_commit(&file_type);
+
+        m_exec_conf->msg->notice(10) << "GSD: writing " << chunks[c].name << " with MPI-IO" << endl;
+        int retval = MPI_File_set_view(m_mpi_file,
+                                       static_cast<MPI_Offset>(locations[c]),
+                                       MPI_BYTE,
+                                       file_type,
+                                       "native",
+                                       MPI_INFO_NULL);
+        if (retval == MPI_SUCCESS)
+            {
+            retval = MPI_File_write_all(m_mpi_file,
+                                        chunks[c].data,
+                                        n_local,
+                                        row_type,
+                                        MPI_STATUS_IGNORE);
+            }
+
+        MPI_Type_free(&file_type);
+        MPI_Type_free(&row_type);
+        check_mpi_error(retval);
+
+        if (m_nframes == 0)
+            {
+            m_nondefault[chunks[c].name] = true;
+            }
+        }
+
+    // make the data durable before the root rank writes the index
+    check_mpi_error(MPI_File_sync(m_mpi_file));
+    MPI_Barrier(mpi_comm);
+    }
+
 #endif
 
 namespace detail
@@ -1551,7 +1849,12 @@ void export_GSDDumpWriter(pybind11::module& m)
         .def("flush", &GSDDumpWriter::flush)
         .def_property("maximum_write_buffer_size",
                       &GSDDumpWriter::getMaximumWriteBufferSize,
-                      &GSDDumpWriter::setMaximumWriteBufferSize);
+                      &GSDDumpWriter::setMaximumWriteBufferSize)
+        .def_property("parallel_write",
+                      &GSDDumpWriter::getParallelWrite,
+                      &GSDDumpWriter::setParallelWrite)
+        .def_property("trigger", &GSDDumpWriter::getMainTrigger, &GSDDumpWriter::setMainTrigger)
+        .def("addStream", &GSDDumpWriter::addStream);
     }
 
     } // end namespace detail
@@ -10,6 +10,7 @@
 #include "hoomd/extern/gsd.h"
 #include <memory>
 #include <string>
+#include <vector>
 
 /*! \file GSDDumpWriter.h
     \brief Declares the GSDDumpWriter class
@@ -30,6 +31,10 @@ namespace hoomd
 
     The file is not opened until the first call to analyze().
 
+    Sub-streams write additional frames to the same file, each with its own trigger, group, and
+    dynamic fields (see addStream()). The analyzer triggers when any stream does, and each call to
+    analyze() writes one frame for every stream that triggers on that timestep.
+
     \ingroup analyzers
 */
 class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
@@ -73,6 +78,24 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
 
     void setDynamic(pybind11::object dynamic);
 
+    /// Get the trigger of the main stream
+    std::shared_ptr<Trigger> getMainTrigger()
+        {
+        return m_main_trigger;
+        }
+
+    /// Set the trigger of the main stream
+    void setMainTrigger(std::shared_ptr<Trigger> trigger)
+        {
+        m_main_trigger = trigger;
+        updateTrigger();
+        }
+
+    /// Add a sub-stream
+    void addStream(std::shared_ptr<Trigger> trigger,
+                   std::shared_ptr<ParticleGroup> group,
+                   pybind11::object dynamic);
+
     //! Destructor
     virtual ~GSDDumpWriter();
 
@@ -128,6 +151,18 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     /// Get the maximum write buffer size (in bytes)
     uint64_t getMaximumWriteBufferSize();
 
+    /// Get whether ranks write their particles directly to the file with MPI-IO
+    bool getParallelWrite()
+        {
+        return m_parallel_write;
+        }
+
+    /// Set whether ranks write their particles directly to the file with MPI-IO
+    void setParallelWrite(bool parallel_write)
+        {
+        m_parallel_write = parallel_write;
+        }
+
     protected:
     gsd_handle m_handle; //!< Handle to the file
 
@@ -172,8 +207,20 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
         uint64_t timestep;
         BoxDim global_box;
 
+        /// Index of the stream that wrote the frame (0 is the main stream)
+        unsigned int stream = 0;
+
+        /// Number of particles in the frame over all ranks
+        uint32_t N = 0;
+
+        /// Bit flags indicating which fields the frame writes (index by gsd_flag)
+        std::bitset<n_gsd_flags> dynamic;
+
         std::vector<unsigned int> particle_tags;
 
+        /// Index of each particle in the group, which is its row in the per-particle chunks
+        std::vector<unsigned int> particle_group_index;
+
         SnapshotParticleData<float> particle_data;
         BondData::Snapshot bond_data;
         AngleData::Snapshot angle_data;
@@ -188,6 +235,7 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
         void clear()
             {
             particle_tags.resize(0);
+            particle_group_index.resize(0);
             particle_data.resize(0);
             bond_data.resize(0);
             angle_data.resize(0);
@@ -216,7 +264,17 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     void populateNonDefault();
 
     /// Populate local frame with data.
-    void populateLocalFrame(GSDFrame& frame, uint64_t timestep);
+    void populateLocalFrame(GSDFrame& frame, uint64_t timestep)
+        {
+        populateLocalFrame(frame, timestep, m_group, m_dynamic, 0);
+        }
+
+    /// Populate local frame with the data of the given group.
+    void populateLocalFrame(GSDFrame& frame,
+                            uint64_t timestep,
+                            std::shared_ptr<ParticleGroup> group,
+                            const std::bitset<n_gsd_flags>& dynamic,
+                            unsigned int stream);
 
 #ifdef ENABLE_MPI
     /// Copy of the state properties on all ranks, in ascending tag order globally.
@@ -224,6 +282,12 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     GatherTagOrder m_gather_tag_order;
 
     void gatherGlobalFrame(const GSDFrame& local_frame);
+
+    /// File handle for parallel writes
+    MPI_File m_mpi_file = MPI_FILE_NULL;
+
+    /// Write the per-particle chunks of the local frames collectively with MPI-IO
+    void writeParticleChunksParallel(const GSDFrame& local_frame);
 #endif
 
     private:
@@ -232,10 +296,31 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     bool m_truncate = false;       //!< True if we should truncate the file on every analyze()
     bool m_write_topology = false; //!< True if topology should be written
     bool m_write_diameter = false; //!< True if the diameter attribute should be written
+    bool m_parallel_write = false; //!< True when ranks write particle data with MPI-IO
 
     /// Flags indicating which particle fields are dynamic.
     std::bitset<n_gsd_flags> m_dynamic;
 
+    /// Trigger of the main stream
+    std::shared_ptr<Trigger> m_main_trigger;
+
+    /// A sub-stream of frames
+    struct Stream
+        {
+        std::shared_ptr<Trigger> trigger;     //!< Timesteps to write
+        std::shared_ptr<ParticleGroup> group; //!< Particles to write
+        std::bitset<n_gsd_flags> dynamic;     //!< Fields to write in every frame
+        };
+
+    /// Sub-streams in the order they were added
+    std::vector<Stream> m_streams;
+
+    //! Convert a list of dynamic field names and categories to flags
+    static std::bitset<n_gsd_flags> parseDynamic(pybind11::object dynamic);
+
+    //! Trigger the analyzer when any stream triggers
+    void updateTrigger();
+
     /// Number of frames written to the file.
     uint64_t m_nframes = 0;
 
@@ -6,9 +6,14 @@
 #include "GSD.h"
 #include "SnapshotSystemData.h"
 #include "hoomd/extern/gsd.h"
+#include <algorithm>
 #include <sstream>
 #include <string.h>
 
+#ifdef ENABLE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
 #include <stdexcept>
 using namespace std;
 using namespace hoomd::detail;
@@ -19,24 +24,38 @@ namespace hoomd
     \param name File name to read
     \param frame Frame index to read from the file
     \param from_end Count frames back from the end of the file
+    \param distributed Set to true to read the particles on all ranks
 
     The GSDReader constructor opens the GSD file, initializes an empty snapshot, and reads the file
    into memory (on the root rank).
+
+    When \a distributed is true, all ranks open the file. Rank r reads the particles with tags in
+    [N*r/n_ranks, N*(r+1)/n_ranks) into getLocalParticles(), and the root rank reads the topology.
+    The file must be visible to all ranks. Distributed mode has no effect on a single rank.
 */
 GSDReader::GSDReader(std::shared_ptr<const ExecutionConfiguration> exec_conf,
                      const std::string& name,
                      const uint64_t frame,
-                     bool from_end)
-    : m_exec_conf(exec_conf), m_timestep(0), m_name(name), m_frame(frame)
+                     bool from_end,
+                     bool distributed)
+    : m_exec_conf(exec_conf), m_timestep(0), m_name(name), m_frame(frame),
+      m_distributed(distributed), m_n_global(0), m_first_tag(0)
     {
     m_snapshot = std::shared_ptr<SnapshotSystemData<float>>(new SnapshotSystemData<float>);
 
 #ifdef ENABLE_MPI
+    if (m_exec_conf->getNRanks() == 1)
+        {
+        m_distributed = false;
+        }
+
     // if we are not the root processor, do not perform file I/O
-    if (!m_exec_conf->isRoot())
+    if (!m_exec_conf->isRoot() && !m_distributed)
         {
         return;
         }
+#else
+    m_distributed = false;
 #endif
 
     // open the GSD file in read mode
@@ -73,15 +92,26 @@ GSDReader::GSDReader(std::shared_ptr<const ExecutionConfiguration> exec_conf,
         }
 
     readHeader();
-    readParticles();
-    readTopology();
+    if (m_distributed)
+        {
+        readParticlesDistributed();
+        }
+    else
+        {
+        readParticles();
+        }
+
+    if (m_exec_conf->isRoot())
+        {
+        readTopology();
+        }
     }
 
 GSDReader::~GSDReader()
     {
 #ifdef ENABLE_MPI
     // if we are not the root processor, do not perform file I/O
-    if (!m_exec_conf->isRoot())
+    if (!m_exec_conf->isRoot() && !m_distributed)
         {
         return;
         }
@@ -130,13 +160,120 @@ bool GSDReader::readChunk(void* data,
               << actual_size << ".";
             throw runtime_error(s.str());
             }
-        int retval = gsd_read_chunk(&m_handle, data, entry);
-        GSDUtils::checkError(retval, m_name);
+        copyChunkRows(data, entry, 0, entry->N);
+
+        return true;
+        }
+    }
+
+/*! \param data Pointer to data to read into
+    \param frame Frame index to read from
+    \param name Name of the data chunk
+    \param row_size Expected size of one row of the data chunk in bytes.
+    \param first_row Index of the first row to read
+    \param n_rows Number of rows to read
+    \param cur_n N in the current frame.
+
+    Same as readChunk(), but reads only the rows [first_row, first_row + n_rows) of the chunk.
+
+    Return true if data is actually read from the file.
+*/
+bool GSDReader::readChunkRows(void* data,
+                              uint64_t frame,
+                              const char* name,
+                              size_t row_size,
+                              uint64_t first_row,
+                              uint64_t n_rows,
+                              unsigned int cur_n)
+    {
+    const struct gsd_index_entry* entry = gsd_find_chunk(&m_handle, frame, name);
+    if (entry == NULL && frame != 0)
+        entry = gsd_find_chunk(&m_handle, 0, name);
+
+    if (entry == NULL || entry->N != cur_n)
+        {
+        m_exec_conf->msg->notice(10) << "data.gsd_snapshot: chunk not found " << name << endl;
+        return false;
+        }
+    else
+        {
+        m_exec_conf->msg->notice(7) << "data.gsd_snapshot: reading rows of chunk " << name << endl;
+        size_t actual_size = entry->M * gsd_sizeof_type((enum gsd_type)entry->type);
+        if (actual_size != row_size)
+            {
+            std::ostringstream s;
+            s << "Expecting " << row_size << " bytes per row in " << name << " but found "
+              << actual_size << ".";
+            throw runtime_error(s.str());
+            }
+        copyChunkRows(data, entry, first_row, n_rows);
 
         return true;
         }
     }
 
+/*! \param data Pointer to data to copy into
+    \param entry Chunk to read
+    \param first_row Index of the first row to copy
+    \param n_rows Number of rows to copy
+
+    Small ranges are read with a single call to gsd_read_chunk_rows(). Larger ranges are mapped into
+    memory and copied to \a data in blocks. When TBB is enabled, the blocks are copied in parallel,
+    so that the page faults and the copies of one chunk proceed concurrently. The mapping is
+    released before returning, so reading a chunk never holds more than the destination buffer in
+    private memory.
+*/
+void GSDReader::copyChunkRows(void* data,
+                              const gsd_index_entry* entry,
+                              uint64_t first_row,
+                              uint64_t n_rows)
+    {
+    const size_t block_size = size_t(1) << 22;
+    const size_t row_size = entry->M * gsd_sizeof_type((enum gsd_type)entry->type);
+    if (n_rows * row_size <= block_size)
+        {
+        int retval = gsd_read_chunk_rows(&m_handle, data, entry, first_row, n_rows);
+        GSDUtils::checkError(retval, m_name);
+        return;
+        }
+
+    gsd_chunk_view view;
+    int retval = gsd_map_chunk_rows(&m_handle, &view, entry, first_row, n_rows);
+    GSDUtils::checkError(retval, m_name);
+
+    const char* src = static_cast<const char*>(view.data);
+    char* dst = static_cast<char*>(data);
+    const size_t n_blocks = (view.size + block_size - 1) / block_size;
+
+    auto copy_block = [&](size_t block)
+    {
+        const size_t begin = block * block_size;
+        const size_t end = std::min(view.size, begin + block_size);
+        memcpy(dst + begin, src + begin, end - begin);
+    };
+
+#ifdef ENABLE_TBB
+    if (n_blocks > 1)
+        {
+        m_exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                tbb::parallel_for(size_t(0), n_blocks, copy_block);
+            });
+        }
+    else
+#endif
+        {
+        for (size_t block = 0; block < n_blocks; block++)
+            {
+            copy_block(block);
+            }
+        }
+
+    retval = gsd_unmap_chunk(&view);
+    GSDUtils::checkError(retval, m_name);
+    }
+
 /*! \param frame Frame index to read from
     \param name Name of the data chunk
 
@@ -210,7 +347,13 @@ void GSDReader::readHeader()
         s << "Cannot read a file with 0 particles.";
         throw runtime_error(s.str());
         }
-    m_snapshot->particle_data.resize(N);
+    m_n_global = N;
+
+    // in distributed mode, each rank allocates only its own block in readParticlesDistributed()
+    if (!m_distributed)
+        {
+        m_snapshot->particle_data.resize(N);
+        }
     }
 
 /*! Read the same data chunks for particles
@@ -243,6 +386,40 @@ void GSDReader::readParticles()
     readChunk(m_snapshot->particle_data.image.data(), m_frame, "particles/image", N * 12, N);
     }
 
+/*! Read the same data chunks as readParticles(), but only the block of particles assigned to this
+    rank.
+ */
+void GSDReader::readParticlesDistributed()
+    {
+    const uint64_t N = m_n_global;
+    const uint64_t rank = m_exec_conf->getRank();
+    const uint64_t n_ranks = m_exec_conf->getNRanks();
+    const uint64_t first = N * rank / n_ranks;
+    const uint64_t n = N * (rank + 1) / n_ranks - first;
+
+    m_first_tag = static_cast<unsigned int>(first);
+    m_local_particles = std::make_shared<SnapshotParticleData<float>>(static_cast<unsigned int>(n));
+    SnapshotParticleData<float>& local = *m_local_particles;
+
+    local.type_mapping = readTypes(m_frame, "particles/types");
+    m_snapshot->particle_data.type_mapping = local.type_mapping;
+
+    // the snapshot already has default values, if a chunk is not found, the value
+    // is already at the default, and the failed read is not a problem
+    const unsigned int cur_n = m_n_global;
+    readChunkRows(local.type.data(), m_frame, "particles/typeid", 4, first, n, cur_n);
+    readChunkRows(local.mass.data(), m_frame, "particles/mass", 4, first, n, cur_n);
+    readChunkRows(local.charge.data(), m_frame, "particles/charge", 4, first, n, cur_n);
+    readChunkRows(local.diameter.data(), m_frame, "particles/diameter", 4, first, n, cur_n);
+    readChunkRows(local.body.data(), m_frame, "particles/body", 4, first, n, cur_n);
+    readChunkRows(local.inertia.data(), m_frame, "particles/moment_inertia", 12, first, n, cur_n);
+    readChunkRows(local.pos.data(), m_frame, "particles/position", 12, first, n, cur_n);
+    readChunkRows(local.orientation.data(), m_frame, "particles/orientation", 16, first, n, cur_n);
+    readChunkRows(local.vel.data(), m_frame, "particles/velocity", 12, first, n, cur_n);
+    readChunkRows(local.angmom.data(), m_frame, "particles/angmom", 16, first, n, cur_n);
+    readChunkRows(local.image.data(), m_frame, "particles/image", 12, first, n, cur_n);
+    }
+
 /*! Read the same data chunks for topology
  */
 void GSDReader::readTopology()
@@ -327,6 +504,37 @@ pybind11::list GSDReader::readTypeShapesPy(uint64_t frame)
     return type_shapes;
     }
 
+/*! \param name Name of the chunk
+    \returns The contents of the chunk up to the first null byte, or an empty string when the
+             selected frame has no such chunk.
+
+    Ranks that did not open the file return an empty string.
+*/
+std::string GSDReader::readString(const std::string& name)
+    {
+#ifdef ENABLE_MPI
+    if (!m_exec_conf->isRoot() && !m_distributed)
+        {
+        return std::string();
+        }
+#endif
+
+    m_exec_conf->msg->notice(7) << "data.gsd_snapshot: reading chunk " << name << endl;
+
+    const struct gsd_index_entry* entry = gsd_find_chunk(&m_handle, m_frame, name.c_str());
+    if (entry == NULL)
+        {
+        return std::string();
+        }
+
+    size_t actual_size = entry->N * entry->M * gsd_sizeof_type((enum gsd_type)entry->type);
+    std::vector<char> data(actual_size);
+    int retval = gsd_read_chunk(&m_handle, data.data(), entry);
+    GSDUtils::checkError(retval, m_name);
+
+    return std::string(data.data(), strnlen(data.data(), data.size()));
+    }
+
 namespace detail
     {
 void export_GSDReader(pybind11::module& m)
@@ -336,10 +544,19 @@ void export_GSDReader(pybind11::module& m)
                             const string&,
                             const uint64_t,
                             bool>())
+        .def(pybind11::init<std::shared_ptr<const ExecutionConfiguration>,
+                            const string&,
+                            const uint64_t,
+                            bool,
+                            bool>())
         .def("getTimeStep", &GSDReader::getTimeStep)
         .def("getSnapshot", &GSDReader::getSnapshot)
+        .def("getLocalParticles", &GSDReader::getLocalParticles)
+        .def("getFirstTag", &GSDReader::getFirstTag)
+        .def("isDistributed", &GSDReader::isDistributed)
         .def("clearSnapshot", &GSDReader::clearSnapshot)
-        .def("readTypeShapesPy", &GSDReader::readTypeShapesPy);
+        .def("readTypeShapesPy", &GSDReader::readTypeShapesPy)
+        .def("readString", &GSDReader::readString);
     }
 
     } // end namespace detail
@@ -25,6 +25,15 @@ template<class Real> struct SnapshotSystemData;
     file into the snapshot. For information on the GSD specification, see
    https://gsd.readthedocs.io/
 
+    By default, only the root rank reads the file. In distributed mode, every rank opens the file
+    and reads one contiguous block of the particles (getLocalParticles()), so that no rank holds
+    the whole system in memory. Pass the blocks to
+    ParticleData::initializeFromDistributedSnapshot(). The topology is still read on the root rank
+    and stored in getSnapshot().
+
+    Large chunks are memory mapped (gsd_map_chunk_rows()) and copied into the snapshot arrays in
+    blocks, in parallel when TBB is enabled. No intermediate buffer holds a copy of the chunk.
+
     \ingroup data_structs
 */
 class PYBIND11_EXPORT GSDReader
@@ -34,7 +43,8 @@ class PYBIND11_EXPORT GSDReader
     GSDReader(std::shared_ptr<const ExecutionConfiguration> exec_conf,
               const std::string& name,
               const uint64_t frame,
-              bool from_end);
+              bool from_end,
+              bool distributed = false);
 
     //! Destructor
     ~GSDReader();
@@ -59,6 +69,24 @@ class PYBIND11_EXPORT GSDReader
         return m_snapshot;
         }
 
+    //! Get the block of particles read by this rank in distributed mode
+    std::shared_ptr<SnapshotParticleData<float>> getLocalParticles() const
+        {
+        return m_local_particles;
+        }
+
+    //! Get the tag of the first particle in the local block
+    unsigned int getFirstTag() const
+        {
+        return m_first_tag;
+        }
+
+    //! Check whether the particles were read in distributed mode
+    bool isDistributed() const
+        {
+        return m_distributed;
+        }
+
     //! initializes a snapshot with the particle data
     uint64_t getFrame() const
         {
@@ -72,10 +100,20 @@ class PYBIND11_EXPORT GSDReader
                    size_t expected_size,
                    unsigned int cur_n = 0);
 
+    //! Helper function to read a range of rows of a per-particle quantity from the file
+    bool readChunkRows(void* data,
+                       uint64_t frame,
+                       const char* name,
+                       size_t row_size,
+                       uint64_t first_row,
+                       uint64_t n_rows,
+                       unsigned int cur_n);
+
     //! clears the snapshot object
     void clearSnapshot()
         {
         m_snapshot.reset();
+        m_local_particles.reset();
         }
 
     //! get handle
@@ -86,6 +124,9 @@ class PYBIND11_EXPORT GSDReader
 
     pybind11::list readTypeShapesPy(uint64_t frame);
 
+    //! Read a string chunk from the selected frame
+    std::string readString(const std::string& name);
+
     private:
     std::shared_ptr<const ExecutionConfiguration> m_exec_conf; //!< The execution configuration
     uint64_t m_timestep;                                       //!< Timestep at the selected frame
@@ -93,13 +134,24 @@ class PYBIND11_EXPORT GSDReader
     uint64_t m_frame;                                          //!< Cached frame
     std::shared_ptr<SnapshotSystemData<float>> m_snapshot;     //!< The snapshot to read
     gsd_handle m_handle;                                       //!< Handle to the file
+    bool m_distributed;                    //!< True when all ranks read a block of the particles
+    unsigned int m_n_global;               //!< Number of particles in the selected frame
+    unsigned int m_first_tag;              //!< Tag of the first particle in the local block
+    std::shared_ptr<SnapshotParticleData<float>> m_local_particles; //!< Local block of particles
 
     //! Helper function to read a type list from the file
     std::vector<std::string> readTypes(uint64_t frame, const char* name);
 
+    //! Helper function to copy rows of a chunk from the mapped file
+    void copyChunkRows(void* data,
+                       const gsd_index_entry* entry,
+                       uint64_t first_row,
+                       uint64_t n_rows);
+
     // helper functions to read sections of the file
     void readHeader();
     void readParticles();
+    void readParticlesDistributed();
     void readTopology();
     };
 
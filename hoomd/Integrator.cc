@@ -157,6 +157,27 @@ vec3<double> Integrator::computeLinearMomentum()
     return p_total;
     }
 
+/** @param timestep Current time step of the simulation
+    @returns The sum of the potential energies of all forces, reduced over all ranks.
+*/
+double Integrator::computeTotalPotentialEnergy(uint64_t timestep)
+    {
+    double energy = 0.0;
+    for (auto& force : m_forces)
+        {
+        force->compute(timestep);
+        energy += force->calcEnergySum();
+        }
+
+    for (auto& constraint_force : m_constraint_forces)
+        {
+        constraint_force->compute(timestep);
+        energy += constraint_force->calcEnergySum();
+        }
+
+    return energy;
+    }
+
 /** @param timestep Current time step of the simulation
     \post All added force computes in \a m_forces are computed and totaled up in \a m_net_force and
    \a m_net_virial \note The summation step is performed <b>on the CPU</b> and will result in a lot
@@ -937,7 +958,8 @@ void export_Integrator(pybind11::module& m)
         .def_property("dt", &Integrator::getDeltaT, &Integrator::setDeltaT)
         .def_property_readonly("forces", &Integrator::getForces)
         .def_property_readonly("constraints", &Integrator::getConstraintForces)
-        .def("computeLinearMomentum", &Integrator::computeLinearMomentum);
+        .def("computeLinearMomentum", &Integrator::computeLinearMomentum)
+        .def("computeTotalPotentialEnergy", &Integrator::computeTotalPotentialEnergy);
     }
 
     } // end namespace detail
@@ -133,6 +133,9 @@ class PYBIND11_EXPORT Integrator : public Updater
     /// Compute the linear momentum of the system
     virtual vec3<double> computeLinearMomentum();
 
+    /// Compute the total potential energy of the system
+    virtual double computeTotalPotentialEnergy(uint64_t timestep);
+
     /// Prepare for the run
     virtual void prepRun(uint64_t timestep);
 
@@ -32,10 +32,11 @@ LoadBalancer::LoadBalancer(std::shared_ptr<SystemDefinition> sysdef,
 #ifdef ENABLE_MPI
       m_mpi_comm(m_exec_conf->getMPICommunicator()),
 #endif
-      m_max_imbalance(Scalar(1.0)), m_recompute_max_imbalance(true), m_needs_migrate(false),
-      m_needs_recount(false), m_tolerance(Scalar(1.05)), m_maxiter(1), m_max_scale(Scalar(0.05)),
-      m_N_own(m_pdata->getN()), m_max_max_imbalance(1.0), m_total_max_imbalance(0.0), m_n_calls(0),
-      m_n_iterations(0), m_n_rebalances(0)
+      m_metric(Metric::particles), m_weight(Scalar(1.0)), m_load_own(Scalar(m_pdata->getN())),
+      m_total_load(Scalar(0.0)), m_max_imbalance(Scalar(1.0)), m_recompute_max_imbalance(true),
+      m_needs_migrate(false), m_needs_recount(false), m_tolerance(Scalar(1.05)), m_maxiter(1),
+      m_max_scale(Scalar(0.05)), m_N_own(m_pdata->getN()), m_max_max_imbalance(1.0),
+      m_total_max_imbalance(0.0), m_n_calls(0), m_n_iterations(0), m_n_rebalances(0)
     {
     m_exec_conf->msg->notice(5) << "Constructing LoadBalancer" << endl;
 
@@ -64,6 +65,50 @@ LoadBalancer::LoadBalancer(std::shared_ptr<SystemDefinition> sysdef,
 LoadBalancer::~LoadBalancer()
     {
     m_exec_conf->msg->notice(5) << "Destroying LoadBalancer" << endl;
+
+    if (m_metric == Metric::time)
+        {
+        m_exec_conf->getProfiler()->requestComputeTime(false);
+        }
+    }
+
+std::string LoadBalancer::getMetric() const
+    {
+    if (m_metric == Metric::time)
+        {
+        return "time";
+        }
+    return "particles";
+    }
+
+/*!
+ * \param metric Name of the metric: "particles" or "time"
+ *
+ * The time metric requests compute time measurements from the Profiler.
+ */
+void LoadBalancer::setMetric(const std::string& metric)
+    {
+    Metric new_metric;
+    if (metric == "particles")
+        {
+        new_metric = Metric::particles;
+        }
+    else if (metric == "time")
+        {
+        new_metric = Metric::time;
+        }
+    else
+        {
+        throw std::invalid_argument("Invalid load balancing metric: " + metric);
+        }
+
+    if (new_metric != m_metric)
+        {
+        Profiler* profiler = m_exec_conf->getProfiler();
+        profiler->requestComputeTime(new_metric == Metric::time);
+        profiler->resetComputeTime();
+        m_metric = new_metric;
+        }
     }
 
 /*!
@@ -81,9 +126,18 @@ void LoadBalancer::update(uint64_t timestep)
     if (!m_sysdef->isDomainDecomposed())
         return;
 
+    // weigh the particles by their measured cost
+    initializeWeights();
+
     // no adjustment has been made yet, so set m_N_own to the number of particles on the rank
     resetNOwn(m_pdata->getN());
 
+    if (m_decomposition->isRecursiveBisection())
+        {
+        updateBisection(timestep);
+        return;
+        }
+
     // figure out which rank is the reduction root for broadcasting
     const Index3D& di = m_decomposition->getDomainIndexer();
     unsigned int reduce_root(0);
@@ -139,17 +193,17 @@ void LoadBalancer::update(uint64_t timestep)
                 min_frac_i = min_domain_frac.z;
                 }
 
-            vector<unsigned int> N_i;
+            vector<Scalar> W_i;
             bool adjusted = false;
 
-            // reduce the number of particles in the slice along dim
-            bool active = reduce(N_i, dim, reduce_root);
+            // reduce the load in the slice along dim
+            bool active = reduce(W_i, dim, reduce_root);
 
             // attempt an adjustment
             vector<Scalar> cum_frac = m_decomposition->getCumulativeFractions(dim);
             if (active)
                 {
-                adjusted = adjust(cum_frac, N_i, L_i, min_frac_i);
+                adjusted = adjust(cum_frac, W_i, L_i, min_frac_i);
                 }
 
             // broadcast if an adjustment has been made on the root
@@ -167,9 +221,19 @@ void LoadBalancer::update(uint64_t timestep)
         // force a particle migration if one is needed
         if (m_needs_migrate)
             {
+            // the load that arrives with the migrated particles
+            const Scalar load_own = getLoadOwn();
+
             m_comm->forceMigrate();
             m_comm->communicate(timestep);
-            resetNOwn(m_pdata->getN());
+
+            // the particles now on this rank share the load equally
+            const unsigned int N = m_pdata->getN();
+            if (N > 0)
+                {
+                m_weight = load_own / Scalar(N);
+                }
+            resetNOwn(N);
             m_needs_migrate = false;
 
             // increment the number of rebalances actually performed
@@ -182,15 +246,100 @@ void LoadBalancer::update(uint64_t timestep)
 #ifdef ENABLE_MPI
 
 /*!
- * Computes the imbalance factor I = N / <N> for each rank, and computes the maximum among all
- * ranks.
+ * With Metric::time, the compute time measured since the last balancing step is spread evenly over
+ * the particles of the rank. Ranks fall back to unit weights until every rank has measured some
+ * time. All ranks must call this method.
+ */
+void LoadBalancer::initializeWeights()
+    {
+    const unsigned int N = m_pdata->getN();
+    m_weight = Scalar(1.0);
+
+    if (m_metric == Metric::time)
+        {
+        Profiler* profiler = m_exec_conf->getProfiler();
+        double time = profiler->getComputeTime();
+        profiler->resetComputeTime();
+
+        // particles on ranks that own none carry no measured cost
+        int measured = (time > 0.0 || N == 0) ? 1 : 0;
+        MPI_Allreduce(MPI_IN_PLACE, &measured, 1, MPI_INT, MPI_LAND, m_mpi_comm);
+        if (measured && N > 0)
+            {
+            m_weight = Scalar(time / double(N));
+            }
+        }
+
+    Scalar load = Scalar(N) * m_weight;
+    MPI_Allreduce(&load, &m_total_load, 1, MPI_HOOMD_SCALAR, MPI_SUM, m_mpi_comm);
+    }
+
+/*!
+ * \param timestep Current time step of the simulation
+ *
+ * Recursive bisection domains are not adjusted one cut at a time. When the imbalance exceeds the
+ * tolerance, the whole tree is recomputed from the weighted positions of all particles and the
+ * particles migrate to their new domains, which may belong to any rank. The tree keeps every domain
+ * wider than twice the ghost layer. The x, y, and z flags and max_scale do not apply.
+ */
+void LoadBalancer::updateBisection(uint64_t timestep)
+    {
+    m_total_max_imbalance += getMaxImbalance();
+    ++m_n_calls;
+
+    if (getMaxImbalance() <= m_tolerance)
+        {
+        return;
+        }
+    ++m_n_iterations;
+
+    const BoxDim& box = m_pdata->getGlobalBox();
+    const unsigned int N = m_pdata->getN();
+    std::vector<Scalar3> fractions(N);
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+        for (unsigned int i = 0; i < N; ++i)
+            {
+            Scalar3 pos = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+            int3 img = make_int3(0, 0, 0);
+            box.wrap(pos, img);
+            fractions[i] = box.makeFraction(pos);
+            }
+        }
+    const std::vector<Scalar> weights(N, m_weight);
+    const Scalar3 min_domain_frac
+        = Scalar(2.0) * m_comm->getGhostLayerMaxWidth() / box.getNearestPlaneDistance();
+
+    m_decomposition->computeRecursiveBisection(box, fractions, weights, min_domain_frac);
+    m_pdata->setGlobalBox(box); // force a domain resizing to trigger
+    signalResize();
+
+    m_comm->forceMigrate();
+    m_comm->communicate(timestep);
+
+    // every domain now holds close to the mean load
+    const unsigned int N_new = m_pdata->getN();
+    if (N_new > 0)
+        {
+        m_weight = m_total_load / Scalar(m_exec_conf->getNRanks()) / Scalar(N_new);
+        }
+    resetNOwn(N_new);
+    m_needs_migrate = false;
+    ++m_n_rebalances;
+    }
+
+/*!
+ * Computes the imbalance factor I = W / <W> of the load W for each rank, and computes the maximum
+ * among all ranks.
  */
 Scalar LoadBalancer::getMaxImbalance()
     {
     if (m_recompute_max_imbalance)
         {
-        Scalar cur_imb = Scalar(getNOwn())
-                         / (Scalar(m_pdata->getNGlobal()) / Scalar(m_exec_conf->getNRanks()));
+        const Scalar mean_load = m_total_load / Scalar(m_exec_conf->getNRanks());
+        Scalar cur_imb = mean_load > Scalar(0.0) ? getLoadOwn() / mean_load : Scalar(1.0);
         Scalar max_imb(0.0);
         MPI_Allreduce(&cur_imb, &max_imb, 1, MPI_HOOMD_SCALAR, MPI_MAX, m_mpi_comm);
 
@@ -205,37 +354,42 @@ Scalar LoadBalancer::getMaxImbalance()
     }
 
 /*!
- * \param N_i Vector holding the total number of particles in each slice (will be allocated on call)
+ * \param W_i Vector holding the total load in each slice (will be allocated on call)
  * \param dim The dimension of the slices (x=0, y=1, z=2)
  * \param reduce_root The rank to perform the reduction on
- * \returns true if the current rank holds the active \a N_i
+ * \returns true if the current rank holds the active \a W_i
  *
- * \post \a N_i holds the number of particles in each slice along \a dim
+ * \post \a W_i holds the load in each slice along \a dim
  *
  * \note reduce() relies on collective MPI calls, and so all ranks must call it. However, for
  * efficiency the data will be active only on Cartesian rank \a reduce_root, as indicated by the
- * return value. As a result, only \a reduce_root actually needs to allocate memory for \a N_i.
+ * return value. As a result, only \a reduce_root actually needs to allocate memory for \a W_i.
  *
  * The reduction is performed by performing an all-to-one gather, followed by summation on \a
  * reduce_root. This operation may be suboptimal for very large numbers of processors, and could be
  * replaced by cascading send operations down dimensions. Generally, load balancing should not be
  * performed too frequently, and so we do not pursue this optimization right now.
  */
-bool LoadBalancer::reduce(std::vector<unsigned int>& N_i,
-                          unsigned int dim,
-                          unsigned int reduce_root)
+bool LoadBalancer::reduce(std::vector<Scalar>& W_i, unsigned int dim, unsigned int reduce_root)
     {
     // do nothing if there is only one rank
-    if (N_i.size() == 1)
+    if (W_i.size() == 1)
         return false;
 
     const Index3D& di = m_decomposition->getDomainIndexer();
-    std::vector<unsigned int> N_per_rank(di.getNumElements());
+    std::vector<Scalar> W_per_rank(di.getNumElements());
 
-    // get the number of particles the current rank owns (the quantity to be reduced)
-    unsigned int N_own = getNOwn();
+    // get the load the current rank owns (the quantity to be reduced)
+    Scalar W_own = getLoadOwn();
 
-    MPI_Gather(&N_own, 1, MPI_UNSIGNED, &N_per_rank[0], 1, MPI_UNSIGNED, reduce_root, m_mpi_comm);
+    MPI_Gather(&W_own,
+               1,
+               MPI_HOOMD_SCALAR,
+               &W_per_rank[0],
+               1,
+               MPI_HOOMD_SCALAR,
+               reduce_root,
+               m_mpi_comm);
 
     // only the root rank performs the reduction
     if (m_exec_conf->getRank() != reduce_root)
@@ -245,57 +399,57 @@ bool LoadBalancer::reduce(std::vector<unsigned int>& N_i,
     ArrayHandle<unsigned int> h_cart_ranks_inv(m_decomposition->getInverseCartRanks(),
                                                access_location::host,
                                                access_mode::read);
-    std::vector<unsigned int> N_per_cart_rank(di.getNumElements());
+    std::vector<Scalar> W_per_cart_rank(di.getNumElements());
     for (unsigned int cur_rank = 0; cur_rank < di.getNumElements(); ++cur_rank)
         {
-        N_per_cart_rank[h_cart_ranks_inv.data[cur_rank]] = N_per_rank[cur_rank];
+        W_per_cart_rank[h_cart_ranks_inv.data[cur_rank]] = W_per_rank[cur_rank];
         }
 
     // perform the summation along dim in as cache friendly of a way as we can manage
     if (dim == 0) // to x
         {
-        N_i.clear();
-        N_i.resize(di.getW());
+        W_i.clear();
+        W_i.resize(di.getW());
         for (unsigned int i = 0; i < di.getW(); ++i)
             {
-            N_i[i] = 0;
+            W_i[i] = Scalar(0.0);
             for (unsigned int k = 0; k < di.getD(); ++k)
                 {
                 for (unsigned int j = 0; j < di.getH(); ++j)
                     {
-                    N_i[i] += N_per_cart_rank[di(i, j, k)];
+                    W_i[i] += W_per_cart_rank[di(i, j, k)];
                     }
                 }
             }
         }
     else if (dim == 1) // to y
         {
-        N_i.clear();
-        N_i.resize(di.getH());
+        W_i.clear();
+        W_i.resize(di.getH());
         for (unsigned int j = 0; j < di.getH(); ++j)
             {
-            N_i[j] = 0;
+            W_i[j] = Scalar(0.0);
             for (unsigned int k = 0; k < di.getD(); ++k)
                 {
                 for (unsigned int i = 0; i < di.getW(); ++i)
                     {
-                    N_i[j] += N_per_cart_rank[di(i, j, k)];
+                    W_i[j] += W_per_cart_rank[di(i, j, k)];
                     }
                 }
             }
         }
     else if (dim == 2) // to z
         {
-        N_i.clear();
-        N_i.resize(di.getD());
+        W_i.clear();
+        W_i.resize(di.getD());
         for (unsigned int k = 0; k < di.getD(); ++k)
             {
-            N_i[k] = 0;
+            W_i[k] = Scalar(0.0);
             for (unsigned int j = 0; j < di.getH(); ++j)
                 {
                 for (unsigned int i = 0; i < di.getW(); ++i)
                     {
-                    N_i[k] += N_per_cart_rank[di(i, j, k)];
+                    W_i[k] += W_per_cart_rank[di(i, j, k)];
                     }
                 }
             }
@@ -310,7 +464,7 @@ bool LoadBalancer::reduce(std::vector<unsigned int>& N_i,
 
 /*!
  * \param cum_frac_i The cumulative fraction array to write output into
- * \param N_i The reduced number of particles along the dimension
+ * \param W_i The reduced load along the dimension
  * \param L_i The global box length along the dimension
  * \param min_frac_i The minimum fractional width of a domain
  *
@@ -329,31 +483,31 @@ bool LoadBalancer::reduce(std::vector<unsigned int>& N_i,
  * minimization was successful, apply the adjustment to \a cum_frac_i.
  */
 bool LoadBalancer::adjust(vector<Scalar>& cum_frac_i,
-                          const vector<unsigned int>& N_i,
+                          const vector<Scalar>& W_i,
                           Scalar L_i,
                           Scalar min_frac_i)
     {
-    if (N_i.size() == 1)
+    if (W_i.size() == 1)
         return false;
 
-    // target particles per rank is uniform distribution
-    const Scalar target = Scalar(m_pdata->getNGlobal()) / Scalar(N_i.size());
+    // target load per slice is uniform distribution
+    const Scalar target = m_total_load / Scalar(W_i.size());
 
     // make the minimum domain slightly bigger so that the optimization won't fail at equality
     const Scalar min_domain_size = Scalar(1.00001) * min_frac_i * L_i;
     // if system is overconstrained (exactly decomposed) don't do any adjusting
-    if (min_domain_size * Scalar(N_i.size()) >= L_i)
+    if (min_domain_size * Scalar(W_i.size()) >= L_i)
         {
         return false;
         }
 
     // imbalance factors for each rank
-    vector<Scalar> new_widths(N_i.size());
-    for (unsigned int i = 0; i < N_i.size(); ++i)
+    vector<Scalar> new_widths(W_i.size());
+    for (unsigned int i = 0; i < W_i.size(); ++i)
         {
-        const Scalar imb_factor = Scalar(N_i[i]) / target;
+        const Scalar imb_factor = W_i[i] / target;
         Scalar scale_factor
-            = (N_i[i] > 0)
+            = (W_i[i] > Scalar(0.0))
                   ? Scalar(1.0) / imb_factor
                   : (Scalar(1.0)
                      + m_max_scale); // as in gromacs, use half the imbalance factor to scale
@@ -378,7 +532,7 @@ bool LoadBalancer::adjust(vector<Scalar>& cum_frac_i,
     // setup the augmented A matrix, with scale factor eps for the actual least squares part (to
     // enforce the inequality constraints correctly)
     const Scalar eps(0.001);
-    unsigned int m = (unsigned int)N_i.size();
+    unsigned int m = (unsigned int)W_i.size();
     unsigned int n = m - 1;
     Eigen::MatrixXd A = Eigen::MatrixXd::Zero(2 * m, n + m);
     A(0, 0) = 1.0;
@@ -564,12 +718,13 @@ void LoadBalancer::computeOwnedParticles()
         }
     countParticlesOffRank(cnts);
 
-    std::vector<MPI_Request> req(2 * m_comm->getNUniqueNeighbors());
-    std::vector<MPI_Status> stat(2 * m_comm->getNUniqueNeighbors());
+    std::vector<MPI_Request> req(4 * m_comm->getNUniqueNeighbors());
+    std::vector<MPI_Status> stat(4 * m_comm->getNUniqueNeighbors());
     unsigned int nreq = 0;
 
     std::vector<unsigned int> n_send_ptls(m_comm->getNUniqueNeighbors());
     std::vector<unsigned int> n_recv_ptls(m_comm->getNUniqueNeighbors());
+    std::vector<Scalar> recv_weight(m_comm->getNUniqueNeighbors());
     for (unsigned int cur_neigh = 0; cur_neigh < m_comm->getNUniqueNeighbors(); ++cur_neigh)
         {
         unsigned int neigh_rank = h_unique_neigh.data[cur_neigh];
@@ -589,19 +744,33 @@ void LoadBalancer::computeOwnedParticles()
                   0,
                   m_mpi_comm,
                   &req[nreq++]);
+
+        // the particles carry the cost weight of the sending rank
+        MPI_Isend(&m_weight, 1, MPI_HOOMD_SCALAR, neigh_rank, 1, m_mpi_comm, &req[nreq++]);
+        MPI_Irecv(&recv_weight[cur_neigh],
+                  1,
+                  MPI_HOOMD_SCALAR,
+                  neigh_rank,
+                  1,
+                  m_mpi_comm,
+                  &req[nreq++]);
         }
     MPI_Waitall(nreq, req.data(), stat.data());
 
     // reduce the particles sent to me
     int N_own = m_pdata->getN();
+    Scalar load_own = Scalar(m_pdata->getN()) * m_weight;
     for (unsigned int cur_neigh = 0; cur_neigh < m_comm->getNUniqueNeighbors(); ++cur_neigh)
         {
         N_own += n_recv_ptls[cur_neigh];
         N_own -= n_send_ptls[cur_neigh];
+        load_own += Scalar(n_recv_ptls[cur_neigh]) * recv_weight[cur_neigh];
+        load_own -= Scalar(n_send_ptls[cur_neigh]) * m_weight;
         }
 
     // set the count
     resetNOwn(N_own);
+    m_load_own = load_own;
     }
 
 #endif // ENABLE_MPI
@@ -628,7 +797,9 @@ void export_LoadBalancer(pybind11::module& m)
                       &LoadBalancer::setMaxIterations)
         .def_property("x", &LoadBalancer::getEnableX, &LoadBalancer::setEnableX)
         .def_property("y", &LoadBalancer::getEnableY, &LoadBalancer::setEnableY)
-        .def_property("z", &LoadBalancer::getEnableZ, &LoadBalancer::setEnableZ);
+        .def_property("z", &LoadBalancer::getEnableZ, &LoadBalancer::setEnableZ)
+        .def_property("metric", &LoadBalancer::getMetric, &LoadBalancer::setMetric)
+        .def_property_readonly("imbalance", &LoadBalancer::getImbalance);
     }
 
     } // end namespace detail
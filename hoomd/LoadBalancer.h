@@ -24,8 +24,11 @@ namespace hoomd
 //! Updates domain decompositions to balance the load
 /*!
  * Adjusts the boundaries of the processor domains to distribute the load close to evenly between
- * them. The load imbalance is defined as the number of particles owned by a rank divided by the
- * average number of particles per rank if the particles had a uniform distribution.
+ * them. The load imbalance is defined as the load owned by a rank divided by the average load per
+ * rank. With Metric::particles, the load is the number of particles. With Metric::time, each
+ * particle carries the cost weight of the rank that owns it: the compute time measured on that
+ * rank since the last balancing step divided by its number of particles. The weights follow the
+ * particles as the domain boundaries move.
  *
  * At each load balancing step, we attempt to rescale the domain size by the inverse of the load
  * balance, subject to the following constraints that are imposed to both maintain a stable
@@ -136,6 +139,28 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
         return m_enable_z;
         }
 
+    /// Quantities that measure the load of a rank
+    enum class Metric
+        {
+        /// Number of particles owned by the rank
+        particles,
+
+        /// Measured compute time (forces, neighbor lists, and Monte Carlo trial moves)
+        time
+        };
+
+    /// Get the name of the load metric
+    std::string getMetric() const;
+
+    /// Set the load metric by name
+    void setMetric(const std::string& metric);
+
+    /// Get the maximum load imbalance after the last balancing step
+    Scalar getImbalance() const
+        {
+        return m_max_imbalance;
+        }
+
     //! Take one timestep forward
     virtual void update(uint64_t timestep);
 
@@ -155,8 +180,14 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
     //! Computes the maximum imbalance factor
     Scalar getMaxImbalance();
 
-    //! Reduce the particle numbers per rank down to one dimension
-    bool reduce(std::vector<unsigned int>& N_i, unsigned int dim, unsigned int reduce_root);
+    //! Reduce the load per rank down to one dimension
+    bool reduce(std::vector<Scalar>& W_i, unsigned int dim, unsigned int reduce_root);
+
+    //! Determine the cost weight of the particles on this rank and the total load
+    void initializeWeights();
+
+    //! Recompute the recursive bisection domains from the particle loads
+    void updateBisection(uint64_t timestep);
 
     //! Set flags within the class that a resize has been performed
     void signalResize()
@@ -168,7 +199,7 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
 
     //! Adjust the partitioning along a single dimension
     bool adjust(std::vector<Scalar>& cum_frac_i,
-                const std::vector<unsigned int>& N_i,
+                const std::vector<Scalar>& W_i,
                 Scalar L_i,
                 Scalar min_domain_frac);
 
@@ -185,6 +216,13 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
         return m_N_own;
         }
 
+    //! Gets the load owned by the rank, updating if necessary
+    Scalar getLoadOwn()
+        {
+        computeOwnedParticles();
+        return m_load_own;
+        }
+
     //! Force a reset of the number of owned particles without counting
     /*!
      * \param N number of particles owned by the rank
@@ -192,11 +230,17 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
     void resetNOwn(unsigned int N)
         {
         m_N_own = N;
+        m_load_own = Scalar(N) * m_weight;
         m_recompute_max_imbalance = true;
         m_needs_recount = false;
         }
 #endif // ENABLE_MPI
 
+    Metric m_metric;     //!< Quantity that measures the load
+    Scalar m_weight;     //!< Cost weight of each particle owned by this rank
+    Scalar m_load_own;   //!< Load owned by this rank
+    Scalar m_total_load; //!< Total load of all ranks
+
     Scalar m_max_imbalance;         //!< Maximum imbalance
     bool m_recompute_max_imbalance; //!< Flag if maximum imbalance needs to be computed
 
@@ -82,6 +82,33 @@ unsigned int MPIConfiguration::getNRanks() const
 #endif
     }
 
+std::string MPIConfiguration::getExchangeSchemeName() const
+    {
+    if (m_exchange_scheme == ExchangeScheme::neighbor)
+        {
+        return "neighbor";
+        }
+    return "staged";
+    }
+
+/** @param name Name of the scheme: "staged" or "neighbor"
+ */
+void MPIConfiguration::setExchangeSchemeName(const std::string& name)
+    {
+    if (name == "staged")
+        {
+        m_exchange_scheme = ExchangeScheme::staged;
+        }
+    else if (name == "neighbor")
+        {
+        m_exchange_scheme = ExchangeScheme::neighbor;
+        }
+    else
+        {
+        throw std::invalid_argument("Invalid exchange scheme: " + name);
+        }
+    }
+
 namespace detail
     {
 void export_MPIConfiguration(pybind11::module& m)
@@ -99,6 +126,12 @@ void export_MPIConfiguration(pybind11::module& m)
         .def("getNRanksGlobal", &MPIConfiguration::getNRanksGlobal)
         .def("getRankGlobal", &MPIConfiguration::getRankGlobal)
         .def("getWalltime", &MPIConfiguration::getWalltime)
+        .def_property("exchange",
+                      &MPIConfiguration::getExchangeSchemeName,
+                      &MPIConfiguration::setExchangeSchemeName)
+        .def_property("shared_memory_ghosts",
+                      &MPIConfiguration::getSharedMemoryGhosts,
+                      &MPIConfiguration::setSharedMemoryGhosts)
 #ifdef ENABLE_MPI
         .def_static("_make_mpi_conf_mpi_comm",
                     [](pybind11::object mpi_comm) -> std::shared_ptr<MPIConfiguration>
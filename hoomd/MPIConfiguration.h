@@ -12,6 +12,8 @@
 
 #include "ClockSource.h"
 
+#include <string>
+
 /*! \file MPIConfiguration.h
     \brief Declares MPIConfiguration, which initializes the MPI environment
 */
@@ -139,6 +141,46 @@ class PYBIND11_EXPORT MPIConfiguration
         return walltime;
         }
 
+    /// Schemes that exchange particles between domains
+    enum class ExchangeScheme
+        {
+        /// Exchange with the 6 face neighbors in sequential passes and forward along the edges
+        staged,
+
+        /// Exchange with up to 26 neighbors in a single neighborhood collective
+        neighbor
+        };
+
+    /// Get the scheme that exchanges particles between domains
+    ExchangeScheme getExchangeScheme() const
+        {
+        return m_exchange_scheme;
+        }
+
+    /// Set the scheme that exchanges particles between domains
+    void setExchangeScheme(ExchangeScheme scheme)
+        {
+        m_exchange_scheme = scheme;
+        }
+
+    /// Get the name of the exchange scheme
+    std::string getExchangeSchemeName() const;
+
+    /// Set the exchange scheme by name
+    void setExchangeSchemeName(const std::string& name);
+
+    /// Get whether ranks on the same node share ghost updates through memory
+    bool getSharedMemoryGhosts() const
+        {
+        return m_shared_memory_ghosts;
+        }
+
+    /// Set whether ranks on the same node share ghost updates through memory
+    void setSharedMemoryGhosts(bool shared_memory_ghosts)
+        {
+        m_shared_memory_ghosts = shared_memory_ghosts;
+        }
+
     protected:
 #ifdef ENABLE_MPI
     MPI_Comm m_mpi_comm;    //!< The MPI communicator
@@ -149,6 +191,12 @@ class PYBIND11_EXPORT MPIConfiguration
 
     /// Clock to provide rank synchronized walltime.
     ClockSource m_clock;
+
+    /// Scheme that exchanges particles between domains
+    ExchangeScheme m_exchange_scheme = ExchangeScheme::staged;
+
+    /// True when ranks on the same node share ghost updates through memory
+    bool m_shared_memory_ghosts = false;
     };
 
 namespace detail
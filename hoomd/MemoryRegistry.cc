@@ -0,0 +1,226 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file MemoryRegistry.cc
+    \brief Defines the MemoryRegistry class
+*/
+
+#include "MemoryRegistry.h"
+
+#ifdef ENABLE_MPI
+#include "HOOMDMPI.h"
+#endif
+
+#include <cstdlib>
+#include <cxxabi.h>
+#include <stdexcept>
+
+namespace hoomd
+    {
+/** @param mpi_config MPI configuration used to reduce the usage over ranks
+ */
+MemoryRegistry::MemoryRegistry(std::shared_ptr<MPIConfiguration> mpi_config)
+    : m_mpi_config(mpi_config)
+    {
+    }
+
+/** @param owner The object
+    @param type Function that returns the dynamic type of the object
+    @param trim Function that frees the slack of the object's arrays (may be empty)
+*/
+void MemoryRegistry::addObject(const void* owner,
+                               std::function<const std::type_info&()> type,
+                               std::function<void()> trim)
+    {
+    for (const auto& object : m_objects)
+        {
+        if (object.owner == owner)
+            {
+            throw std::runtime_error("Object is already registered.");
+            }
+        }
+
+    Object object;
+    object.owner = owner;
+    object.type = type;
+    object.trim = trim;
+    m_objects.push_back(std::move(object));
+    }
+
+/** @param owner The object
+    @param allocated Function that returns the allocated bytes of an array
+    @param used Function that returns the bytes of the array that hold data
+*/
+void MemoryRegistry::addCounters(const void* owner, ByteCounter allocated, ByteCounter used)
+    {
+    Object& object = findObject(owner);
+    object.allocated.push_back(allocated);
+    object.used.push_back(used);
+    }
+
+/** @param owner The object
+
+    Does nothing when the object is not registered.
+*/
+void MemoryRegistry::removeObject(const void* owner)
+    {
+    m_objects.erase(std::remove_if(m_objects.begin(),
+                                   m_objects.end(),
+                                   [owner](const Object& object) { return object.owner == owner; }),
+                    m_objects.end());
+    }
+
+MemoryRegistry::Object& MemoryRegistry::findObject(const void* owner)
+    {
+    for (auto& object : m_objects)
+        {
+        if (object.owner == owner)
+            {
+            return object;
+            }
+        }
+    throw std::runtime_error("Object is not registered.");
+    }
+
+void MemoryRegistry::update()
+    {
+    for (auto& object : m_objects)
+        {
+        object.peak = std::max(object.peak, object.getAllocated());
+        }
+    }
+
+/** Trimming an object may resize the arrays of other objects (e.g. ParticleData notifies the
+    computes that allocate per-particle arrays), so the peaks are sampled once before any object
+    trims.
+*/
+void MemoryRegistry::trim()
+    {
+    update();
+
+    // trim may add or remove objects, iterate over a copy
+    std::vector<std::function<void()>> trims;
+    for (const auto& object : m_objects)
+        {
+        if (object.trim)
+            {
+            trims.push_back(object.trim);
+            }
+        }
+
+    for (const auto& trim : trims)
+        {
+        trim();
+        }
+    }
+
+std::map<std::string, MemoryUsage> MemoryRegistry::getUsage()
+    {
+    update();
+
+    std::map<std::string, MemoryUsage> result;
+    std::map<std::string, unsigned int> n_names;
+    for (const auto& object : m_objects)
+        {
+        const std::type_info& type = object.type();
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(type.name(), nullptr, nullptr, &status);
+        std::string name = (status == 0 && demangled) ? std::string(demangled) : type.name();
+        free(demangled);
+
+        unsigned int n = ++n_names[name];
+        if (n > 1)
+            {
+            name += "#" + std::to_string(n);
+            }
+
+        MemoryUsage& usage = result[name];
+        usage.allocated = object.getAllocated();
+        usage.used = object.getUsed();
+        usage.peak = object.peak;
+        }
+
+    return result;
+    }
+
+/** An object that exists on only some ranks counts as 0 bytes on the others. All ranks must call
+    this method.
+*/
+std::map<std::string, MemoryUsage> MemoryRegistry::reduceUsage()
+    {
+    std::map<std::string, MemoryUsage> local = getUsage();
+
+#ifdef ENABLE_MPI
+    if (m_mpi_config->getNRanks() > 1)
+        {
+        std::map<std::string, std::vector<uint64_t>> local_values;
+        for (const auto& [name, usage] : local)
+            {
+            local_values[name] = {usage.allocated, usage.used, usage.peak};
+            }
+
+        std::vector<std::map<std::string, std::vector<uint64_t>>> all_values;
+        all_gather_v(local_values, all_values, m_mpi_config->getCommunicator());
+
+        std::map<std::string, MemoryUsage> result;
+        for (const auto& rank_values : all_values)
+            {
+            for (const auto& [name, values] : rank_values)
+                {
+                MemoryUsage& usage = result[name];
+                usage.allocated += values[0];
+                usage.used += values[1];
+                usage.peak += values[2];
+                }
+            }
+        return result;
+        }
+#endif
+
+    return local;
+    }
+
+pybind11::dict MemoryRegistry::getAllocatedPython()
+    {
+    pybind11::dict result;
+    for (const auto& [name, usage] : reduceUsage())
+        {
+        result[pybind11::str(name)] = usage.allocated;
+        }
+    return result;
+    }
+
+pybind11::dict MemoryRegistry::getUsedPython()
+    {
+    pybind11::dict result;
+    for (const auto& [name, usage] : reduceUsage())
+        {
+        result[pybind11::str(name)] = usage.used;
+        }
+    return result;
+    }
+
+pybind11::dict MemoryRegistry::getPeakPython()
+    {
+    pybind11::dict result;
+    for (const auto& [name, usage] : reduceUsage())
+        {
+        result[pybind11::str(name)] = usage.peak;
+        }
+    return result;
+    }
+
+namespace detail
+    {
+void export_MemoryRegistry(pybind11::module& m)
+    {
+    pybind11::class_<MemoryRegistry, std::shared_ptr<MemoryRegistry>>(m, "MemoryRegistry")
+        .def("trim", &MemoryRegistry::trim)
+        .def_property_readonly("allocated", &MemoryRegistry::getAllocatedPython)
+        .def_property_readonly("used", &MemoryRegistry::getUsedPython)
+        .def_property_readonly("peak", &MemoryRegistry::getPeakPython);
+    }
+
+    } // end namespace detail
+
+    } // end namespace hoomd
@@ -0,0 +1,217 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file MemoryRegistry.h
+    \brief Declares the MemoryRegistry class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#pragma once
+
+#include "MPIConfiguration.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+/// Memory held by one object
+struct MemoryUsage
+    {
+    /// Bytes currently allocated
+    uint64_t allocated = 0;
+
+    /// Bytes of the allocation that hold data
+    uint64_t used = 0;
+
+    /// Largest allocation seen [bytes]
+    uint64_t peak = 0;
+    };
+
+/// Account for the memory held by the objects of a simulation
+/** Arrays are over-allocated to amortize the cost of resizing: ParticleData grows its per-particle
+    arrays by a resize factor, NeighborList grows the neighbor list by 9/8, CellList reserves
+    room for the fullest cell in every cell, and the Communicator buffers never shrink.
+    MemoryRegistry reports how many bytes each object allocated and how many of them hold data.
+
+    Objects register themselves with addObject() and then register each of their arrays with
+    addArray() or addVector(). The registry stores functions that read the current size of the
+    array, so resizing an array needs no further bookkeeping and registering costs nothing during
+    the run. Objects must call removeObject() in their destructor.
+
+    Objects name themselves after their C++ type at query time, so base classes may register in
+    their constructor. When several live objects have the same type, the second and later are
+    numbered in the order they registered (e.g. ``hoomd::md::NeighborListTree#2``).
+
+    Arrays only shrink when an object trims its slack. The registry samples the peak allocation
+    of every object before it trims and whenever it reports.
+
+    Query and trim only between runs. All ranks must call the methods that reduce over ranks.
+*/
+class PYBIND11_EXPORT MemoryRegistry
+    {
+    public:
+    /// Function that returns a number of bytes
+    typedef std::function<uint64_t()> ByteCounter;
+
+    /// Constructor
+    MemoryRegistry(std::shared_ptr<MPIConfiguration> mpi_config);
+
+    /// Register an object
+    /** \param owner The object
+        \param trim Function that frees the slack of the object's arrays (may be empty)
+    */
+    template<class Owner> void addObject(const Owner* owner, std::function<void()> trim = {})
+        {
+        addObject(
+            owner,
+            [owner]() -> const std::type_info& { return typeid(*owner); },
+            trim);
+        }
+
+    /// Register an array of an object
+    /** \param owner The object (must be registered)
+        \param array The array
+        \param used_elements Function that returns the number of elements that hold data. When
+               empty, all elements hold data.
+
+        Works with GPUArray and GlobalArray.
+    */
+    template<template<class...> class Array, class T, class... Rest>
+    void addArray(const void* owner,
+                  const Array<T, Rest...>& array,
+                  std::function<size_t()> used_elements = {})
+        {
+        const Array<T, Rest...>* a = &array;
+        ByteCounter allocated = [a]() { return uint64_t(a->getNumElements()) * sizeof(T); };
+        ByteCounter used = allocated;
+        if (used_elements)
+            {
+            used = [used_elements]() { return uint64_t(used_elements()) * sizeof(T); };
+            }
+        addCounters(owner, allocated, used);
+        }
+
+    /// Register a vector of an object
+    /** \param owner The object (must be registered)
+        \param vector The vector. Elements past its size are slack.
+
+        Works with GPUVector and GlobalVector.
+    */
+    template<template<class...> class Vector, class T, class... Rest>
+    void addVector(const void* owner, const Vector<T, Rest...>& vector)
+        {
+        const Vector<T, Rest...>* v = &vector;
+        addCounters(
+            owner,
+            [v]() { return uint64_t(v->getNumElements()) * sizeof(T); },
+            [v]() { return uint64_t(v->size()) * sizeof(T); });
+        }
+
+    /// Register functions that count the allocated and used bytes of an object
+    void addCounters(const void* owner, ByteCounter allocated, ByteCounter used);
+
+    /// Unregister an object
+    void removeObject(const void* owner);
+
+    /// Record the current allocations in the peaks
+    void update();
+
+    /// Free the slack of all objects that support it
+    void trim();
+
+    /// Get the memory held by each object on this rank
+    std::map<std::string, MemoryUsage> getUsage();
+
+    /// Get the memory held by each object summed over all ranks
+    std::map<std::string, MemoryUsage> reduceUsage();
+
+    /// Get the allocated bytes of each object summed over all ranks
+    pybind11::dict getAllocatedPython();
+
+    /// Get the used bytes of each object summed over all ranks
+    pybind11::dict getUsedPython();
+
+    /// Get the peak bytes of each object summed over all ranks
+    pybind11::dict getPeakPython();
+
+    private:
+    /// A registered object
+    struct Object
+        {
+        /// The object
+        const void* owner;
+
+        /// Dynamic type of the object
+        std::function<const std::type_info&()> type;
+
+        /// Functions that count the allocated bytes of each array
+        std::vector<ByteCounter> allocated;
+
+        /// Functions that count the used bytes of each array
+        std::vector<ByteCounter> used;
+
+        /// Function that frees the slack (may be empty)
+        std::function<void()> trim;
+
+        /// Largest allocation seen [bytes]
+        uint64_t peak = 0;
+
+        /// Sum the allocated bytes of all arrays
+        uint64_t getAllocated() const
+            {
+            uint64_t total = 0;
+            for (const auto& counter : allocated)
+                {
+                total += counter();
+                }
+            return total;
+            }
+
+        /// Sum the used bytes of all arrays
+        uint64_t getUsed() const
+            {
+            uint64_t total = 0;
+            for (size_t i = 0; i < used.size(); i++)
+                {
+                // a lazily allocated array may report more used elements than it holds
+                total += std::min(used[i](), allocated[i]());
+                }
+            return total;
+            }
+        };
+
+    /// Register an object
+    void addObject(const void* owner,
+                   std::function<const std::type_info&()> type,
+                   std::function<void()> trim);
+
+    /// Find a registered object
+    Object& findObject(const void* owner);
+
+    /// MPI configuration
+    std::shared_ptr<MPIConfiguration> m_mpi_config;
+
+    /// Registered objects in the order they registered
+    std::vector<Object> m_objects;
+    };
+
+namespace detail
+    {
+/// Export MemoryRegistry to Python
+void export_MemoryRegistry(pybind11::module& m);
+
+    } // end namespace detail
+
+    } // end namespace hoomd
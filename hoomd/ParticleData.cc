@@ -116,6 +116,8 @@ ParticleData::ParticleData(unsigned int N,
     // initialize all processors
     initializeFromSnapshot(snap);
 
+    registerMemory();
+
     // reset external virial
     for (unsigned int i = 0; i < 6; i++)
         m_external_virial[i] = Scalar(0.0);
@@ -174,6 +176,8 @@ ParticleData::ParticleData(const SnapshotParticleData<Real>& snapshot,
     // initialize particle data with snapshot contents
     initializeFromSnapshot(snapshot);
 
+    registerMemory();
+
     // reset external virial
     for (unsigned int i = 0; i < 6; i++)
         m_external_virial[i] = Scalar(0.0);
@@ -188,6 +192,65 @@ ParticleData::ParticleData(const SnapshotParticleData<Real>& snapshot,
 ParticleData::~ParticleData()
     {
     m_exec_conf->msg->notice(5) << "Destroying ParticleData" << endl;
+    m_exec_conf->getMemoryRegistry()->removeObject(this);
+    }
+
+/*! The per-particle arrays hold data for the local and the ghost particles. The remaining rows up
+    to getMaxN() are slack from amortized resizing.
+*/
+void ParticleData::registerMemory()
+    {
+    MemoryRegistry* registry = m_exec_conf->getMemoryRegistry();
+    registry->addObject(this, [this]() { trimMemory(); });
+
+    auto n_rows = [this]() { return size_t(getN() + getNGhosts()); };
+    auto n_virial = [this]() { return size_t(getN() + getNGhosts()) * 6; };
+
+    registry->addArray(this, m_pos, n_rows);
+    registry->addArray(this, m_vel, n_rows);
+    registry->addArray(this, m_accel, n_rows);
+    registry->addArray(this, m_charge, n_rows);
+    registry->addArray(this, m_diameter, n_rows);
+    registry->addArray(this, m_image, n_rows);
+    registry->addArray(this, m_tag, n_rows);
+    registry->addVector(this, m_rtag);
+    registry->addArray(this, m_body, n_rows);
+    registry->addArray(this, m_group_flags, n_rows);
+    registry->addArray(this, m_orientation, n_rows);
+    registry->addArray(this, m_angmom, n_rows);
+    registry->addArray(this, m_inertia, n_rows);
+    registry->addArray(this, m_comm_flags, n_rows);
+    registry->addArray(this, m_net_force, n_rows);
+    registry->addArray(this, m_net_virial, n_virial);
+    registry->addArray(this, m_net_torque, n_rows);
+
+    registry->addArray(this, m_pos_alt, n_rows);
+    registry->addArray(this, m_vel_alt, n_rows);
+    registry->addArray(this, m_accel_alt, n_rows);
+    registry->addArray(this, m_charge_alt, n_rows);
+    registry->addArray(this, m_diameter_alt, n_rows);
+    registry->addArray(this, m_image_alt, n_rows);
+    registry->addArray(this, m_tag_alt, n_rows);
+    registry->addArray(this, m_body_alt, n_rows);
+    registry->addArray(this, m_group_flags_alt, n_rows);
+    registry->addArray(this, m_orientation_alt, n_rows);
+    registry->addArray(this, m_angmom_alt, n_rows);
+    registry->addArray(this, m_inertia_alt, n_rows);
+    registry->addArray(this, m_net_force_alt, n_rows);
+    registry->addArray(this, m_net_virial_alt, n_virial);
+    registry->addArray(this, m_net_torque_alt, n_rows);
+    }
+
+/*! Computes that allocate per-particle arrays follow the new maximum through
+    m_max_particle_num_signal. The arrays grow again as needed.
+*/
+void ParticleData::trimMemory()
+    {
+    unsigned int max_n = std::max(getN() + getNGhosts(), 1u);
+    if (m_arrays_allocated && max_n < m_max_nparticles)
+        {
+        reallocate(max_n);
+        }
     }
 
 /*! \return Simulation box dimensions
@@ -276,6 +339,27 @@ const BoxDim ParticleData::getGlobalBox() const
 */
 void ParticleData::notifyParticleSort()
     {
+    m_sort_permutation.clear();
+    m_sort_permutation_valid = false;
+    emitParticleSort();
+    }
+
+/*! \param moved (new index, old index) pairs of every local particle that changed its index
+
+    Use this overload when the rearrangement is a permutation of the local particles (the number
+    of particles does not change). Listeners may read the permutation with getSortPermutation()
+    while handling the signal.
+*/
+void ParticleData::notifyParticleSort(
+    const std::vector<std::pair<unsigned int, unsigned int>>& moved)
+    {
+    m_sort_permutation = moved;
+    m_sort_permutation_valid = true;
+    emitParticleSort();
+    }
+
+void ParticleData::emitParticleSort()
+    {
 #ifdef ENABLE_HIP
     if (m_exec_conf->isCUDAEnabled())
         {
@@ -407,6 +491,17 @@ void ParticleData::allocate(unsigned int N)
     m_body.swap(body);
     TAG_ALLOCATION(m_body);
 
+    // group membership flags
+    GlobalArray<unsigned int> group_flags(N, m_exec_conf);
+    m_group_flags.swap(group_flags);
+    TAG_ALLOCATION(m_group_flags);
+        {
+        ArrayHandle<unsigned int> h_group_flags(m_group_flags,
+                                                access_location::host,
+                                                access_mode::overwrite);
+        memset(h_group_flags.data, 0, sizeof(unsigned int) * m_group_flags.getNumElements());
+        }
+
     GlobalArray<Scalar4> net_force(N, m_exec_conf);
     m_net_force.swap(net_force);
     TAG_ALLOCATION(m_net_force);
@@ -553,6 +648,11 @@ void ParticleData::allocateAlternateArrays(unsigned int N)
     m_body_alt.swap(body_alt);
     TAG_ALLOCATION(m_body_alt);
 
+    // group membership flags
+    GlobalArray<unsigned int> group_flags_alt(N, m_exec_conf);
+    m_group_flags_alt.swap(group_flags_alt);
+    TAG_ALLOCATION(m_group_flags_alt);
+
     // orientation
     GlobalArray<Scalar4> orientation_alt(N, m_exec_conf);
     m_orientation_alt.swap(orientation_alt);
@@ -746,6 +846,7 @@ void ParticleData::reallocate(unsigned int max_n)
     m_image.resize(max_n);
     m_tag.resize(max_n);
     m_body.resize(max_n);
+    m_group_flags.resize(max_n);
 
     m_net_force.resize(max_n);
     m_net_virial.resize(max_n, 6);
@@ -831,6 +932,7 @@ void ParticleData::reallocate(unsigned int max_n)
         m_image_alt.resize(max_n);
         m_tag_alt.resize(max_n);
         m_body_alt.resize(max_n);
+        m_group_flags_alt.resize(max_n);
         m_orientation_alt.resize(max_n);
         m_angmom_alt.resize(max_n);
         m_inertia_alt.resize(max_n);
@@ -1031,6 +1133,7 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
         std::vector<std::vector<Scalar4>> angmom_proc;      // Angular momenta of every processor
         std::vector<std::vector<Scalar3>> inertia_proc;     // Angular momenta of every processor
         std::vector<std::vector<unsigned int>> tag_proc;    // Global tags of every processor
+        std::vector<std::vector<unsigned int>> group_flags_proc; // Group flags of every processor
         std::vector<unsigned int> N_proc; // Number of particles on every processor
 
         // resize to number of ranks in communicator
@@ -1051,19 +1154,34 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
         angmom_proc.resize(size);
         inertia_proc.resize(size);
         tag_proc.resize(size);
+        group_flags_proc.resize(size);
         N_proc.resize(size, 0);
 
+        // groups keep their members by tag across the snapshot, as they do when they store the
+        // member tags
+        std::vector<unsigned int> group_flags_by_tag = collectGroupFlagsByTag(false);
+
+        // fit the bisection domains to the particles held by the root
+        if (m_decomposition->isRecursiveBisection())
+            {
+            std::vector<Scalar3> fractions;
+            if (my_rank == 0)
+                {
+                fractions.reserve(snapshot.pos.size());
+                for (const auto& pos : snapshot.pos)
+                    {
+                    fractions.push_back(m_global_box->makeFraction(vec_to_scalar3(pos)));
+                    }
+                }
+            bisectDomains(fractions);
+            }
+
         if (my_rank == 0)
             {
             ArrayHandle<unsigned int> h_cart_ranks(m_decomposition->getCartRanks(),
                                                    access_location::host,
                                                    access_mode::read);
 
-            const Index3D& di = m_decomposition->getDomainIndexer();
-            unsigned int n_ranks = m_exec_conf->getNRanks();
-
-            BoxDim global_box = *m_global_box;
-
             // loop over particles in snapshot, place them into domains
             for (typename std::vector<vec3<Real>>::const_iterator it = snapshot.pos.begin();
                  it != snapshot.pos.end();
@@ -1078,63 +1196,9 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
                     continue;
                     }
 
-                // determine domain the particle is placed into
                 Scalar3 pos = vec_to_scalar3(*it);
-                Scalar3 f = m_global_box->makeFraction(pos);
-                int i = int(f.x * ((Scalar)di.getW()));
-                int j = int(f.y * ((Scalar)di.getH()));
-                int k = int(f.z * ((Scalar)di.getD()));
-
-                // wrap particles that are exactly on a boundary
-                // we only need to wrap in the negative direction, since
-                // processor ids are rounded toward zero
-                char3 flags = make_char3(0, 0, 0);
-                if (i == (int)di.getW())
-                    {
-                    i = 0;
-                    flags.x = 1;
-                    }
-
-                if (j == (int)di.getH())
-                    {
-                    j = 0;
-                    flags.y = 1;
-                    }
-
-                if (k == (int)di.getD())
-                    {
-                    k = 0;
-                    flags.z = 1;
-                    }
-
                 int3 img = snapshot.image[snap_idx];
-
-                // only wrap if the particles is on one of the boundaries
-                uchar3 periodic = make_uchar3(flags.x, flags.y, flags.z);
-                global_box.setPeriodic(periodic);
-                global_box.wrap(pos, img, flags);
-
-                // place particle using actual domain fractions, not global box fraction
-                unsigned int rank
-                    = m_decomposition->placeParticle(global_box, pos, h_cart_ranks.data);
-
-                if (rank >= n_ranks)
-                    {
-                    ostringstream s;
-                    s << "init.*: Particle " << snap_idx << " out of bounds." << std::endl;
-                    s << "Cartesian coordinates: " << std::endl;
-                    s << "x: " << pos.x << " y: " << pos.y << " z: " << pos.z << std::endl;
-                    s << "Fractional coordinates: " << std::endl;
-                    s << "f.x: " << f.x << " f.y: " << f.y << " f.z: " << f.z << std::endl;
-                    Scalar3 lo = m_global_box->getLo();
-                    Scalar3 hi = m_global_box->getHi();
-                    s << "Global box lo: (" << lo.x << ", " << lo.y << ", " << lo.z << ")"
-                      << std::endl;
-                    s << "           hi: (" << hi.x << ", " << hi.y << ", " << hi.z << ")"
-                      << std::endl;
-
-                    throw std::runtime_error(s.str());
-                    }
+                unsigned int rank = placeParticleInDomain(pos, img, h_cart_ranks.data, snap_idx);
 
                 // fill up per-processor data structures
                 pos_proc[rank].push_back(pos);
@@ -1149,6 +1213,8 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
                 orientation_proc[rank].push_back(quat_to_scalar4(snapshot.orientation[snap_idx]));
                 angmom_proc[rank].push_back(quat_to_scalar4(snapshot.angmom[snap_idx]));
                 inertia_proc[rank].push_back(vec_to_scalar3(snapshot.inertia[snap_idx]));
+                group_flags_proc[rank].push_back(
+                    nglobal < group_flags_by_tag.size() ? group_flags_by_tag[nglobal] : 0);
                 tag_proc[rank].push_back(nglobal++);
                 N_proc[rank]++;
 
@@ -1188,6 +1254,7 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
         std::vector<Scalar4> angmom;
         std::vector<Scalar3> inertia;
         std::vector<unsigned int> tag;
+        std::vector<unsigned int> group_flags;
 
         // distribute particle data
         scatter_v(pos_proc, pos, root, mpi_comm);
@@ -1203,6 +1270,7 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
         scatter_v(angmom_proc, angmom, root, mpi_comm);
         scatter_v(inertia_proc, inertia, root, mpi_comm);
         scatter_v(tag_proc, tag, root, mpi_comm);
+        scatter_v(group_flags_proc, group_flags, root, mpi_comm);
 
         // distribute number of particles
         scatter_v(N_proc, m_nparticles, root, mpi_comm);
@@ -1239,6 +1307,9 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
         ArrayHandle<Scalar> h_charge(m_charge, access_location::host, access_mode::overwrite);
         ArrayHandle<Scalar> h_diameter(m_diameter, access_location::host, access_mode::overwrite);
         ArrayHandle<unsigned int> h_body(m_body, access_location::host, access_mode::overwrite);
+        ArrayHandle<unsigned int> h_group_flags(m_group_flags,
+                                                access_location::host,
+                                                access_mode::overwrite);
         ArrayHandle<Scalar4> h_orientation(m_orientation,
                                            access_location::host,
                                            access_mode::overwrite);
@@ -1262,6 +1333,7 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
             h_tag.data[idx] = tag[idx];
             h_rtag.data[tag[idx]] = idx;
             h_body.data[idx] = body[idx];
+            h_group_flags.data[idx] = group_flags[idx];
             h_orientation.data[idx] = orientation[idx];
             h_angmom.data[idx] = angmom[idx];
             h_inertia.data[idx] = inertia[idx];
@@ -1288,6 +1360,9 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
         ArrayHandle<Scalar> h_charge(m_charge, access_location::host, access_mode::overwrite);
         ArrayHandle<Scalar> h_diameter(m_diameter, access_location::host, access_mode::overwrite);
         ArrayHandle<unsigned int> h_body(m_body, access_location::host, access_mode::overwrite);
+        ArrayHandle<unsigned int> h_group_flags(m_group_flags,
+                                                access_location::host,
+                                                access_mode::overwrite);
         ArrayHandle<Scalar4> h_orientation(m_orientation,
                                            access_location::host,
                                            access_mode::overwrite);
@@ -1321,6 +1396,7 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
             h_tag.data[nglobal] = nglobal;
             h_rtag.data[nglobal] = nglobal;
             h_body.data[nglobal] = snapshot.body[snap_idx];
+            h_group_flags.data[nglobal] = 0;
             h_orientation.data[nglobal] = quat_to_scalar4(snapshot.orientation[snap_idx]);
             h_angmom.data[nglobal] = quat_to_scalar4(snapshot.angmom[snap_idx]);
             h_inertia.data[nglobal] = vec_to_scalar3(snapshot.inertia[snap_idx]);
@@ -1378,6 +1454,375 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
         }
     }
 
+#ifdef ENABLE_MPI
+/*! \param all_ranks If true, return the flags on all ranks. Otherwise, only on the root.
+    \returns The group flags of the current particles indexed by tag, empty when no group stores
+        its membership in the flags
+
+    All ranks must call this method.
+*/
+std::vector<unsigned int> ParticleData::collectGroupFlagsByTag(bool all_ranks)
+    {
+    std::vector<unsigned int> group_flags_by_tag;
+    if (!m_reserved_group_flags)
+        return group_flags_by_tag;
+
+    // pairs of tag and flags of the local members of any group
+    std::vector<unsigned int> tags_flags;
+        {
+        ArrayHandle<unsigned int> h_tag(m_tag, access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_group_flags(m_group_flags,
+                                                access_location::host,
+                                                access_mode::read);
+        for (unsigned int idx = 0; idx < m_nparticles; idx++)
+            {
+            if (h_group_flags.data[idx])
+                {
+                tags_flags.push_back(h_tag.data[idx]);
+                tags_flags.push_back(h_group_flags.data[idx]);
+                }
+            }
+        }
+
+    const MPI_Comm mpi_comm = m_exec_conf->getMPICommunicator();
+    std::vector<std::vector<unsigned int>> tags_flags_proc;
+    if (all_ranks)
+        all_gather_v(tags_flags, tags_flags_proc, mpi_comm);
+    else
+        gather_v(tags_flags, tags_flags_proc, 0, mpi_comm);
+
+    if (all_ranks || m_exec_conf->getRank() == 0)
+        {
+        group_flags_by_tag.resize(m_rtag.size(), 0);
+        for (const auto& rank_tags_flags : tags_flags_proc)
+            {
+            for (size_t i = 0; i < rank_tags_flags.size(); i += 2)
+                {
+                group_flags_by_tag[rank_tags_flags[i]] = rank_tags_flags[i + 1];
+                }
+            }
+        }
+
+    return group_flags_by_tag;
+    }
+
+/*! \param fractions Fractional coordinates of the particles placed by this rank
+
+    Bisect the global box so that every domain receives the same number of particles and resize
+    the local box. All ranks must call this method.
+*/
+void ParticleData::bisectDomains(const std::vector<Scalar3>& fractions)
+    {
+    m_decomposition->computeRecursiveBisection(*m_global_box,
+                                               fractions,
+                                               std::vector<Scalar>(),
+                                               make_scalar3(0, 0, 0));
+    m_box = std::make_shared<const BoxDim>(m_decomposition->calculateLocalBox(*m_global_box));
+    m_boxchange_signal.emit();
+    }
+
+/*! \param pos Position of the particle, wrapped when it lies exactly on the upper boundary
+    \param img Image of the particle, updated when the position is wrapped
+    \param cart_ranks Map from cartesian domain indices to ranks
+    \param idx Index of the particle (for error messages)
+    \returns The rank of the domain that owns the particle
+*/
+unsigned int ParticleData::placeParticleInDomain(Scalar3& pos,
+                                                 int3& img,
+                                                 const unsigned int* cart_ranks,
+                                                 unsigned int idx)
+    {
+    const Index3D& di = m_decomposition->getDomainIndexer();
+
+    // determine domain the particle is placed into
+    Scalar3 f = m_global_box->makeFraction(pos);
+    int i = int(f.x * ((Scalar)di.getW()));
+    int j = int(f.y * ((Scalar)di.getH()));
+    int k = int(f.z * ((Scalar)di.getD()));
+
+    // wrap particles that are exactly on a boundary
+    // we only need to wrap in the negative direction, since
+    // processor ids are rounded toward zero
+    char3 flags = make_char3(0, 0, 0);
+    if (i == (int)di.getW())
+        {
+        flags.x = 1;
+        }
+
+    if (j == (int)di.getH())
+        {
+        flags.y = 1;
+        }
+
+    if (k == (int)di.getD())
+        {
+        flags.z = 1;
+        }
+
+    // only wrap if the particles is on one of the boundaries
+    BoxDim global_box = *m_global_box;
+    uchar3 periodic = make_uchar3(flags.x, flags.y, flags.z);
+    global_box.setPeriodic(periodic);
+    global_box.wrap(pos, img, flags);
+
+    // place particle using actual domain fractions, not global box fraction
+    unsigned int rank = m_decomposition->placeParticle(global_box, pos, cart_ranks);
+
+    if (rank >= m_exec_conf->getNRanks())
+        {
+        ostringstream s;
+        s << "init.*: Particle " << idx << " out of bounds." << std::endl;
+        s << "Cartesian coordinates: " << std::endl;
+        s << "x: " << pos.x << " y: " << pos.y << " z: " << pos.z << std::endl;
+        s << "Fractional coordinates: " << std::endl;
+        s << "f.x: " << f.x << " f.y: " << f.y << " f.z: " << f.z << std::endl;
+        Scalar3 lo = m_global_box->getLo();
+        Scalar3 hi = m_global_box->getHi();
+        s << "Global box lo: (" << lo.x << ", " << lo.y << ", " << lo.z << ")" << std::endl;
+        s << "           hi: (" << hi.x << ", " << hi.y << ", " << hi.z << ")" << std::endl;
+
+        throw std::runtime_error(s.str());
+        }
+
+    return rank;
+    }
+
+/*! \param local_snapshot Block of consecutive particles read by this rank
+    \param first_tag Tag of the first particle in \a local_snapshot
+
+    Initialize the particle data when every rank holds a different block of the particles, as read
+    by a distributed GSDReader. The blocks of all ranks together form the full system in tag order:
+    the block of rank r must start at the tag that follows the last tag of rank r-1. Every rank
+    places the particles of its block into domains and sends them to their owners with a single
+    all-to-all exchange. No rank ever holds more than its own block and its own domain, so the
+    memory use and the work are distributed evenly.
+
+    All ranks must pass the same type_mapping. The particle positions must be in the global box.
+
+    \pre The domain decomposition and the global box are set.
+ */
+template<class Real>
+void ParticleData::initializeFromDistributedSnapshot(
+    const SnapshotParticleData<Real>& local_snapshot,
+    unsigned int first_tag)
+    {
+    m_exec_conf->msg->notice(4) << "ParticleData: initializing from distributed snapshot"
+                                << std::endl;
+
+    if (!m_decomposition)
+        {
+        throw std::runtime_error("Distributed initialization requires a domain decomposition.");
+        }
+
+    // remove all ghost particles
+    removeAllGhostParticles();
+
+    // check that all fields in the local block have correct length
+    local_snapshot.validate();
+
+    // it is an error for particles to be initialized outside of their box, check on all ranks
+    // before any rank places particles to avoid deadlocks in the exchange below
+    int in_box = 1;
+    const Scalar tol = Scalar(1e-5);
+    for (unsigned int i = 0; i < local_snapshot.size; i++)
+        {
+        Scalar3 f = m_global_box->makeFraction(vec_to_scalar3(local_snapshot.pos[i]));
+        if (f.x < -tol || f.x > Scalar(1.0) + tol || f.y < -tol || f.y > Scalar(1.0) + tol
+            || f.z < -tol || f.z > Scalar(1.0) + tol)
+            {
+            m_exec_conf->msg->warning()
+                << "pos " << first_tag + i << ":" << setprecision(12) << local_snapshot.pos[i].x
+                << " " << local_snapshot.pos[i].y << " " << local_snapshot.pos[i].z << endl;
+            in_box = 0;
+            break;
+            }
+        }
+    MPI_Allreduce(MPI_IN_PLACE, &in_box, 1, MPI_INT, MPI_LAND, m_exec_conf->getMPICommunicator());
+    if (!in_box)
+        {
+        m_exec_conf->msg->warning() << "Not all particles were found inside the given box" << endl;
+        throw runtime_error("Error initializing ParticleData");
+        }
+
+    // clear set of active tags
+    m_tag_set.clear();
+
+    // clear reservoir of recycled tags
+    while (!m_recycled_tags.empty())
+        m_recycled_tags.pop();
+
+    const MPI_Comm mpi_comm = m_exec_conf->getMPICommunicator();
+    const unsigned int n_ranks = m_exec_conf->getNRanks();
+
+    unsigned int n_local = local_snapshot.size;
+
+    // fit the bisection domains to the particles of all blocks
+    if (m_decomposition->isRecursiveBisection())
+        {
+        std::vector<Scalar3> fractions(n_local);
+        for (unsigned int i = 0; i < n_local; i++)
+            {
+            fractions[i] = m_global_box->makeFraction(vec_to_scalar3(local_snapshot.pos[i]));
+            }
+        bisectDomains(fractions);
+        }
+    unsigned int nglobal = 0;
+    MPI_Allreduce(&n_local, &nglobal, 1, MPI_UNSIGNED, MPI_SUM, mpi_comm);
+
+    unsigned int max_typeid = 0;
+
+    // place the particles of the local block into domains and count the particles sent to every
+    // rank, so that the send buffer can be packed in place without a second copy of the block
+    std::vector<unsigned int> dest(n_local);
+    std::vector<int> send_counts(n_ranks, 0), recv_counts(n_ranks);
+        {
+        ArrayHandle<unsigned int> h_cart_ranks(m_decomposition->getCartRanks(),
+                                               access_location::host,
+                                               access_mode::read);
+
+        for (unsigned int snap_idx = 0; snap_idx < n_local; snap_idx++)
+            {
+            Scalar3 pos = vec_to_scalar3(local_snapshot.pos[snap_idx]);
+            int3 img = local_snapshot.image[snap_idx];
+            const unsigned int tag = first_tag + snap_idx;
+            dest[snap_idx] = placeParticleInDomain(pos, img, h_cart_ranks.data, tag);
+            send_counts[dest[snap_idx]]++;
+
+            max_typeid = std::max(max_typeid, local_snapshot.type[snap_idx]);
+            }
+        }
+
+    // exchange the number of particles sent to every rank
+    MPI_Alltoall(send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT, mpi_comm);
+
+    std::vector<int> send_displs(n_ranks, 0), recv_displs(n_ranks, 0);
+    for (unsigned int rank = 1; rank < n_ranks; rank++)
+        {
+        send_displs[rank] = send_displs[rank - 1] + send_counts[rank - 1];
+        recv_displs[rank] = recv_displs[rank - 1] + recv_counts[rank - 1];
+        }
+
+    // groups keep their members by tag across the snapshot, as they do when they store the
+    // member tags
+    const std::vector<unsigned int> group_flags_by_tag = collectGroupFlagsByTag(true);
+
+    // pack the send buffer in rank order
+    std::vector<detail::pdata_element> send_buf(n_local);
+        {
+        ArrayHandle<unsigned int> h_cart_ranks(m_decomposition->getCartRanks(),
+                                               access_location::host,
+                                               access_mode::read);
+
+        std::vector<int> offset(send_displs);
+        for (unsigned int snap_idx = 0; snap_idx < n_local; snap_idx++)
+            {
+            const unsigned int tag = first_tag + snap_idx;
+
+            // placing again wraps the position and image the same way as above
+            Scalar3 pos = vec_to_scalar3(local_snapshot.pos[snap_idx]);
+            int3 img = local_snapshot.image[snap_idx];
+            placeParticleInDomain(pos, img, h_cart_ranks.data, tag);
+
+            detail::pdata_element& p = send_buf[offset[dest[snap_idx]]++];
+            p.pos = make_scalar4(pos.x,
+                                 pos.y,
+                                 pos.z,
+                                 __int_as_scalar(local_snapshot.type[snap_idx]));
+            p.vel = make_scalar4(local_snapshot.vel[snap_idx].x,
+                                 local_snapshot.vel[snap_idx].y,
+                                 local_snapshot.vel[snap_idx].z,
+                                 local_snapshot.mass[snap_idx]);
+            p.accel = vec_to_scalar3(local_snapshot.accel[snap_idx]);
+            p.charge = local_snapshot.charge[snap_idx];
+            p.diameter = local_snapshot.diameter[snap_idx];
+            p.image = img;
+            p.body = local_snapshot.body[snap_idx];
+            p.group_flags = tag < group_flags_by_tag.size() ? group_flags_by_tag[tag] : 0;
+            p.orientation = quat_to_scalar4(local_snapshot.orientation[snap_idx]);
+            p.angmom = quat_to_scalar4(local_snapshot.angmom[snap_idx]);
+            p.inertia = vec_to_scalar3(local_snapshot.inertia[snap_idx]);
+            p.tag = tag;
+            p.net_force = make_scalar4(0, 0, 0, 0);
+            p.net_torque = make_scalar4(0, 0, 0, 0);
+            for (unsigned int j = 0; j < 6; ++j)
+                p.net_virial[j] = Scalar(0.0);
+            }
+        }
+    std::vector<unsigned int>().swap(dest);
+
+    // count whole elements so that the byte counts of large blocks do not overflow an int
+    MPI_Datatype element_type;
+    MPI_Type_contiguous(sizeof(detail::pdata_element), MPI_BYTE, &element_type);
+    MPI_Type_commit(&element_type);
+
+    std::vector<detail::pdata_element> recv_buf(recv_displs[n_ranks - 1]
+                                                + recv_counts[n_ranks - 1]);
+    MPI_Alltoallv(send_buf.data(),
+                  send_counts.data(),
+                  send_displs.data(),
+                  element_type,
+                  recv_buf.data(),
+                  recv_counts.data(),
+                  recv_displs.data(),
+                  element_type,
+                  mpi_comm);
+    MPI_Type_free(&element_type);
+    std::vector<detail::pdata_element>().swap(send_buf);
+
+    // initialize type mapping
+    m_type_mapping = local_snapshot.type_mapping;
+
+    // resize array for reverse-lookup tags
+    m_rtag.resize(nglobal);
+
+        {
+        // reset all reverse lookup tags to NOT_LOCAL flag
+        ArrayHandle<unsigned int> h_rtag(getRTags(), access_location::host, access_mode::overwrite);
+
+        // we have to reset all previous rtags, to remove 'leftover' ghosts
+        unsigned int max_tag = (unsigned int)m_rtag.size();
+        for (unsigned int tag = 0; tag < max_tag; tag++)
+            h_rtag.data[tag] = NOT_LOCAL;
+        }
+
+    // update list of active tags
+    for (unsigned int tag = 0; tag < nglobal; tag++)
+        {
+        m_tag_set.insert(tag);
+        }
+
+    // Now that active tag list has changed, invalidate the cache
+    m_invalid_cached_tags = true;
+
+    // load the received particles, addParticles sets the rtags
+    resize(0);
+    addParticles(recv_buf);
+
+    // copy over accel_set flag from snapshot
+    m_accel_set = local_snapshot.is_accel_set;
+
+    // set global number of particles
+    setNGlobal(nglobal);
+
+    // notify listeners about resorting of local particles
+    notifyParticleSort();
+
+    // zero the origin
+    m_origin = make_scalar3(0, 0, 0);
+    m_o_image = make_int3(0, 0, 0);
+
+    // Raise an exception if there are any invalid type ids on any rank.
+    MPI_Allreduce(MPI_IN_PLACE, &max_typeid, 1, MPI_UNSIGNED, MPI_MAX, mpi_comm);
+    if (nglobal != 0 && max_typeid >= m_type_mapping.size())
+        {
+        std::ostringstream s;
+        s << "Particle typeid " << max_typeid << " is invalid in a system with "
+          << m_type_mapping.size() << " types.";
+        throw std::runtime_error(s.str());
+        }
+    }
+#endif
+
 //! take a particle data snapshot
 /* \param snapshot The snapshot to write to
    \returns a map to lookup the snapshot index from a particle tag
@@ -2430,28 +2875,52 @@ void ParticleData::setMomentsOfInertia(unsigned int tag, const Scalar3& inertia)
  */
 unsigned int ParticleData::addParticle(unsigned int type)
     {
+    return addNewParticles(std::vector<unsigned int>(1, type))[0];
+    }
+
+/*!
+ * Initialize the particle data with several new particles at once.
+ *
+ * The particle data arrays grow at most once for the whole batch, and listeners are notified of
+ * the new particles only once. Otherwise, the particles are initialized as in addParticle().
+ *
+ * \param types Type of each particle to add
+ * \returns the unique tags of the newly added particles, in the order of \a types
+ */
+std::vector<unsigned int> ParticleData::addNewParticles(const std::vector<unsigned int>& types)
+    {
+    std::vector<unsigned int> tags;
+    if (types.empty())
+        return tags;
+
     // we are changing the local number of particles, so remove ghosts
     removeAllGhostParticles();
 
-    // the global tag of the newly created particle
-    unsigned int tag;
+    const unsigned int n_add = (unsigned int)types.size();
+    tags.reserve(n_add);
 
-    // first check if we can recycle a deleted tag
-    if (m_recycled_tags.size())
+    // the global tags of the newly created particles
+    unsigned int next_tag = getNGlobal() + (unsigned int)m_recycled_tags.size();
+    for (unsigned int k = 0; k < n_add; ++k)
         {
-        tag = m_recycled_tags.top();
-        m_recycled_tags.pop();
-        }
-    else
-        {
-        // Otherwise, generate a new tag
-        tag = getNGlobal();
+        unsigned int tag;
 
-        assert(m_rtag.size() == getNGlobal());
-        }
+        // first check if we can recycle a deleted tag
+        if (m_recycled_tags.size())
+            {
+            tag = m_recycled_tags.top();
+            m_recycled_tags.pop();
+            }
+        else
+            {
+            // Otherwise, generate a new tag
+            tag = next_tag++;
+            }
 
-    // add to set of active tags
-    m_tag_set.insert(tag);
+        // add to set of active tags
+        m_tag_set.insert(tag);
+        tags.push_back(tag);
+        }
 
     // invalidate the active tag cache
     m_invalid_cached_tags = true;
@@ -2459,30 +2928,31 @@ unsigned int ParticleData::addParticle(unsigned int type)
     // resize array of global reverse lookup tags
     m_rtag.resize(getMaximumTag() + 1);
 
+    unsigned int old_nparticles = getN();
+
         {
         // update reverse-lookup table
         ArrayHandle<unsigned int> h_rtag(m_rtag, access_location::host, access_mode::readwrite);
-        assert((h_rtag.data[tag] = NOT_LOCAL));
-        if (m_exec_conf->getRank() == 0)
-            {
-            // we add the particle at the end
-            h_rtag.data[tag] = getN();
-            }
-        else
+        for (unsigned int k = 0; k < n_add; ++k)
             {
-            // not on this processor
-            h_rtag.data[tag] = NOT_LOCAL;
+            if (m_exec_conf->getRank() == 0)
+                {
+                // we add the particles at the end
+                h_rtag.data[tags[k]] = old_nparticles + k;
+                }
+            else
+                {
+                // not on this processor
+                h_rtag.data[tags[k]] = NOT_LOCAL;
+                }
             }
         }
 
-    assert(tag <= m_recycled_tags.size() + getNGlobal());
-
     if (m_exec_conf->getRank() == 0)
         {
         // resize particle data using amortized O(1) array resizing
         // and update particle number
-        unsigned int old_nparticles = getN();
-        resize(old_nparticles + 1);
+        resize(old_nparticles + n_add);
 
         // access particle data arrays
         ArrayHandle<Scalar4> h_pos(getPositions(), access_location::host, access_mode::readwrite);
@@ -2504,6 +2974,9 @@ unsigned int ParticleData::addParticle(unsigned int type)
         ArrayHandle<unsigned int> h_body(getBodies(),
                                          access_location::host,
                                          access_mode::readwrite);
+        ArrayHandle<unsigned int> h_group_flags(m_group_flags,
+                                                access_location::host,
+                                                access_mode::readwrite);
         ArrayHandle<Scalar4> h_orientation(getOrientationArray(),
                                            access_location::host,
                                            access_mode::readwrite);
@@ -2512,30 +2985,34 @@ unsigned int ParticleData::addParticle(unsigned int type)
                                               access_location::host,
                                               access_mode::readwrite);
 
-        unsigned int idx = old_nparticles;
-
-        // initialize to some sensible default values
-        h_pos.data[idx] = make_scalar4(0, 0, 0, __int_as_scalar(type));
-        h_vel.data[idx] = make_scalar4(0, 0, 0, 1.0);
-        h_accel.data[idx] = make_scalar3(0, 0, 0);
-        h_charge.data[idx] = 0.0;
-        h_diameter.data[idx] = 1.0;
-        h_image.data[idx] = make_int3(0, 0, 0);
-        h_angmom.data[idx] = make_scalar4(0, 0, 0, 0);
-        h_inertia.data[idx] = make_scalar3(0, 0, 0);
-        h_body.data[idx] = NO_BODY;
-        h_orientation.data[idx] = make_scalar4(1.0, 0.0, 0.0, 0.0);
-        h_tag.data[idx] = tag;
-        h_comm_flag.data[idx] = 0;
+        for (unsigned int k = 0; k < n_add; ++k)
+            {
+            unsigned int idx = old_nparticles + k;
+
+            // initialize to some sensible default values
+            h_pos.data[idx] = make_scalar4(0, 0, 0, __int_as_scalar(types[k]));
+            h_vel.data[idx] = make_scalar4(0, 0, 0, 1.0);
+            h_accel.data[idx] = make_scalar3(0, 0, 0);
+            h_charge.data[idx] = 0.0;
+            h_diameter.data[idx] = 1.0;
+            h_image.data[idx] = make_int3(0, 0, 0);
+            h_angmom.data[idx] = make_scalar4(0, 0, 0, 0);
+            h_inertia.data[idx] = make_scalar3(0, 0, 0);
+            h_body.data[idx] = NO_BODY;
+            h_group_flags.data[idx] = 0;
+            h_orientation.data[idx] = make_scalar4(1.0, 0.0, 0.0, 0.0);
+            h_tag.data[idx] = tags[k];
+            h_comm_flag.data[idx] = 0;
+            }
         }
 
     // update global number of particles
-    setNGlobal(getNGlobal() + 1);
+    setNGlobal(getNGlobal() + n_add);
 
-    // we have added a particle, notify listeners
+    // we have added particles, notify listeners
     notifyParticleSort();
 
-    return tag;
+    return tags;
     }
 
 /*! \param tag Tag of particle to remove
@@ -2617,6 +3094,9 @@ void ParticleData::removeParticle(unsigned int tag)
             ArrayHandle<unsigned int> h_body(getBodies(),
                                              access_location::host,
                                              access_mode::readwrite);
+            ArrayHandle<unsigned int> h_group_flags(m_group_flags,
+                                                    access_location::host,
+                                                    access_mode::readwrite);
             ArrayHandle<Scalar4> h_orientation(getOrientationArray(),
                                                access_location::host,
                                                access_mode::readwrite);
@@ -2637,6 +3117,7 @@ void ParticleData::removeParticle(unsigned int tag)
             h_diameter.data[idx] = h_diameter.data[size - 1];
             h_image.data[idx] = h_image.data[size - 1];
             h_body.data[idx] = h_body.data[size - 1];
+            h_group_flags.data[idx] = h_group_flags.data[size - 1];
             h_orientation.data[idx] = h_orientation.data[size - 1];
             h_tag.data[idx] = h_tag.data[size - 1];
             h_comm_flag.data[idx] = h_comm_flag.data[size - 1];
@@ -2746,6 +3227,11 @@ template void
 ParticleData::initializeFromSnapshot<double>(const SnapshotParticleData<double>& snapshot,
                                              bool ignore_bodies);
 template void ParticleData::takeSnapshot<double>(SnapshotParticleData<double>& snapshot);
+#ifdef ENABLE_MPI
+template void ParticleData::initializeFromDistributedSnapshot<double>(
+    const SnapshotParticleData<double>& local_snapshot,
+    unsigned int first_tag);
+#endif
 
 template ParticleData::ParticleData(const SnapshotParticleData<float>& snapshot,
                                     const std::shared_ptr<const BoxDim> global_box,
@@ -2755,6 +3241,11 @@ template void
 ParticleData::initializeFromSnapshot<float>(const SnapshotParticleData<float>& snapshot,
                                             bool ignore_bodies);
 template void ParticleData::takeSnapshot<float>(SnapshotParticleData<float>& snapshot);
+#ifdef ENABLE_MPI
+template void ParticleData::initializeFromDistributedSnapshot<float>(
+    const SnapshotParticleData<float>& local_snapshot,
+    unsigned int first_tag);
+#endif
 
 namespace detail
     {
@@ -2953,6 +3444,9 @@ void ParticleData::removeParticles(std::vector<detail::pdata_element>& out,
         ArrayHandle<unsigned int> h_body(getBodies(),
                                          access_location::host,
                                          access_mode::readwrite);
+        ArrayHandle<unsigned int> h_group_flags(m_group_flags,
+                                                access_location::host,
+                                                access_mode::readwrite);
         ArrayHandle<Scalar4> h_orientation(getOrientationArray(),
                                            access_location::host,
                                            access_mode::readwrite);
@@ -2995,6 +3489,9 @@ void ParticleData::removeParticles(std::vector<detail::pdata_element>& out,
         ArrayHandle<unsigned int> h_body_alt(m_body_alt,
                                              access_location::host,
                                              access_mode::overwrite);
+        ArrayHandle<unsigned int> h_group_flags_alt(m_group_flags_alt,
+                                                    access_location::host,
+                                                    access_mode::overwrite);
         ArrayHandle<Scalar4> h_orientation_alt(m_orientation_alt,
                                                access_location::host,
                                                access_mode::overwrite);
@@ -3034,6 +3531,7 @@ void ParticleData::removeParticles(std::vector<detail::pdata_element>& out,
                 h_diameter_alt.data[n] = h_diameter.data[i];
                 h_image_alt.data[n] = h_image.data[i];
                 h_body_alt.data[n] = h_body.data[i];
+                h_group_flags_alt.data[n] = h_group_flags.data[i];
                 h_orientation_alt.data[n] = h_orientation.data[i];
                 h_angmom_alt.data[n] = h_angmom.data[i];
                 h_inertia_alt.data[n] = h_inertia.data[i];
@@ -3056,6 +3554,7 @@ void ParticleData::removeParticles(std::vector<detail::pdata_element>& out,
                 p.diameter = h_diameter.data[i];
                 p.image = h_image.data[i];
                 p.body = h_body.data[i];
+                p.group_flags = h_group_flags.data[i];
                 p.orientation = h_orientation.data[i];
                 p.angmom = h_angmom.data[i];
                 p.inertia = h_inertia.data[i];
@@ -3086,6 +3585,7 @@ void ParticleData::removeParticles(std::vector<detail::pdata_element>& out,
     swapDiameters();
     swapImages();
     swapBodies();
+    swapGroupFlags();
     swapOrientations();
     swapAngularMomenta();
     swapMomentsOfInertia();
@@ -3139,6 +3639,9 @@ void ParticleData::addParticles(const std::vector<detail::pdata_element>& in)
         ArrayHandle<unsigned int> h_body(getBodies(),
                                          access_location::host,
                                          access_mode::readwrite);
+        ArrayHandle<unsigned int> h_group_flags(m_group_flags,
+                                                access_location::host,
+                                                access_mode::readwrite);
         ArrayHandle<Scalar4> h_orientation(getOrientationArray(),
                                            access_location::host,
                                            access_mode::readwrite);
@@ -3177,6 +3680,7 @@ void ParticleData::addParticles(const std::vector<detail::pdata_element>& in)
             h_diameter.data[n] = p.diameter;
             h_image.data[n] = p.image;
             h_body.data[n] = p.body;
+            h_group_flags.data[n] = p.group_flags;
             h_orientation.data[n] = p.orientation;
             h_angmom.data[n] = p.angmom;
             h_inertia.data[n] = p.inertia;
@@ -3247,6 +3751,9 @@ void ParticleData::removeParticlesGPU(GlobalVector<detail::pdata_element>& out,
         ArrayHandle<Scalar> d_diameter(getDiameters(), access_location::device, access_mode::read);
         ArrayHandle<int3> d_image(getImages(), access_location::device, access_mode::read);
         ArrayHandle<unsigned int> d_body(getBodies(), access_location::device, access_mode::read);
+        ArrayHandle<unsigned int> d_group_flags(getGroupFlags(),
+                                                access_location::device,
+                                                access_mode::read);
         ArrayHandle<Scalar4> d_orientation(getOrientationArray(),
                                            access_location::device,
                                            access_mode::read);
@@ -3281,6 +3788,9 @@ void ParticleData::removeParticlesGPU(GlobalVector<detail::pdata_element>& out,
         ArrayHandle<unsigned int> d_body_alt(m_body_alt,
                                              access_location::device,
                                              access_mode::overwrite);
+        ArrayHandle<unsigned int> d_group_flags_alt(m_group_flags_alt,
+                                                    access_location::device,
+                                                    access_mode::overwrite);
         ArrayHandle<Scalar4> d_orientation_alt(m_orientation_alt,
                                                access_location::device,
                                                access_mode::overwrite);
@@ -3334,6 +3844,7 @@ void ParticleData::removeParticlesGPU(GlobalVector<detail::pdata_element>& out,
                                              d_diameter.data,
                                              d_image.data,
                                              d_body.data,
+                                             d_group_flags.data,
                                              d_orientation.data,
                                              d_angmom.data,
                                              d_inertia.data,
@@ -3350,6 +3861,7 @@ void ParticleData::removeParticlesGPU(GlobalVector<detail::pdata_element>& out,
                                              d_diameter_alt.data,
                                              d_image_alt.data,
                                              d_body_alt.data,
+                                             d_group_flags_alt.data,
                                              d_orientation_alt.data,
                                              d_angmom_alt.data,
                                              d_inertia_alt.data,
@@ -3395,6 +3907,7 @@ void ParticleData::removeParticlesGPU(GlobalVector<detail::pdata_element>& out,
     swapDiameters();
     swapImages();
     swapBodies();
+    swapGroupFlags();
     swapOrientations();
     swapAngularMomenta();
     swapMomentsOfInertia();
@@ -3434,6 +3947,9 @@ void ParticleData::addParticlesGPU(const GlobalVector<detail::pdata_element>& in
         ArrayHandle<unsigned int> d_body(getBodies(),
                                          access_location::device,
                                          access_mode::readwrite);
+        ArrayHandle<unsigned int> d_group_flags(getGroupFlags(),
+                                                access_location::device,
+                                                access_mode::readwrite);
         ArrayHandle<Scalar4> d_orientation(getOrientationArray(),
                                            access_location::device,
                                            access_mode::readwrite);
@@ -3473,6 +3989,7 @@ void ParticleData::addParticlesGPU(const GlobalVector<detail::pdata_element>& in
                                         d_diameter.data,
                                         d_image.data,
                                         d_body.data,
+                                        d_group_flags.data,
                                         d_orientation.data,
                                         d_angmom.data,
                                         d_inertia.data,
@@ -32,6 +32,7 @@ __global__ void gpu_scatter_particle_data_kernel(const unsigned int nwork,
                                                  const Scalar* d_diameter,
                                                  const int3* d_image,
                                                  const unsigned int* d_body,
+                                                 const unsigned int* d_group_flags,
                                                  const Scalar4* d_orientation,
                                                  const Scalar4* d_angmom,
                                                  const Scalar3* d_inertia,
@@ -48,6 +49,7 @@ __global__ void gpu_scatter_particle_data_kernel(const unsigned int nwork,
                                                  Scalar* d_diameter_alt,
                                                  int3* d_image_alt,
                                                  unsigned int* d_body_alt,
+                                                 unsigned int* d_group_flags_alt,
                                                  Scalar4* d_orientation_alt,
                                                  Scalar4* d_angmom_alt,
                                                  Scalar3* d_inertia_alt,
@@ -81,6 +83,7 @@ __global__ void gpu_scatter_particle_data_kernel(const unsigned int nwork,
         p.diameter = d_diameter[idx];
         p.image = d_image[idx];
         p.body = d_body[idx];
+        p.group_flags = d_group_flags[idx];
         p.orientation = d_orientation[idx];
         p.angmom = d_angmom[idx];
         p.inertia = d_inertia[idx];
@@ -107,6 +110,7 @@ __global__ void gpu_scatter_particle_data_kernel(const unsigned int nwork,
         d_diameter_alt[scan_keep] = d_diameter[idx];
         d_image_alt[scan_keep] = d_image[idx];
         d_body_alt[scan_keep] = d_body[idx];
+        d_group_flags_alt[scan_keep] = d_group_flags[idx];
         d_orientation_alt[scan_keep] = d_orientation[idx];
         d_angmom_alt[scan_keep] = d_angmom[idx];
         d_inertia_alt[scan_keep] = d_inertia[idx];
@@ -141,6 +145,7 @@ gpu_select_sent_particles(unsigned int N, unsigned int* d_comm_flags, unsigned i
     \param d_diameter Device array of particle diameters
     \param d_image Device array of particle images
     \param d_body Device array of particle body tags
+    \param d_group_flags Device array of group membership flags
     \param d_orientation Device array of particle orientations
     \param d_angmom Device array of particle angular momenta
     \param d_inertia Device array of particle moments of inertia
@@ -157,6 +162,7 @@ gpu_select_sent_particles(unsigned int N, unsigned int* d_comm_flags, unsigned i
     \param d_diameter_alt Device array of particle diameters (output)
     \param d_image_alt Device array of particle images (output)
     \param d_body_alt Device array of particle body tags (output)
+    \param d_group_flags_alt Device array of group membership flags (output)
     \param d_orientation_alt Device array of particle orientations (output)
     \param d_angmom_alt Device array of particle angular momenta (output)
     \param d_inertia Device array of particle moments of inertia (output)
@@ -176,6 +182,7 @@ unsigned int gpu_pdata_remove(const unsigned int N,
                               const Scalar* d_diameter,
                               const int3* d_image,
                               const unsigned int* d_body,
+                              const unsigned int* d_group_flags,
                               const Scalar4* d_orientation,
                               const Scalar4* d_angmom,
                               const Scalar3* d_inertia,
@@ -192,6 +199,7 @@ unsigned int gpu_pdata_remove(const unsigned int N,
                               Scalar* d_diameter_alt,
                               int3* d_image_alt,
                               unsigned int* d_body_alt,
+                              unsigned int* d_group_flags_alt,
                               Scalar4* d_orientation_alt,
                               Scalar4* d_angmom_alt,
                               Scalar3* d_inertia_alt,
@@ -217,6 +225,7 @@ unsigned int gpu_pdata_remove(const unsigned int N,
     assert(d_diameter);
     assert(d_image);
     assert(d_body);
+    assert(d_group_flags);
     assert(d_orientation);
     assert(d_angmom);
     assert(d_inertia);
@@ -232,6 +241,7 @@ unsigned int gpu_pdata_remove(const unsigned int N,
     assert(d_diameter_alt);
     assert(d_image_alt);
     assert(d_body_alt);
+    assert(d_group_flags_alt);
     assert(d_orientation_alt);
     assert(d_angmom_alt);
     assert(d_inertia_alt);
@@ -313,6 +323,7 @@ unsigned int gpu_pdata_remove(const unsigned int N,
                                d_diameter,
                                d_image,
                                d_body,
+                               d_group_flags,
                                d_orientation,
                                d_angmom,
                                d_inertia,
@@ -329,6 +340,7 @@ unsigned int gpu_pdata_remove(const unsigned int N,
                                d_diameter_alt,
                                d_image_alt,
                                d_body_alt,
+                               d_group_flags_alt,
                                d_orientation_alt,
                                d_angmom_alt,
                                d_inertia_alt,
@@ -360,6 +372,7 @@ __global__ void gpu_pdata_add_particles_kernel(unsigned int old_nparticles,
                                                Scalar* d_diameter,
                                                int3* d_image,
                                                unsigned int* d_body,
+                                               unsigned int* d_group_flags,
                                                Scalar4* d_orientation,
                                                Scalar4* d_angmom,
                                                Scalar3* d_inertia,
@@ -387,6 +400,7 @@ __global__ void gpu_pdata_add_particles_kernel(unsigned int old_nparticles,
     d_diameter[add_idx] = p.diameter;
     d_image[add_idx] = p.image;
     d_body[add_idx] = p.body;
+    d_group_flags[add_idx] = p.group_flags;
     d_orientation[add_idx] = p.orientation;
     d_angmom[add_idx] = p.angmom;
     d_inertia[add_idx] = p.inertia;
@@ -408,6 +422,7 @@ __global__ void gpu_pdata_add_particles_kernel(unsigned int old_nparticles,
     \param d_diameter Device array of particle diameters
     \param d_image Device array of particle images
     \param d_body Device array of particle body tags
+    \param d_group_flags Device array of group membership flags
     \param d_orientation Device array of particle orientations
     \param d_angmom Device array of particle angular momenta
     \param d_inertia Device array of particle moments of inertia
@@ -428,6 +443,7 @@ void gpu_pdata_add_particles(const unsigned int old_nparticles,
                              Scalar* d_diameter,
                              int3* d_image,
                              unsigned int* d_body,
+                             unsigned int* d_group_flags,
                              Scalar4* d_orientation,
                              Scalar4* d_angmom,
                              Scalar3* d_inertia,
@@ -447,6 +463,7 @@ void gpu_pdata_add_particles(const unsigned int old_nparticles,
     assert(d_diameter);
     assert(d_image);
     assert(d_body);
+    assert(d_group_flags);
     assert(d_orientation);
     assert(d_angmom);
     assert(d_inertia);
@@ -474,6 +491,7 @@ void gpu_pdata_add_particles(const unsigned int old_nparticles,
                        d_diameter,
                        d_image,
                        d_body,
+                       d_group_flags,
                        d_orientation,
                        d_angmom,
                        d_inertia,
@@ -41,6 +41,7 @@ struct pdata_element
     Scalar diameter;      //!< Diameter
     int3 image;           //!< Image
     unsigned int body;    //!< Body id
+    unsigned int group_flags; //!< Group membership flags
     Scalar4 orientation;  //!< Orientation
     Scalar4 angmom;       //!< Angular momentum
     Scalar3 inertia;      //!< Moments of inertia
@@ -67,6 +68,7 @@ unsigned int gpu_pdata_remove(const unsigned int N,
                               const Scalar* d_diameter,
                               const int3* d_image,
                               const unsigned int* d_body,
+                              const unsigned int* d_group_flags,
                               const Scalar4* d_orientation,
                               const Scalar4* d_angmom,
                               const Scalar3* d_inertia,
@@ -83,6 +85,7 @@ unsigned int gpu_pdata_remove(const unsigned int N,
                               Scalar* d_diameter_alt,
                               int3* d_image_alt,
                               unsigned int* d_body_alt,
+                              unsigned int* d_group_flags_alt,
                               Scalar4* d_orientation_alt,
                               Scalar4* d_angmom_alt,
                               Scalar3* d_inertia_alt,
@@ -108,6 +111,7 @@ void gpu_pdata_add_particles(const unsigned int old_nparticles,
                              Scalar* d_diameter,
                              int3* d_image,
                              unsigned int* d_body,
+                             unsigned int* d_group_flags,
                              Scalar4* d_orientation,
                              Scalar4* d_angmom,
                              Scalar3* d_inertia,
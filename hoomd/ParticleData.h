@@ -45,6 +45,7 @@
 #include <stack>
 #include <stdlib.h>
 #include <string>
+#include <utility>
 #include <vector>
 
 /*! \ingroup hoomd_lib
@@ -105,6 +106,9 @@ const unsigned int MIN_FLOPPY = 0x80000000;
 //! processor
 const unsigned int NOT_LOCAL = 0xffffffff;
 
+//! Sentinel value returned by ParticleData::reserveGroupFlag() when all flags are in use
+const unsigned int NO_GROUP_FLAG = 0xffffffff;
+
     } // end namespace hoomd
 
 namespace hoomd
@@ -255,6 +259,7 @@ struct pdata_element
     Scalar diameter;      //!< Diameter
     int3 image;           //!< Image
     unsigned int body;    //!< Body id
+    unsigned int group_flags; //!< Group membership flags
     Scalar4 orientation;  //!< Orientation
     Scalar4 angmom;       //!< Angular momentum
     Scalar3 inertia;      //!< Principal moments of inertia
@@ -645,6 +650,37 @@ class PYBIND11_EXPORT ParticleData
         return m_body;
         }
 
+    //! Return the group membership flags
+    /*! Each bit of the flags of a particle stores its membership in one distributed ParticleGroup.
+        The flags migrate with the particles between ranks.
+    */
+    const GlobalArray<unsigned int>& getGroupFlags() const
+        {
+        return m_group_flags;
+        }
+
+    //! Reserve a bit in the group membership flags
+    /*! \returns The index of the reserved bit, or NO_GROUP_FLAG when all bits are in use
+     */
+    unsigned int reserveGroupFlag()
+        {
+        for (unsigned int bit = 0; bit < sizeof(unsigned int) * 8; bit++)
+            {
+            if (!(m_reserved_group_flags & (1u << bit)))
+                {
+                m_reserved_group_flags |= (1u << bit);
+                return bit;
+                }
+            }
+        return NO_GROUP_FLAG;
+        }
+
+    //! Release a bit in the group membership flags
+    void releaseGroupFlag(unsigned int bit)
+        {
+        m_reserved_group_flags &= ~(1u << bit);
+        }
+
     /*!
      * Access methods to stand-by arrays for fast swapping in of reordered particle data
      *
@@ -762,6 +798,18 @@ class PYBIND11_EXPORT ParticleData
         m_body.swap(m_body_alt);
         }
 
+    //! Return group membership flags (alternate array)
+    const GlobalArray<unsigned int>& getAltGroupFlags() const
+        {
+        return m_group_flags_alt;
+        }
+
+    //! Swap in group membership flags
+    inline void swapGroupFlags()
+        {
+        m_group_flags.swap(m_group_flags_alt);
+        }
+
     //! Get the net force array (alternate array)
     const GlobalArray<Scalar4>& getAltNetForce() const
         {
@@ -843,6 +891,25 @@ class PYBIND11_EXPORT ParticleData
     //! Notify listeners that the particles have been rearranged in memory
     void notifyParticleSort();
 
+    //! Notify listeners that the particles have been rearranged by a known permutation
+    void notifyParticleSort(const std::vector<std::pair<unsigned int, unsigned int>>& moved);
+
+    //! Check whether the most recent rearrangement published its permutation
+    bool hasSortPermutation() const
+        {
+        return m_sort_permutation_valid;
+        }
+
+    //! Get the (new index, old index) pairs of the local particles moved by the last rearrangement
+    /*! Listeners to the particle sort signal may read the permutation to remap data stored by
+        particle index instead of rebuilding it. Particles that are not listed kept their index.
+        The permutation is only meaningful when hasSortPermutation() is true.
+    */
+    const std::vector<std::pair<unsigned int, unsigned int>>& getSortPermutation() const
+        {
+        return m_sort_permutation;
+        }
+
     //! Connects a function to be called every time the box size is changed
     Nano::Signal<void()>& getBoxChangeSignal()
         {
@@ -1130,6 +1197,13 @@ class PYBIND11_EXPORT ParticleData
     void initializeFromSnapshot(const SnapshotParticleData<Real>& snapshot,
                                 bool ignore_bodies = false);
 
+#ifdef ENABLE_MPI
+    //! Initialize from blocks of particles held by all ranks
+    template<class Real>
+    void initializeFromDistributedSnapshot(const SnapshotParticleData<Real>& local_snapshot,
+                                           unsigned int first_tag);
+#endif
+
     //! Take a snapshot
     template<class Real> void takeSnapshot(SnapshotParticleData<Real>& snapshot);
 
@@ -1210,6 +1284,9 @@ class PYBIND11_EXPORT ParticleData
     //! Add a single particle to the simulation
     unsigned int addParticle(unsigned int type);
 
+    //! Add several particles to the simulation at once
+    std::vector<unsigned int> addNewParticles(const std::vector<unsigned int>& types);
+
     //! Remove a particle from the simulation
     void removeParticle(unsigned int tag);
 
@@ -1262,6 +1339,9 @@ class PYBIND11_EXPORT ParticleData
 
     Nano::Signal<void()>
         m_sort_signal; //!< Signal that is triggered when particles are sorted in memory
+    std::vector<std::pair<unsigned int, unsigned int>>
+        m_sort_permutation;                //!< (new, old) indices moved by the last sort
+    bool m_sort_permutation_valid = false; //!< True if m_sort_permutation describes the last sort
     Nano::Signal<void()> m_boxchange_signal; //!< Signal that is triggered when the box size changes
     Nano::Signal<void()> m_max_particle_num_signal; //!< Signal that is triggered when the maximum
                                                     //!< particle number changes
@@ -1291,6 +1371,8 @@ class PYBIND11_EXPORT ParticleData
     GlobalArray<unsigned int> m_tag;   //!< particle tags
     GlobalVector<unsigned int> m_rtag; //!< reverse lookup tags
     GlobalArray<unsigned int> m_body;  //!< rigid body ids
+    GlobalArray<unsigned int> m_group_flags; //!< group membership flags
+    unsigned int m_reserved_group_flags = 0; //!< Bits of m_group_flags in use
     GlobalArray<Scalar4>
         m_orientation; //!< Orientation quaternion for each particle (ignored if not anisotropic)
     GlobalArray<Scalar4> m_angmom;          //!< Angular momementum quaternion for each particle
@@ -1320,6 +1402,7 @@ class PYBIND11_EXPORT ParticleData
     GlobalArray<int3> m_image_alt;          //!< particle images (swap-in)
     GlobalArray<unsigned int> m_tag_alt;    //!< particle tags (swap-in)
     GlobalArray<unsigned int> m_body_alt;   //!< rigid body ids (swap-in)
+    GlobalArray<unsigned int> m_group_flags_alt; //!< group membership flags (swap-in)
     GlobalArray<Scalar4> m_orientation_alt; //!< orientations (swap-in)
     GlobalArray<Scalar4> m_angmom_alt;      //!< angular momenta (swap-in)
     GlobalArray<Scalar3>
@@ -1349,6 +1432,9 @@ class PYBIND11_EXPORT ParticleData
     unsigned int m_memory_advice_last_Nmax; //!< Nmax at which memory hints were last set
 #endif
 
+    //! Helper function to emit the particle sort signal
+    void emitParticleSort();
+
     //! Helper function to allocate particle data
     void allocate(unsigned int N);
 
@@ -1364,6 +1450,26 @@ class PYBIND11_EXPORT ParticleData
     //! Helper function to rebuild the active tag cache if necessary
     void maybe_rebuild_tag_cache();
 
+    /// Register the particle data arrays with the memory registry
+    void registerMemory();
+
+    /// Shrink the particle data arrays to the number of local and ghost particles
+    void trimMemory();
+
+#ifdef ENABLE_MPI
+    //! Helper function to fit the recursive bisection domains to the particles
+    void bisectDomains(const std::vector<Scalar3>& fractions);
+
+    //! Helper function to find the rank that owns a particle
+    unsigned int placeParticleInDomain(Scalar3& pos,
+                                       int3& img,
+                                       const unsigned int* cart_ranks,
+                                       unsigned int idx);
+
+    //! Helper function to collect the group flags of the current particles by tag
+    std::vector<unsigned int> collectGroupFlagsByTag(bool all_ranks);
+#endif
+
     //! Helper function to check that particles of a snapshot are in the box
     /*! \return true If and only if all particles are in the simulation box
      * \param Snapshot to check
@@ -41,6 +41,19 @@ ParticleGroup::ParticleGroup(std::shared_ptr<SystemDefinition> sysdef,
         m_gpu_partition = GPUPartition(m_exec_conf->getGPUIds());
 #endif
 
+#ifdef ENABLE_MPI
+    // store the membership with the particles when the system is decomposed
+    if (m_sysdef->isDomainDecomposed())
+        {
+        m_group_flag = m_pdata->reserveGroupFlag();
+        if (m_group_flag == NO_GROUP_FLAG)
+            {
+            m_exec_conf->msg->notice(2)
+                << "ParticleGroup: all group flags are in use, gathering member tags" << std::endl;
+            }
+        }
+#endif
+
     // update member tag arrays
     updateMemberTags(true);
 
@@ -163,6 +176,11 @@ ParticleGroup::~ParticleGroup()
     // first place
     if (m_pdata)
         {
+        if (isDistributed())
+            {
+            m_pdata->releaseGroupFlag(m_group_flag);
+            }
+
         m_pdata->getParticleSortSignal()
             .disconnect<ParticleGroup, &ParticleGroup::slotParticleSort>(this);
         m_pdata->getMaxParticleNumberChangeSignal()
@@ -176,6 +194,12 @@ ParticleGroup::~ParticleGroup()
  */
 void ParticleGroup::updateMemberTags(bool force_update)
     {
+    if (isDistributed())
+        {
+        updateMemberFlags(force_update);
+        return;
+        }
+
     if (m_selector && !(m_update_tags || force_update) && !m_warning_printed)
         {
         m_pdata->getExecConf()->msg->warning()
@@ -290,10 +314,165 @@ void ParticleGroup::updateMemberTags(bool force_update)
 #endif
     }
 
+/*! \param force_update If true, always evaluate the filter
+
+    Each rank evaluates the filter on its local particles and sets the group's bit in the particle
+    group flags. The global number of members is a reduction over the ranks.
+*/
+void ParticleGroup::updateMemberFlags(bool force_update)
+    {
+    if (!(m_update_tags || force_update) && !m_warning_printed)
+        {
+        m_pdata->getExecConf()->msg->warning()
+            << "Particle number change but group is static. Create group with update=True if it "
+               "should be updated."
+            << std::endl
+            << "This warning is printed only once." << std::endl;
+        m_warning_printed = true;
+        }
+
+    const unsigned int mask = 1u << m_group_flag;
+
+    if (m_update_tags || force_update)
+        {
+        m_pdata->getExecConf()->msg->notice(7)
+            << "ParticleGroup: updating member flags" << std::endl;
+
+        vector<unsigned int> member_tags = m_selector->getSelectedTags(m_sysdef);
+
+        ArrayHandle<unsigned int> h_group_flags(m_pdata->getGroupFlags(),
+                                                access_location::host,
+                                                access_mode::readwrite);
+        ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(),
+                                         access_location::host,
+                                         access_mode::read);
+
+        for (unsigned int idx = 0; idx < m_pdata->getN(); idx++)
+            {
+            h_group_flags.data[idx] &= ~mask;
+            }
+
+        // filters may return tags of particles owned by other ranks, skip those
+        for (unsigned int tag : member_tags)
+            {
+            unsigned int idx = h_rtag.data[tag];
+            if (idx >= m_pdata->getN())
+                continue;
+            h_group_flags.data[idx] |= mask;
+            }
+        }
+
+    // the members may have changed, gather the tags again when needed
+    m_member_tags_gathered = false;
+
+    // the local members are bounded by the number of local particles
+    GlobalArray<unsigned int> is_member(m_pdata->getMaxN(), m_pdata->getExecConf());
+    m_is_member.swap(is_member);
+    TAG_ALLOCATION(m_is_member);
+
+    GlobalArray<unsigned int> member_idx(m_pdata->getMaxN(), m_pdata->getExecConf());
+    m_member_idx.swap(member_idx);
+    TAG_ALLOCATION(m_member_idx);
+
+    rebuildIndexList();
+
+    // count the members and the central and free particles in the group
+    unsigned int counts[2] = {m_num_local_members, 0};
+        {
+        ArrayHandle<unsigned int> h_tag(m_pdata->getTags(),
+                                        access_location::host,
+                                        access_mode::read);
+        ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
+                                         access_location::host,
+                                         access_mode::read);
+        ArrayHandle<unsigned int> h_group_flags(m_pdata->getGroupFlags(),
+                                                access_location::host,
+                                                access_mode::read);
+        for (unsigned int i = 0; i < m_pdata->getN(); i++)
+            {
+            unsigned int tag = h_tag.data[i];
+            unsigned int body = h_body.data[i];
+
+            if ((h_group_flags.data[i] & mask) && (body == tag || body > MIN_FLOPPY))
+                {
+                counts[1]++;
+                }
+            }
+        }
+
+#ifdef ENABLE_MPI
+    MPI_Allreduce(MPI_IN_PLACE,
+                  counts,
+                  2,
+                  MPI_UNSIGNED,
+                  MPI_SUM,
+                  m_exec_conf->getMPICommunicator());
+#endif
+
+    m_num_members_global = counts[0];
+    m_n_central_and_free_global = counts[1];
+    }
+
+/*! The tags of the local members are gathered from all ranks and sorted. This is a collective
+    call for groups with distributed membership and does nothing for other groups.
+*/
+void ParticleGroup::gatherMemberTags()
+    {
+    if (!isDistributed() || m_member_tags_gathered)
+        return;
+
+    checkRebuild();
+
+    std::vector<unsigned int> member_tags(m_num_local_members);
+        {
+        ArrayHandle<unsigned int> h_tag(m_pdata->getTags(),
+                                        access_location::host,
+                                        access_mode::read);
+        ArrayHandle<unsigned int> h_member_idx(m_member_idx,
+                                               access_location::host,
+                                               access_mode::read);
+        for (unsigned int i = 0; i < m_num_local_members; i++)
+            {
+            member_tags[i] = h_tag.data[h_member_idx.data[i]];
+            }
+        }
+
+#ifdef ENABLE_MPI
+    std::vector<std::vector<unsigned int>> member_tags_proc(m_exec_conf->getNRanks());
+    all_gather_v(member_tags, member_tags_proc, m_exec_conf->getMPICommunicator());
+
+    member_tags.clear();
+    for (const auto& tags : member_tags_proc)
+        {
+        member_tags.insert(member_tags.end(), tags.begin(), tags.end());
+        }
+#endif
+
+    std::sort(member_tags.begin(), member_tags.end());
+
+    GlobalArray<unsigned int> member_tags_array(member_tags.size(), m_pdata->getExecConf());
+    m_member_tags.swap(member_tags_array);
+    TAG_ALLOCATION(m_member_tags);
+        {
+        ArrayHandle<unsigned int> h_member_tags(m_member_tags,
+                                                access_location::host,
+                                                access_mode::overwrite);
+        std::copy(member_tags.begin(), member_tags.end(), h_member_tags.data);
+        }
+
+    m_member_tags_gathered = true;
+    }
+
 void ParticleGroup::reallocate()
     {
     m_is_member.resize(m_pdata->getMaxN());
 
+    if (isDistributed())
+        {
+        m_member_idx.resize(m_pdata->getMaxN());
+        return;
+        }
+
     if (m_is_member_tag.getNumElements() != m_pdata->getRTags().size())
         {
         // reallocate if necessary
@@ -369,6 +548,9 @@ std::shared_ptr<ParticleGroup> ParticleGroup::groupUnion(std::shared_ptr<Particl
     // vector to store the new list of tags
     vector<unsigned int> member_tags;
 
+    a->gatherMemberTags();
+    b->gatherMemberTags();
+
     if (a != b)
         {
         unsigned int n_a = a->getNumMembersGlobal();
@@ -422,6 +604,9 @@ std::shared_ptr<ParticleGroup> ParticleGroup::groupIntersection(std::shared_ptr<
     // vector to store the new list of tags
     vector<unsigned int> member_tags;
 
+    a->gatherMemberTags();
+    b->gatherMemberTags();
+
     if (a != b)
         {
         unsigned int n_a = a->getNumMembersGlobal();
@@ -474,6 +659,9 @@ std::shared_ptr<ParticleGroup> ParticleGroup::groupDifference(std::shared_ptr<Pa
     // vector to store the new list of tags
     vector<unsigned int> member_tags;
 
+    a->gatherMemberTags();
+    b->gatherMemberTags();
+
     if (a != b)
         {
         unsigned int n_a = a->getNumMembersGlobal();
@@ -559,12 +747,23 @@ void ParticleGroup::rebuildIndexList()
         ArrayHandle<unsigned int> h_member_idx(m_member_idx,
                                                access_location::host,
                                                access_mode::readwrite);
+        ArrayHandle<unsigned int> h_group_flags(m_pdata->getGroupFlags(),
+                                                access_location::host,
+                                                access_mode::read);
         unsigned int nparticles = m_pdata->getN();
         unsigned int cur_member = 0;
         for (unsigned int idx = 0; idx < nparticles; idx++)
             {
-            assert(h_tag.data[idx] <= m_pdata->getMaximumTag());
-            unsigned int is_member = h_is_member_tag.data[h_tag.data[idx]];
+            unsigned int is_member;
+            if (isDistributed())
+                {
+                is_member = (h_group_flags.data[idx] >> m_group_flag) & 1;
+                }
+            else
+                {
+                assert(h_tag.data[idx] <= m_pdata->getMaximumTag());
+                is_member = h_is_member_tag.data[h_tag.data[idx]];
+                }
             h_is_member.data[idx] = is_member;
             if (is_member)
                 {
@@ -574,7 +773,7 @@ void ParticleGroup::rebuildIndexList()
             }
 
         m_num_local_members = cur_member;
-        assert(m_num_local_members <= m_member_tags.getNumElements());
+        assert(isDistributed() || m_num_local_members <= m_member_tags.getNumElements());
         }
 
     // index has been rebuilt
@@ -589,6 +788,55 @@ void ParticleGroup::rebuildIndexList()
 #endif
     }
 
+/*! \returns true when the index lists were remapped, false when they need to be rebuilt
+
+    Particles keep their group membership when they are sorted, so the membership flags of the
+    moved particles are permuted and the member list is compacted from the flags. This avoids the
+    lookup of every particle tag in rebuildIndexList().
+*/
+bool ParticleGroup::remapIndexList()
+    {
+    if (!m_pdata->hasSortPermutation())
+        return false;
+
+#ifdef ENABLE_HIP
+    if (m_exec_conf->isCUDAEnabled())
+        return false;
+#endif
+
+    const std::vector<std::pair<unsigned int, unsigned int>>& moved
+        = m_pdata->getSortPermutation();
+    if (moved.empty())
+        return true;
+
+    ArrayHandle<unsigned int> h_is_member(m_is_member,
+                                          access_location::host,
+                                          access_mode::readwrite);
+    ArrayHandle<unsigned int> h_member_idx(m_member_idx,
+                                           access_location::host,
+                                           access_mode::readwrite);
+
+    std::vector<unsigned int> is_member(moved.size());
+    for (size_t k = 0; k < moved.size(); k++)
+        is_member[k] = h_is_member.data[moved[k].second];
+    for (size_t k = 0; k < moved.size(); k++)
+        h_is_member.data[moved[k].first] = is_member[k];
+
+    unsigned int nparticles = m_pdata->getN();
+    unsigned int cur_member = 0;
+    for (unsigned int idx = 0; idx < nparticles; idx++)
+        {
+        if (h_is_member.data[idx])
+            {
+            h_member_idx.data[cur_member] = idx;
+            cur_member++;
+            }
+        }
+    assert(cur_member == m_num_local_members);
+
+    return true;
+    }
+
 void ParticleGroup::updateGPUAdvice()
     {
 #if defined(ENABLE_HIP) && defined(__HIP_PLATFORM_NVCC__)
@@ -646,7 +894,28 @@ void ParticleGroup::rebuildIndexListGPU()
                                          m_pdata->getN());
 
     // reset membership properties
-    if (m_member_tags.getNumElements() > 0)
+    if (isDistributed())
+        {
+        ArrayHandle<unsigned int> d_group_flags(m_pdata->getGroupFlags(),
+                                                access_location::device,
+                                                access_mode::read);
+        kernel::gpu_rebuild_index_list_flags(m_pdata->getN(),
+                                             d_group_flags.data,
+                                             m_group_flag,
+                                             d_is_member.data);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+
+        kernel::gpu_compact_index_list(m_pdata->getN(),
+                                       d_is_member.data,
+                                       d_member_idx.data,
+                                       m_num_local_members,
+                                       d_tmp.data,
+                                       m_pdata->getExecConf()->getCachedAllocator());
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+    else if (m_member_tags.getNumElements() > 0)
         {
         kernel::gpu_rebuild_index_list(m_pdata->getN(),
                                        d_is_member_tag.data,
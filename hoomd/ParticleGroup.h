@@ -73,6 +73,16 @@ namespace hoomd
    particle in the group. For that it needs a list of indices of all the particles in the group. To
    facilitates this, the list of indices in the group will be stored in a GPUArray.
 
+    <b>Distributed membership</b>
+
+    In domain decomposed simulations, a group selected by a ParticleFilter stores its membership in
+   one bit of the per-particle group flags of ParticleData (see ParticleData::getGroupFlags()). The
+   flags migrate with the particles, so each rank only evaluates the filter on its local particles
+   and the index list is rebuilt locally after sorts and migrations. The global number of members is
+   a scalar reduction. The sorted list of member tags is only gathered from all ranks when a caller
+   needs it (getMemberTag(), getMemberTags(), and the combination methods). When all bits of the
+   group flags are in use, the group falls back to storing the global list of member tags.
+
     \ingroup data_structs
 */
 class PYBIND11_EXPORT ParticleGroup
@@ -112,6 +122,9 @@ class PYBIND11_EXPORT ParticleGroup
         {
         checkRebuild();
 
+        if (isDistributed())
+            return m_num_members_global;
+
         return (unsigned int)m_member_tags.getNumElements();
         }
 
@@ -132,6 +145,7 @@ class PYBIND11_EXPORT ParticleGroup
     unsigned int getMemberTag(unsigned int i)
         {
         checkRebuild();
+        gatherMemberTags();
 
         assert(i < getNumMembersGlobal());
         ArrayHandle<unsigned int> h_member_tags(m_member_tags,
@@ -140,6 +154,18 @@ class PYBIND11_EXPORT ParticleGroup
         return h_member_tags.data[i];
         }
 
+    //! Gather the sorted list of member tags from all ranks
+    /*! Groups with distributed membership only gather the member tags when needed. All ranks must
+        call this method before a single rank calls getMemberTag().
+    */
+    void gatherMemberTags();
+
+    //! Test if the group stores its membership in the particle group flags
+    bool isDistributed() const
+        {
+        return m_group_flag != NO_GROUP_FLAG;
+        }
+
     //! Get a member index from the group
     /*! \param j Value from 0 to getNumMembers()-1 of the group member to get
         \returns Index of the member at position \a j
@@ -251,8 +277,10 @@ class PYBIND11_EXPORT ParticleGroup
     /// Get a NumPy array of the the local member tags.
     /** This is necessary to enable testing in Python the updating of ParticleGroup instances.
      */
-    pybind11::array_t<unsigned int> getMemberTags() const
+    pybind11::array_t<unsigned int> getMemberTags()
         {
+        gatherMemberTags();
+
         const ArrayHandle<unsigned int> h_member_tags(m_member_tags,
                                                       access_location::host,
                                                       access_mode::read);
@@ -320,6 +348,18 @@ class PYBIND11_EXPORT ParticleGroup
     /// Number of central and free particles in the group (global)
     unsigned int m_n_central_and_free_global = 0;
 
+    /// Bit of the particle group flags that stores the membership (NO_GROUP_FLAG if not used)
+    unsigned int m_group_flag = NO_GROUP_FLAG;
+
+    /// Number of members in the group (global, distributed membership only)
+    unsigned int m_num_members_global = 0;
+
+    /// True when m_member_tags lists all members (distributed membership only)
+    bool m_member_tags_gathered = false;
+
+    //! Helper function to select the members when membership is distributed
+    void updateMemberFlags(bool force_update);
+
     //! Helper function to resize array of member tags
     void reallocate();
 
@@ -359,10 +399,17 @@ class PYBIND11_EXPORT ParticleGroup
         m_reallocated = true;
         }
 
+    //! Helper function to remap the index lists with the permutation published by the sort
+    bool remapIndexList();
+
     //! Helper function to be called when the particles are resorted
     void slotParticleSort()
         {
-        m_particles_sorted = true;
+        // remap the index list when it is up to date and the sort published its permutation
+        if (m_particles_sorted || m_reallocated || m_global_ptl_num_change || !remapIndexList())
+            {
+            m_particles_sorted = true;
+            }
         }
 
     //! Update the GPU memory advice
@@ -0,0 +1,453 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file Profiler.cc
+    \brief Defines the Profiler class
+*/
+
+#include "Profiler.h"
+
+#ifdef ENABLE_MPI
+#include "HOOMDMPI.h"
+#endif
+
+#include <atomic>
+#include <cstdlib>
+#include <cxxabi.h>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace hoomd
+    {
+namespace
+    {
+/// Source of unique buffer generations
+std::atomic<uint64_t> s_next_generation(0);
+
+/// No parent region
+const uint64_t NO_PARENT = 0xffffffff;
+
+/// Escape a string for use in a JSON document
+std::string escapeJSON(const std::string& s)
+    {
+    std::string result;
+    result.reserve(s.size());
+    for (char c : s)
+        {
+        if (c == '"' || c == '\\')
+            {
+            result.push_back('\\');
+            }
+        result.push_back(c);
+        }
+    return result;
+    }
+    } // end anonymous namespace
+
+/** @param mpi_config MPI configuration used to reduce totals and gather trace events
+
+    All ranks of the partition must construct the profiler together.
+*/
+Profiler::Profiler(std::shared_ptr<MPIConfiguration> mpi_config)
+    : m_mpi_config(mpi_config), m_generation(s_next_generation++)
+    {
+    resetEpoch();
+    }
+
+/** The ranks take their time origin as they leave a common barrier, so the trace timestamps of
+    all ranks line up to within the barrier exit skew. steady_clock values are not comparable
+    between nodes, so broadcasting the time of the root would not give a common origin.
+*/
+void Profiler::resetEpoch()
+    {
+    m_mpi_config->barrier();
+    m_epoch = std::chrono::steady_clock::now();
+    }
+
+/** @param capacity Number of events to keep per thread
+
+    Resets the recorded events.
+*/
+void Profiler::setTraceCapacity(unsigned int capacity)
+    {
+    if (capacity == 0)
+        {
+        throw std::domain_error("trace_capacity must be positive.");
+        }
+
+    m_trace_capacity = capacity;
+    reset();
+    }
+
+/** Discards the buffers of all threads and sets a new common time origin. All ranks of the
+    partition must call this method.
+*/
+void Profiler::reset()
+    {
+        {
+        std::lock_guard<std::mutex> lock(m_buffers_mutex);
+        m_buffers.clear();
+        m_generation = s_next_generation++;
+        }
+    resetEpoch();
+    }
+
+/** Each thread caches the buffer of the profiler it recorded into last, keyed by the generation of
+    the buffers. reset() and the destruction of a profiler retire their generation, so a thread
+    never uses a cached buffer after it is discarded and the cache holds no stale entries.
+*/
+Profiler::ThreadBuffer& Profiler::getThreadBuffer()
+    {
+    thread_local uint64_t cached_generation = UINT64_MAX;
+    thread_local ThreadBuffer* cached_buffer = nullptr;
+
+    if (cached_generation == m_generation)
+        {
+        return *cached_buffer;
+        }
+
+    std::lock_guard<std::mutex> lock(m_buffers_mutex);
+    const std::thread::id owner = std::this_thread::get_id();
+    ThreadBuffer* buffer = nullptr;
+    for (auto& thread_buffer : m_buffers)
+        {
+        if (thread_buffer->owner == owner)
+            {
+            buffer = thread_buffer.get();
+            break;
+            }
+        }
+
+    if (!buffer)
+        {
+        m_buffers.push_back(std::make_unique<ThreadBuffer>());
+        buffer = m_buffers.back().get();
+        buffer->owner = owner;
+        buffer->thread_id = static_cast<unsigned int>(m_buffers.size() - 1);
+        }
+
+    cached_generation = m_generation;
+    cached_buffer = buffer;
+    return *buffer;
+    }
+
+/** @param buffer Buffer of the calling thread
+    @param name Index of the region name in the buffer
+
+    Regions are keyed by their parent region and name, so entering a known region does not build
+    its path or allocate.
+*/
+void Profiler::pushName(ThreadBuffer& buffer, unsigned int name)
+    {
+    const uint64_t parent = buffer.stack.empty() ? NO_PARENT : buffer.stack.back();
+    const uint64_t key = (parent << 32) | name;
+
+    unsigned int index;
+    auto it = buffer.children.find(key);
+    if (it == buffer.children.end())
+        {
+        index = static_cast<unsigned int>(buffer.paths.size());
+        buffer.children.emplace(key, index);
+        buffer.paths.push_back(buffer.stack.empty()
+                                   ? buffer.names[name]
+                                   : buffer.paths[parent] + "/" + buffer.names[name]);
+        buffer.totals.push_back(ProfileTotals());
+        }
+    else
+        {
+        index = it->second;
+        }
+
+    buffer.stack.push_back(index);
+    buffer.stack_start.push_back(now());
+    }
+
+/** @param name Name of the region
+ */
+void Profiler::push(std::string_view name)
+    {
+    ThreadBuffer& buffer = getThreadBuffer();
+
+    auto it = buffer.name_index.find(name);
+    if (it == buffer.name_index.end())
+        {
+        const unsigned int index = static_cast<unsigned int>(buffer.names.size());
+        buffer.names.emplace_back(name);
+        it = buffer.name_index.emplace(buffer.names.back(), index).first;
+        }
+
+    pushName(buffer, it->second);
+    }
+
+/** @param type Type of the profiled object
+
+    Demangled type names are cached per thread.
+*/
+void Profiler::push(const std::type_info& type)
+    {
+    ThreadBuffer& buffer = getThreadBuffer();
+
+    auto it = buffer.type_names.find(std::type_index(type));
+    if (it == buffer.type_names.end())
+        {
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(type.name(), nullptr, nullptr, &status);
+        std::string name = (status == 0 && demangled) ? std::string(demangled) : type.name();
+        free(demangled);
+
+        auto name_it = buffer.name_index.find(name);
+        if (name_it == buffer.name_index.end())
+            {
+            const unsigned int index = static_cast<unsigned int>(buffer.names.size());
+            buffer.names.push_back(name);
+            name_it = buffer.name_index.emplace(name, index).first;
+            }
+        it = buffer.type_names.emplace(std::type_index(type), name_it->second).first;
+        }
+
+    pushName(buffer, it->second);
+    }
+
+void Profiler::pop()
+    {
+    const int64_t end = now();
+    ThreadBuffer& buffer = getThreadBuffer();
+
+    if (buffer.stack.empty())
+        {
+        throw std::runtime_error("Profiler region closed without a matching open.");
+        }
+
+    Event event;
+    event.path = buffer.stack.back();
+    event.depth = static_cast<unsigned int>(buffer.stack.size() - 1);
+    event.start = buffer.stack_start.back();
+    event.duration = end - event.start;
+    buffer.stack.pop_back();
+    buffer.stack_start.pop_back();
+
+    ProfileTotals& totals = buffer.totals[event.path];
+    totals.seconds += double(event.duration) * 1e-9;
+    totals.count++;
+
+    // overwrite the oldest event once the ring buffer is full
+    if (buffer.events.size() < m_trace_capacity)
+        {
+        buffer.events.push_back(event);
+        }
+    else
+        {
+        buffer.events[buffer.next_event] = event;
+        }
+    buffer.next_event = (buffer.next_event + 1) % m_trace_capacity;
+    buffer.n_events++;
+    }
+
+/** @returns The totals of all regions recorded by all threads on this rank.
+ */
+std::map<std::string, ProfileTotals> Profiler::getTotals() const
+    {
+    std::map<std::string, ProfileTotals> result;
+
+    std::lock_guard<std::mutex> lock(m_buffers_mutex);
+    for (const auto& buffer : m_buffers)
+        {
+        for (size_t i = 0; i < buffer->paths.size(); i++)
+            {
+            if (buffer->totals[i].count == 0)
+                continue;
+
+            ProfileTotals& totals = result[buffer->paths[i]];
+            totals.seconds += buffer->totals[i].seconds;
+            totals.count += buffer->totals[i].count;
+            }
+        }
+
+    return result;
+    }
+
+pybind11::dict Profiler::getTotalsPython() const
+    {
+    pybind11::dict result;
+    for (const auto& [path, totals] : getTotals())
+        {
+        result[pybind11::str(path)] = totals.seconds;
+        }
+    return result;
+    }
+
+pybind11::dict Profiler::getCountsPython() const
+    {
+    pybind11::dict result;
+    for (const auto& [path, totals] : getTotals())
+        {
+        result[pybind11::str(path)] = totals.count;
+        }
+    return result;
+    }
+
+/** @param maximum Set to true to compute the maximum, false to compute the minimum
+    @returns The minimum or maximum total of each region over the ranks of the partition.
+
+    A region that a rank never entered counts as 0 on that rank. All ranks must call this method.
+*/
+std::map<std::string, double> Profiler::reduceTotals(bool maximum) const
+    {
+    std::map<std::string, double> local;
+    for (const auto& [path, totals] : getTotals())
+        {
+        local[path] = totals.seconds;
+        }
+
+#ifdef ENABLE_MPI
+    if (m_mpi_config->getNRanks() > 1)
+        {
+        std::vector<std::map<std::string, double>> all_totals;
+        all_gather_v(local, all_totals, m_mpi_config->getCommunicator());
+
+        std::map<std::string, double> result;
+        for (const auto& rank_totals : all_totals)
+            {
+            for (const auto& [path, seconds] : rank_totals)
+                {
+                result[path] = 0.0;
+                }
+            }
+
+        for (auto& [path, value] : result)
+            {
+            bool first = true;
+            for (const auto& rank_totals : all_totals)
+                {
+                auto it = rank_totals.find(path);
+                double seconds = it == rank_totals.end() ? 0.0 : it->second;
+                if (first || (maximum && seconds > value) || (!maximum && seconds < value))
+                    {
+                    value = seconds;
+                    first = false;
+                    }
+                }
+            }
+
+        return result;
+        }
+#endif
+
+    return local;
+    }
+
+pybind11::dict Profiler::getMinTotalsPython() const
+    {
+    pybind11::dict result;
+    for (const auto& [path, seconds] : reduceTotals(false))
+        {
+        result[pybind11::str(path)] = seconds;
+        }
+    return result;
+    }
+
+pybind11::dict Profiler::getMaxTotalsPython() const
+    {
+    pybind11::dict result;
+    for (const auto& [path, seconds] : reduceTotals(true))
+        {
+        result[pybind11::str(path)] = seconds;
+        }
+    return result;
+    }
+
+/** @param filename Name of the file to write
+
+    Write the events kept in the ring buffers of all threads on all ranks as complete ("X") events
+    in the Chrome trace event format. The process id of an event is the MPI rank. All ranks must
+    call this method and the root rank writes the file.
+*/
+void Profiler::writeTrace(const std::string& filename) const
+    {
+    const unsigned int rank = m_mpi_config->getRank();
+
+    std::ostringstream s;
+    bool first = true;
+        {
+        std::lock_guard<std::mutex> lock(m_buffers_mutex);
+        for (const auto& buffer : m_buffers)
+            {
+            // walk the ring buffer from the oldest event to the newest
+            const size_t n = buffer->events.size();
+            const size_t oldest = n < m_trace_capacity ? 0 : buffer->next_event;
+            for (size_t k = 0; k < n; k++)
+                {
+                const Event& event = buffer->events[(oldest + k) % n];
+                if (!first)
+                    {
+                    s << ",\n";
+                    }
+                first = false;
+
+                s << "{\"name\":\"" << escapeJSON(buffer->paths[event.path]) << "\","
+                  << "\"ph\":\"X\","
+                  << "\"ts\":" << double(event.start) * 1e-3 << ","
+                  << "\"dur\":" << double(event.duration) * 1e-3 << ","
+                  << "\"pid\":" << rank << ","
+                  << "\"tid\":" << buffer->thread_id << ","
+                  << "\"args\":{\"depth\":" << event.depth << "}}";
+                }
+            }
+        }
+
+    std::vector<std::string> all_events(1, s.str());
+#ifdef ENABLE_MPI
+    if (m_mpi_config->getNRanks() > 1)
+        {
+        std::string local_events = s.str();
+        gather_v(local_events, all_events, 0, m_mpi_config->getCommunicator());
+        }
+#endif
+
+    if (rank != 0)
+        {
+        return;
+        }
+
+    std::ofstream f(filename);
+    if (!f.good())
+        {
+        throw std::runtime_error("Unable to open " + filename + " for writing.");
+        }
+
+    f << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first_rank = true;
+    for (const auto& events : all_events)
+        {
+        if (events.empty())
+            continue;
+
+        if (!first_rank)
+            {
+            f << ",\n";
+            }
+        first_rank = false;
+        f << events;
+        }
+    f << "\n]}\n";
+    }
+
+namespace detail
+    {
+void export_Profiler(pybind11::module& m)
+    {
+    pybind11::class_<Profiler, std::shared_ptr<Profiler>>(m, "Profiler")
+        .def_property("enabled", &Profiler::getEnabled, &Profiler::setEnabled)
+        .def_property("trace_capacity", &Profiler::getTraceCapacity, &Profiler::setTraceCapacity)
+        .def("reset", &Profiler::reset)
+        .def("writeTrace", &Profiler::writeTrace)
+        .def_property_readonly("totals", &Profiler::getTotalsPython)
+        .def_property_readonly("counts", &Profiler::getCountsPython)
+        .def_property_readonly("min_totals", &Profiler::getMinTotalsPython)
+        .def_property_readonly("max_totals", &Profiler::getMaxTotalsPython);
+    }
+
+    } // end namespace detail
+
+    } // end namespace hoomd
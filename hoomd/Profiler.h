@@ -0,0 +1,384 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file Profiler.h
+    \brief Declares the Profiler class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#pragma once
+
+#include "MPIConfiguration.h"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+/// Accumulated wall clock time of one profiled region
+struct ProfileTotals
+    {
+    /// Total time spent in the region [s]
+    double seconds = 0.0;
+
+    /// Number of times the region was entered
+    uint64_t count = 0;
+    };
+
+/// Hierarchical wall clock profiler for simulation operations
+/** Profiler records the time spent in nested regions of the run loop. Regions are opened and
+    closed with ScopedProfile, which System::run, ForceCompute::compute, NeighborList::compute, and
+    Communicator::communicate place around each operation. A region's name is the path of the
+    regions enclosing it joined with '/', so the time spent in a neighbor list that is computed by
+    a pair force is reported separately from the neighbor list time of a second pair force.
+
+    Profiling is disabled by default. When disabled, opening a region costs a single branch.
+    When enabled, each thread records the regions it closes in its own buffer without locking:
+    a table of accumulated totals per region and a fixed-capacity ring buffer of the most recent
+    events. The ring buffer is only needed for trace export and keeps the memory use bounded in
+    long runs.
+
+    Totals are available per rank or reduced over the MPI ranks of the partition (minimum and
+    maximum), which exposes load imbalance between domains. writeTrace() writes the events from
+    all ranks to a Chrome trace event JSON file that Perfetto and chrome://tracing can display.
+
+    Query the profiler only between runs. The per-thread buffers are not synchronized with threads
+    that are recording events.
+*/
+class PYBIND11_EXPORT Profiler
+    {
+    public:
+    /// Constructor
+    Profiler(std::shared_ptr<MPIConfiguration> mpi_config);
+
+    /// Get whether profiling is enabled
+    bool getEnabled() const
+        {
+        return m_enabled;
+        }
+
+    /// Enable or disable profiling
+    void setEnabled(bool enabled)
+        {
+        m_enabled = enabled;
+        }
+
+    /// Get the number of events kept per thread for trace export
+    unsigned int getTraceCapacity() const
+        {
+        return m_trace_capacity;
+        }
+
+    /// Set the number of events kept per thread for trace export
+    void setTraceCapacity(unsigned int capacity);
+
+    /// Discard all recorded totals and events
+    void reset();
+
+    /// Open a region
+    void push(std::string_view name);
+
+    /// Open a region named after a C++ type
+    void push(const std::type_info& type);
+
+    /// Close the most recently opened region
+    void pop();
+
+    /// Get the totals recorded on this rank
+    std::map<std::string, ProfileTotals> getTotals() const;
+
+    /// Get the total time of each region on this rank [s]
+    pybind11::dict getTotalsPython() const;
+
+    /// Get the number of times each region was entered on this rank
+    pybind11::dict getCountsPython() const;
+
+    /// Get the minimum total time of each region over all ranks [s]
+    pybind11::dict getMinTotalsPython() const;
+
+    /// Get the maximum total time of each region over all ranks [s]
+    pybind11::dict getMaxTotalsPython() const;
+
+    /// Write the recorded events to a Chrome trace event file
+    void writeTrace(const std::string& filename) const;
+
+    /// Get whether any operation requested compute time measurements
+    bool getComputeTimeEnabled() const
+        {
+        return m_compute_time_requests > 0;
+        }
+
+    /// Request (or release a request for) compute time measurements
+    void requestComputeTime(bool request)
+        {
+        if (request)
+            {
+            m_compute_time_requests++;
+            }
+        else if (m_compute_time_requests > 0)
+            {
+            m_compute_time_requests--;
+            }
+        }
+
+    /// Get the compute time measured on this rank since the last reset [s]
+    double getComputeTime() const
+        {
+        return m_compute_time;
+        }
+
+    /// Discard the measured compute time
+    void resetComputeTime()
+        {
+        m_compute_time = 0.0;
+        }
+
+    /// Enter a compute region (returns false when nested in another compute region)
+    bool beginCompute()
+        {
+        if (m_in_compute)
+            {
+            return false;
+            }
+        m_in_compute = true;
+        return true;
+        }
+
+    /// Leave the outermost compute region
+    void endCompute(double seconds)
+        {
+        m_in_compute = false;
+        m_compute_time += seconds;
+        }
+
+    private:
+    /// A closed region
+    struct Event
+        {
+        /// Index of the region path in the thread's path table
+        unsigned int path;
+
+        /// Nesting depth of the region
+        unsigned int depth;
+
+        /// Time the region was opened [ns since the common time origin of the partition]
+        int64_t start;
+
+        /// Duration of the region [ns]
+        int64_t duration;
+        };
+
+    /// Profiling data recorded by one thread
+    struct ThreadBuffer
+        {
+        /// Thread that records into this buffer
+        std::thread::id owner;
+
+        /// Region names seen by this thread
+        std::vector<std::string> names;
+
+        /// Map region names to indices in names
+        std::map<std::string, unsigned int, std::less<>> name_index;
+
+        /// Map types to the indices of their demangled names in names
+        std::unordered_map<std::type_index, unsigned int> type_names;
+
+        /// Region paths seen by this thread
+        std::vector<std::string> paths;
+
+        /// Map a parent path index (upper 32 bits) and a name index (lower 32 bits) to a path index
+        std::unordered_map<uint64_t, unsigned int> children;
+
+        /// Totals of each region (indexed like paths)
+        std::vector<ProfileTotals> totals;
+
+        /// Indices of the currently open regions
+        std::vector<unsigned int> stack;
+
+        /// Start times of the currently open regions
+        std::vector<int64_t> stack_start;
+
+        /// Ring buffer of the most recent events
+        std::vector<Event> events;
+
+        /// Index of the next event to write in the ring buffer
+        size_t next_event = 0;
+
+        /// Total number of events recorded
+        uint64_t n_events = 0;
+
+        /// Index of the thread for trace export
+        unsigned int thread_id = 0;
+        };
+
+    /// Get the buffer of the calling thread
+    ThreadBuffer& getThreadBuffer();
+
+    /// Open the region with the given name index
+    void pushName(ThreadBuffer& buffer, unsigned int name);
+
+    /// Set a common time origin on all ranks of the partition
+    void resetEpoch();
+
+    /// Current time [ns since the time origin]
+    int64_t now() const
+        {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now() - m_epoch)
+            .count();
+        }
+
+    /// Reduce the totals over all ranks
+    std::map<std::string, double> reduceTotals(bool maximum) const;
+
+    /// MPI configuration
+    std::shared_ptr<MPIConfiguration> m_mpi_config;
+
+    /// True when profiling is enabled
+    bool m_enabled = false;
+
+    /// Number of events kept per thread
+    unsigned int m_trace_capacity = 65536;
+
+    /// Unique identifier of this profiler and its current buffers (changes on reset)
+    uint64_t m_generation;
+
+    /// Time origin
+    std::chrono::steady_clock::time_point m_epoch;
+
+    /// Buffers of all threads that recorded events
+    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+
+    /// Protect m_buffers from concurrent registration
+    mutable std::mutex m_buffers_mutex;
+
+    /// Number of operations that requested compute time measurements
+    unsigned int m_compute_time_requests = 0;
+
+    /// True while the main thread is in a compute region
+    bool m_in_compute = false;
+
+    /// Compute time measured since the last reset [s]
+    double m_compute_time = 0.0;
+    };
+
+/// Profile a region for the lifetime of the object
+/** Construct a ScopedProfile at the beginning of the block to profile. When the profiler is null
+    or disabled, ScopedProfile does nothing.
+*/
+class ScopedProfile
+    {
+    public:
+    /// Open a named region
+    ScopedProfile(Profiler* profiler, std::string_view name)
+        {
+        if (profiler && profiler->getEnabled())
+            {
+            m_profiler = profiler;
+            m_profiler->push(name);
+            }
+        }
+
+    /// Open a region named after a type
+    ScopedProfile(Profiler* profiler, const std::type_info& type)
+        {
+        if (profiler && profiler->getEnabled())
+            {
+            m_profiler = profiler;
+            m_profiler->push(type);
+            }
+        }
+
+    /// Open a region named after the dynamic type of a polymorphic object
+    template<class T, typename = std::enable_if_t<std::is_polymorphic_v<T>>>
+    ScopedProfile(Profiler* profiler, const T& object) : ScopedProfile(profiler, typeid(object))
+        {
+        }
+
+    /// Close the region
+    ~ScopedProfile()
+        {
+        if (m_profiler)
+            {
+            m_profiler->pop();
+            }
+        }
+
+    ScopedProfile(const ScopedProfile&) = delete;
+    ScopedProfile& operator=(const ScopedProfile&) = delete;
+
+    private:
+    /// Profiler recording this region (null when profiling is disabled)
+    Profiler* m_profiler = nullptr;
+    };
+
+/// Measure the compute time of a region for cost-based load balancing
+/** Force computes and Monte Carlo integrators place a ScopedComputeTime around the work that scales
+    with the particles owned by the rank. The time accumulates in the Profiler only when an
+    operation requested compute time measurements, and nested regions are counted once. Unlike
+    ScopedProfile, ScopedComputeTime does not depend on whether profiling is enabled.
+*/
+class ScopedComputeTime
+    {
+    public:
+    /// Start measuring
+    explicit ScopedComputeTime(Profiler* profiler)
+        {
+        if (profiler && profiler->getComputeTimeEnabled() && profiler->beginCompute())
+            {
+            m_profiler = profiler;
+            m_start = std::chrono::steady_clock::now();
+            }
+        }
+
+    /// Stop measuring
+    ~ScopedComputeTime()
+        {
+        stop();
+        }
+
+    /// Stop measuring before the end of the scope
+    void stop()
+        {
+        if (m_profiler)
+            {
+            m_profiler->endCompute(
+                std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count());
+            m_profiler = nullptr;
+            }
+        }
+
+    ScopedComputeTime(const ScopedComputeTime&) = delete;
+    ScopedComputeTime& operator=(const ScopedComputeTime&) = delete;
+
+    private:
+    /// Profiler accumulating the time (null when not measuring)
+    Profiler* m_profiler = nullptr;
+
+    /// Start of the region
+    std::chrono::steady_clock::time_point m_start;
+    };
+
+namespace detail
+    {
+/// Export Profiler to Python
+void export_Profiler(pybind11::module& m);
+
+    } // end namespace detail
+
+    } // end namespace hoomd
@@ -22,7 +22,8 @@ namespace hoomd
  */
 SFCPackTuner::SFCPackTuner(std::shared_ptr<SystemDefinition> sysdef,
                            std::shared_ptr<Trigger> trigger)
-    : Tuner(sysdef, trigger), m_last_grid(0), m_last_dim(0)
+    : Tuner(sysdef, trigger), m_last_grid(0), m_last_dim(0), m_incremental(false),
+      m_sort_moved_valid(false)
     {
     m_exec_conf->msg->notice(5) << "Constructing SFCPackTuner" << endl;
 
@@ -102,10 +103,14 @@ void SFCPackTuner::update(uint64_t timestep)
         getSortedOrder3D();
 
     // apply that sort order to the particles
+    m_sort_moved_valid = false;
     applySortOrder();
 
     // trigger sort signal (this also forces particle migration)
-    m_pdata->notifyParticleSort();
+    if (m_sort_moved_valid)
+        m_pdata->notifyParticleSort(m_sort_moved);
+    else
+        m_pdata->notifyParticleSort();
 
 #ifdef ENABLE_MPI
     if (m_sysdef->isDomainDecomposed())
@@ -120,6 +125,13 @@ void SFCPackTuner::applySortOrder()
     {
     assert(m_pdata);
     assert(m_sort_order.size() >= m_pdata->getN());
+
+    if (m_incremental)
+        {
+        applyMovedOrder();
+        return;
+        }
+
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
                                access_location::host,
                                access_mode::readwrite);
@@ -139,6 +151,9 @@ void SFCPackTuner::applySortOrder()
     ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
                                      access_location::host,
                                      access_mode::readwrite);
+    ArrayHandle<unsigned int> h_group_flags(m_pdata->getGroupFlags(),
+                                            access_location::host,
+                                            access_mode::readwrite);
     ArrayHandle<Scalar4> h_angmom(m_pdata->getAngularMomentumArray(),
                                   access_location::host,
                                   access_mode::readwrite);
@@ -265,6 +280,12 @@ void SFCPackTuner::applySortOrder()
     for (unsigned int i = 0; i < m_pdata->getN(); i++)
         h_body.data[i] = uint_tmp[i];
 
+    // sort group membership flags
+    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+        uint_tmp[i] = h_group_flags.data[m_sort_order[i]];
+    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+        h_group_flags.data[i] = uint_tmp[i];
+
     // sort global tag
     for (unsigned int i = 0; i < m_pdata->getN(); i++)
         uint_tmp[i] = h_tag.data[m_sort_order[i]];
@@ -284,6 +305,187 @@ void SFCPackTuner::applySortOrder()
     delete[] int3_tmp;
     }
 
+namespace
+    {
+//! Move the elements listed in \a moved to their new index
+/*! \param data Array to permute
+    \param moved (new index, old index) pairs
+    \param tmp Temporary storage
+*/
+template<class T>
+void permuteMoved(T* data,
+                  const std::vector<std::pair<unsigned int, unsigned int>>& moved,
+                  std::vector<T>& tmp)
+    {
+    tmp.resize(moved.size());
+    for (size_t k = 0; k < moved.size(); k++)
+        tmp[k] = data[moved[k].second];
+    for (size_t k = 0; k < moved.size(); k++)
+        data[moved[k].first] = tmp[k];
+    }
+    } // end anonymous namespace
+
+/*! Only the particles whose index changes are copied. The (new index, old index) pairs are stored
+    in m_sort_moved for publication with the particle sort signal.
+*/
+void SFCPackTuner::applyMovedOrder()
+    {
+    m_sort_moved.clear();
+    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+        {
+        if (m_sort_order[i] != i)
+            m_sort_moved.push_back(std::make_pair(i, m_sort_order[i]));
+        }
+    m_sort_moved_valid = true;
+
+    if (m_sort_moved.empty())
+        return;
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                               access_location::host,
+                               access_mode::readwrite);
+    ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
+                               access_location::host,
+                               access_mode::readwrite);
+    ArrayHandle<Scalar3> h_accel(m_pdata->getAccelerations(),
+                                 access_location::host,
+                                 access_mode::readwrite);
+    ArrayHandle<Scalar> h_charge(m_pdata->getCharges(),
+                                 access_location::host,
+                                 access_mode::readwrite);
+    ArrayHandle<Scalar> h_diameter(m_pdata->getDiameters(),
+                                   access_location::host,
+                                   access_mode::readwrite);
+    ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::readwrite);
+    ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
+                                     access_location::host,
+                                     access_mode::readwrite);
+    ArrayHandle<unsigned int> h_group_flags(m_pdata->getGroupFlags(),
+                                            access_location::host,
+                                            access_mode::readwrite);
+    ArrayHandle<Scalar4> h_angmom(m_pdata->getAngularMomentumArray(),
+                                  access_location::host,
+                                  access_mode::readwrite);
+    ArrayHandle<Scalar3> h_inertia(m_pdata->getMomentsOfInertiaArray(),
+                                   access_location::host,
+                                   access_mode::readwrite);
+    ArrayHandle<unsigned int> h_tag(m_pdata->getTags(),
+                                    access_location::host,
+                                    access_mode::readwrite);
+    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(),
+                                     access_location::host,
+                                     access_mode::readwrite);
+    ArrayHandle<Scalar> h_net_virial(m_pdata->getNetVirial(),
+                                     access_location::host,
+                                     access_mode::readwrite);
+    ArrayHandle<Scalar4> h_net_force(m_pdata->getNetForce(),
+                                     access_location::host,
+                                     access_mode::readwrite);
+    ArrayHandle<Scalar4> h_net_torque(m_pdata->getNetTorqueArray(),
+                                      access_location::host,
+                                      access_mode::readwrite);
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                       access_location::host,
+                                       access_mode::readwrite);
+
+    std::vector<Scalar4> scal4_tmp;
+    std::vector<Scalar3> scal3_tmp;
+    std::vector<Scalar> scal_tmp;
+    std::vector<int3> int3_tmp;
+    std::vector<unsigned int> uint_tmp;
+
+    permuteMoved(h_pos.data, m_sort_moved, scal4_tmp);
+    permuteMoved(h_vel.data, m_sort_moved, scal4_tmp);
+    permuteMoved(h_accel.data, m_sort_moved, scal3_tmp);
+    permuteMoved(h_charge.data, m_sort_moved, scal_tmp);
+    permuteMoved(h_diameter.data, m_sort_moved, scal_tmp);
+    permuteMoved(h_angmom.data, m_sort_moved, scal4_tmp);
+    permuteMoved(h_inertia.data, m_sort_moved, scal3_tmp);
+
+    size_t virial_pitch = m_pdata->getNetVirial().getPitch();
+    for (unsigned int j = 0; j < 6; j++)
+        permuteMoved(h_net_virial.data + j * virial_pitch, m_sort_moved, scal_tmp);
+
+    permuteMoved(h_net_force.data, m_sort_moved, scal4_tmp);
+    permuteMoved(h_net_torque.data, m_sort_moved, scal4_tmp);
+    permuteMoved(h_orientation.data, m_sort_moved, scal4_tmp);
+    permuteMoved(h_image.data, m_sort_moved, int3_tmp);
+    permuteMoved(h_body.data, m_sort_moved, uint_tmp);
+    permuteMoved(h_group_flags.data, m_sort_moved, uint_tmp);
+    permuteMoved(h_tag.data, m_sort_moved, uint_tmp);
+
+    // update the rtags of the moved particles
+    for (const auto& moved : m_sort_moved)
+        h_rtag.data[h_tag.data[moved.first]] = moved.first;
+    }
+
+/*! Sorts m_particle_bins by bin and translates the result to m_sort_order.
+
+    In incremental mode, a particle is in order when its bin is not smaller than the bin of the
+    previous particle kept in order, and not larger than the bin of the next particle (unless that
+    one is itself out of order). The out of order particles are sorted and merged back into the
+    particles kept in order. The merge preserves the relative order of the particles kept in order,
+    so their indices only change when out of order particles are inserted before them.
+
+    Both paths order the particles by (bin, current index). The particles kept in order form a
+    subsequence of memory with non-decreasing bins, so they are already sorted by that pair, and
+    merging on the full pair gives exactly the order of the full sort.
+*/
+void SFCPackTuner::sortBins()
+    {
+    const unsigned int N = m_pdata->getN();
+
+    if (!m_incremental)
+        {
+        sort(m_particle_bins.begin(), m_particle_bins.begin() + N);
+        }
+    else
+        {
+        // compact the particles that are in order to the front of the list
+        m_out_of_order_bins.clear();
+        unsigned int n_kept = 0;
+        unsigned int last_bin = 0;
+        for (unsigned int i = 0; i < N; i++)
+            {
+            const unsigned int bin = m_particle_bins[i].first;
+            bool in_order = bin >= last_bin
+                            && (i + 1 == N || bin <= m_particle_bins[i + 1].first
+                                || m_particle_bins[i + 1].first < last_bin);
+            if (in_order)
+                {
+                m_particle_bins[n_kept++] = m_particle_bins[i];
+                last_bin = bin;
+                }
+            else
+                {
+                m_out_of_order_bins.push_back(m_particle_bins[i]);
+                }
+            }
+
+        sort(m_out_of_order_bins.begin(), m_out_of_order_bins.end());
+
+        // merge from the back so that the merge can be done in place
+        size_t i = n_kept;
+        size_t j = m_out_of_order_bins.size();
+        size_t k = N;
+        while (j > 0)
+            {
+            if (i > 0 && m_particle_bins[i - 1] > m_out_of_order_bins[j - 1])
+                m_particle_bins[--k] = m_particle_bins[--i];
+            else
+                m_particle_bins[--k] = m_out_of_order_bins[--j];
+            }
+
+        assert(std::is_sorted(m_particle_bins.begin(), m_particle_bins.begin() + N));
+        }
+
+    // translate the sorted order
+    for (unsigned int j = 0; j < N; j++)
+        {
+        m_sort_order[j] = m_particle_bins[j].second;
+        }
+    }
+
 namespace detail
     {
 //! x walking table for the hilbert curve
@@ -529,13 +731,7 @@ void SFCPackTuner::getSortedOrder2D()
         }
 
     // sort the tuples
-    sort(m_particle_bins.begin(), m_particle_bins.begin() + m_pdata->getN());
-
-    // translate the sorted order
-    for (unsigned int j = 0; j < m_pdata->getN(); j++)
-        {
-        m_sort_order[j] = m_particle_bins[j].second;
-        }
+    sortBins();
     }
 
 void SFCPackTuner::getSortedOrder3D()
@@ -640,13 +836,7 @@ void SFCPackTuner::getSortedOrder3D()
         }
 
     // sort the tuples
-    sort(m_particle_bins.begin(), m_particle_bins.begin() + m_pdata->getN());
-
-    // translate the sorted order
-    for (unsigned int j = 0; j < m_pdata->getN(); j++)
-        {
-        m_sort_order[j] = m_particle_bins[j].second;
-        }
+    sortBins();
     }
 
 void SFCPackTuner::writeTraversalOrder(const std::string& fname,
@@ -688,7 +878,10 @@ void export_SFCPackTuner(pybind11::module& m)
     {
     pybind11::class_<SFCPackTuner, Tuner, std::shared_ptr<SFCPackTuner>>(m, "SFCPackTuner")
         .def(pybind11::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<Trigger>>())
-        .def_property("grid", &SFCPackTuner::getGrid, &SFCPackTuner::setGridPython);
+        .def_property("grid", &SFCPackTuner::getGrid, &SFCPackTuner::setGridPython)
+        .def_property("incremental",
+                      &SFCPackTuner::getIncremental,
+                      &SFCPackTuner::setIncremental);
     }
 
     } // end namespace detail
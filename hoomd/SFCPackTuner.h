@@ -43,6 +43,17 @@ namespace hoomd
    based on the order in which those bins appear along a hilbert curve. It is very efficient, even
    when the box size changes often as the grid dimension is kept constant.
 
+    Incremental sorting:<br>
+    Particles move slowly between sorts, so the particles are still nearly in the order of the
+   space filling curve when the next sort begins. When incremental sorting is enabled, the tuner
+   keeps every particle whose bin lies in order with its neighbors in memory, sorts only the
+   particles that left their place on the curve, and merges the two sequences. Both modes order
+   particles in the same bin by their index before the sort, so the resulting order is the same
+   as that of a full sort. Only the particles whose index changed are moved in
+   the particle data arrays, and their (new index, old index) pairs are published with
+   ParticleData::notifyParticleSort() so that listeners can remap data stored by index instead of
+   rebuilding it. The GPU implementation always performs full sorts.
+
     \ingroup updaters
 */
 class PYBIND11_EXPORT SFCPackTuner : public Tuner
@@ -80,20 +91,42 @@ class PYBIND11_EXPORT SFCPackTuner : public Tuner
         return m_grid;
         }
 
+    //! Set whether to sort incrementally
+    void setIncremental(bool incremental)
+        {
+        m_incremental = incremental;
+        }
+
+    //! Get whether to sort incrementally
+    bool getIncremental()
+        {
+        return m_incremental;
+        }
+
     protected:
     unsigned int m_grid;                      //!< Grid dimension to use
     unsigned int m_last_grid;                 //!< The last value of MMax
     unsigned int m_last_dim;                  //!< Check the last dimension we ran at
     GPUArray<unsigned int> m_traversal_order; //!< Generated traversal order of bins
+    bool m_incremental;                       //!< True to sort only out of order particles
+    bool m_sort_moved_valid; //!< True if m_sort_moved lists the particles moved by the last sort
+    std::vector<std::pair<unsigned int, unsigned int>>
+        m_sort_moved; //!< (new index, old index) of the particles moved by the last sort
 
     //! Helper function that actually performs the sort
     virtual void getSortedOrder2D();
     //! Helper function that actually performs the sort
     virtual void getSortedOrder3D();
 
+    //! Sort the binned particles by their position along the curve
+    void sortBins();
+
     //! Apply the sorted order to the particle data
     virtual void applySortOrder();
 
+    //! Move only the particles listed in m_sort_moved
+    void applyMovedOrder();
+
     //! Helper function to generate traversal order
     static void generateTraversalOrder(int i,
                                        int j,
@@ -113,6 +146,8 @@ class PYBIND11_EXPORT SFCPackTuner : public Tuner
     private:
     std::vector<unsigned int> m_sort_order; //!< Generated sort order of the particles
     std::vector<std::pair<unsigned int, unsigned int>> m_particle_bins; //!< Binned particles
+    std::vector<std::pair<unsigned int, unsigned int>>
+        m_out_of_order_bins; //!< Binned particles that left their place on the curve
     std::shared_ptr<Trigger> m_trigger;
 
 #ifdef ENABLE_MPI
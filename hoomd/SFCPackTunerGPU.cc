@@ -175,6 +175,9 @@ void SFCPackTunerGPU::applySortOrder()
         ArrayHandle<unsigned int> d_body_alt(m_pdata->getAltBodies(),
                                              access_location::device,
                                              access_mode::overwrite);
+        ArrayHandle<unsigned int> d_group_flags_alt(m_pdata->getAltGroupFlags(),
+                                                    access_location::device,
+                                                    access_mode::overwrite);
         ArrayHandle<unsigned int> d_tag_alt(m_pdata->getAltTags(),
                                             access_location::device,
                                             access_mode::overwrite);
@@ -218,6 +221,9 @@ void SFCPackTunerGPU::applySortOrder()
         ArrayHandle<unsigned int> d_body(m_pdata->getBodies(),
                                          access_location::device,
                                          access_mode::read);
+        ArrayHandle<unsigned int> d_group_flags(m_pdata->getGroupFlags(),
+                                                access_location::device,
+                                                access_mode::read);
         ArrayHandle<unsigned int> d_tag(m_pdata->getTags(),
                                         access_location::device,
                                         access_mode::read);
@@ -269,6 +275,8 @@ void SFCPackTunerGPU::applySortOrder()
                                        d_image_alt.data,
                                        d_body.data,
                                        d_body_alt.data,
+                                       d_group_flags.data,
+                                       d_group_flags_alt.data,
                                        d_tag.data,
                                        d_tag_alt.data,
                                        d_orientation.data,
@@ -298,6 +306,7 @@ void SFCPackTunerGPU::applySortOrder()
     m_pdata->swapDiameters();
     m_pdata->swapImages();
     m_pdata->swapBodies();
+    m_pdata->swapGroupFlags();
     m_pdata->swapTags();
     m_pdata->swapOrientations();
     m_pdata->swapAngularMomenta();
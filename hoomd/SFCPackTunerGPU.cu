@@ -163,6 +163,8 @@ __global__ void gpu_apply_sorted_order_kernel(unsigned int N,
                                               int3* d_image_alt,
                                               const unsigned int* d_body,
                                               unsigned int* d_body_alt,
+                                              const unsigned int* d_group_flags,
+                                              unsigned int* d_group_flags_alt,
                                               const unsigned int* d_tag,
                                               unsigned int* d_tag_alt,
                                               const Scalar4* d_orientation,
@@ -196,6 +198,7 @@ __global__ void gpu_apply_sorted_order_kernel(unsigned int N,
     d_diameter_alt[idx] = d_diameter[old_idx];
     d_image_alt[idx] = d_image[old_idx];
     d_body_alt[idx] = d_body[old_idx];
+    d_group_flags_alt[idx] = d_group_flags[old_idx];
     unsigned int tag = d_tag[old_idx];
     d_tag_alt[idx] = tag;
     d_orientation_alt[idx] = d_orientation[old_idx];
@@ -234,6 +237,8 @@ void gpu_apply_sorted_order(unsigned int N,
                             int3* d_image_alt,
                             const unsigned int* d_body,
                             unsigned int* d_body_alt,
+                            const unsigned int* d_group_flags,
+                            unsigned int* d_group_flags_alt,
                             const unsigned int* d_tag,
                             unsigned int* d_tag_alt,
                             const Scalar4* d_orientation,
@@ -276,6 +281,8 @@ void gpu_apply_sorted_order(unsigned int N,
                        d_image_alt,
                        d_body,
                        d_body_alt,
+                       d_group_flags,
+                       d_group_flags_alt,
                        d_tag,
                        d_tag_alt,
                        d_orientation,
@@ -46,6 +46,8 @@ void gpu_apply_sorted_order(unsigned int N,
                             int3* d_image_alt,
                             const unsigned int* d_body,
                             unsigned int* d_body_alt,
+                            const unsigned int* d_group_flags,
+                            unsigned int* d_group_flags_alt,
                             const unsigned int* d_tag,
                             unsigned int* d_tag_alt,
                             const Scalar4* d_orientation,
@@ -117,13 +117,18 @@ void System::run(uint64_t nsteps, bool write_at_start)
     // cannot generate on the first step
     m_sysdef->getParticleData()->setFlags(determineFlags(m_cur_tstep));
 
+    Profiler* profiler = m_exec_conf->getProfiler();
+
     // execute analyzers on initial step if requested
     if (write_at_start)
         {
         for (auto& analyzer : m_analyzers)
             {
             if ((*analyzer->getTrigger())(m_cur_tstep))
+                {
+                ScopedProfile profile(profiler, *analyzer);
                 analyzer->analyze(m_cur_tstep);
+                }
             }
         }
 
@@ -133,7 +138,10 @@ void System::run(uint64_t nsteps, bool write_at_start)
         for (auto& tuner : m_tuners)
             {
             if ((*tuner->getTrigger())(m_cur_tstep))
+                {
+                ScopedProfile profile(profiler, *tuner);
                 tuner->update(m_cur_tstep);
+                }
             }
 
         // execute updaters
@@ -141,6 +149,7 @@ void System::run(uint64_t nsteps, bool write_at_start)
             {
             if ((*updater->getTrigger())(m_cur_tstep))
                 {
+                ScopedProfile profile(profiler, *updater);
                 updater->update(m_cur_tstep);
                 m_update_group_dof_next_step |= updater->mayChangeDegreesOfFreedom(m_cur_tstep);
                 }
@@ -159,7 +168,10 @@ void System::run(uint64_t nsteps, bool write_at_start)
 
         // execute the integrator
         if (m_integrator)
+            {
+            ScopedProfile profile(profiler, *m_integrator);
             m_integrator->update(m_cur_tstep);
+            }
 
         m_cur_tstep++;
 
@@ -167,7 +179,10 @@ void System::run(uint64_t nsteps, bool write_at_start)
         for (auto& analyzer : m_analyzers)
             {
             if ((*analyzer->getTrigger())(m_cur_tstep))
+                {
+                ScopedProfile profile(profiler, *analyzer);
                 analyzer->analyze(m_cur_tstep);
+                }
             }
 
         updateTPS();
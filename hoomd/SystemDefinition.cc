@@ -143,6 +143,59 @@ SystemDefinition::SystemDefinition(std::shared_ptr<SnapshotSystemData<Real>> sna
 #endif
     }
 
+#ifdef ENABLE_MPI
+/*! \param snapshot Snapshot with the box, dimensions, type names, and topology (on the root rank)
+    \param local_particles Block of consecutive particles held by this rank
+    \param first_tag Tag of the first particle in \a local_particles
+    \param exec_conf Execution configuration to run on
+    \param decomposition The domain decomposition layout
+
+    The particles in \a snapshot are ignored. Instead, every rank contributes the particles in
+    \a local_particles, see ParticleData::initializeFromDistributedSnapshot(). The bonded groups
+    are distributed from the root rank as in the snapshot constructor.
+*/
+template<class Real>
+SystemDefinition::SystemDefinition(std::shared_ptr<SnapshotSystemData<Real>> snapshot,
+                                   std::shared_ptr<SnapshotParticleData<Real>> local_particles,
+                                   unsigned int first_tag,
+                                   std::shared_ptr<ExecutionConfiguration> exec_conf,
+                                   std::shared_ptr<DomainDecomposition> decomposition)
+    {
+    setNDimensions(snapshot->dimensions);
+
+    // construct empty particle data with the type names, then add the particles of all ranks
+    SnapshotParticleData<Real> no_particles;
+    no_particles.type_mapping = local_particles->type_mapping;
+    m_particle_data = std::shared_ptr<ParticleData>(
+        new ParticleData(no_particles, snapshot->global_box, exec_conf, decomposition));
+    m_particle_data->initializeFromDistributedSnapshot(*local_particles, first_tag);
+
+    // in MPI simulations, broadcast dimensionality from rank zero
+    bcast(m_n_dimensions, 0, exec_conf->getMPICommunicator());
+
+    m_bond_data = std::shared_ptr<BondData>(new BondData(m_particle_data, snapshot->bond_data));
+
+    m_angle_data = std::shared_ptr<AngleData>(new AngleData(m_particle_data, snapshot->angle_data));
+
+    m_dihedral_data
+        = std::shared_ptr<DihedralData>(new DihedralData(m_particle_data, snapshot->dihedral_data));
+
+    m_improper_data
+        = std::shared_ptr<ImproperData>(new ImproperData(m_particle_data, snapshot->improper_data));
+
+    m_constraint_data = std::shared_ptr<ConstraintData>(
+        new ConstraintData(m_particle_data, snapshot->constraint_data));
+    m_pair_data = std::shared_ptr<PairData>(new PairData(m_particle_data, snapshot->pair_data));
+
+#ifdef BUILD_MPCD
+    m_mpcd_data = std::make_shared<mpcd::ParticleData>(snapshot->mpcd_data,
+                                                       snapshot->global_box,
+                                                       exec_conf,
+                                                       decomposition);
+#endif
+    }
+#endif
+
 /*! Sets the dimensionality of the system.  When quantities involving the dof of
     the system are computed, such as T, P, etc., the dimensionality is needed.
     Therefore, the dimensionality must be set before any temperature/pressure
@@ -239,6 +292,14 @@ void SystemDefinition::initializeFromSnapshot(std::shared_ptr<SnapshotSystemData
 template SystemDefinition::SystemDefinition(std::shared_ptr<SnapshotSystemData<float>> snapshot,
                                             std::shared_ptr<ExecutionConfiguration> exec_conf,
                                             std::shared_ptr<DomainDecomposition> decomposition);
+#ifdef ENABLE_MPI
+template SystemDefinition::SystemDefinition(
+    std::shared_ptr<SnapshotSystemData<float>> snapshot,
+    std::shared_ptr<SnapshotParticleData<float>> local_particles,
+    unsigned int first_tag,
+    std::shared_ptr<ExecutionConfiguration> exec_conf,
+    std::shared_ptr<DomainDecomposition> decomposition);
+#endif
 template std::shared_ptr<SnapshotSystemData<float>> SystemDefinition::takeSnapshot<float>();
 template void SystemDefinition::initializeFromSnapshot<float>(
     std::shared_ptr<SnapshotSystemData<float>> snapshot);
@@ -283,6 +344,13 @@ void export_SystemDefinition(pybind11::module& m)
                             std::shared_ptr<DomainDecomposition>>())
         .def(pybind11::init<std::shared_ptr<SnapshotSystemData<double>>,
                             std::shared_ptr<ExecutionConfiguration>>())
+#ifdef ENABLE_MPI
+        .def(pybind11::init<std::shared_ptr<SnapshotSystemData<float>>,
+                            std::shared_ptr<SnapshotParticleData<float>>,
+                            unsigned int,
+                            std::shared_ptr<ExecutionConfiguration>,
+                            std::shared_ptr<DomainDecomposition>>())
+#endif
         .def("setNDimensions", &SystemDefinition::setNDimensions)
         .def("getNDimensions", &SystemDefinition::getNDimensions)
         .def("getParticleData", &SystemDefinition::getParticleData)
@@ -110,6 +110,16 @@ class PYBIND11_EXPORT SystemDefinition
                      std::shared_ptr<DomainDecomposition> decomposition
                      = std::shared_ptr<DomainDecomposition>());
 
+#ifdef ENABLE_MPI
+    //! Construct from a topology snapshot and blocks of particles held by all ranks
+    template<class Real>
+    SystemDefinition(std::shared_ptr<SnapshotSystemData<Real>> snapshot,
+                     std::shared_ptr<SnapshotParticleData<Real>> local_particles,
+                     unsigned int first_tag,
+                     std::shared_ptr<ExecutionConfiguration> exec_conf,
+                     std::shared_ptr<DomainDecomposition> decomposition);
+#endif
+
     //! Set the dimensionality of the system
     void setNDimensions(unsigned int);
 
@@ -0,0 +1,382 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file UpdaterReplicaExchange.cc
+    \brief Defines the UpdaterReplicaExchange class
+*/
+
+#include "UpdaterReplicaExchange.h"
+#include "RNGIdentifiers.h"
+#include "RandomNumbers.h"
+
+#include <pybind11/stl.h>
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+
+namespace hoomd
+    {
+namespace
+    {
+/// Message exchanged between the roots of two partitions
+struct ReplicaExchangeMessage
+    {
+    /// Value of the conjugate observable
+    double observable;
+
+    /// Current time step (must match on both partitions)
+    uint64_t timestep;
+
+    /// User seed of the sending partition
+    uint16_t seed;
+    };
+    } // end anonymous namespace
+
+/** @param sysdef System definition
+    @param trigger Trigger that determines when to attempt exchanges
+    @param integrator Integrator that evaluates the potential energy
+    @param parameter Variant (shared with the integration method) to set
+    @param ladder Parameter value for each ladder index
+    @param observable Name of the observable conjugate to the parameter
+*/
+UpdaterReplicaExchange::UpdaterReplicaExchange(std::shared_ptr<SystemDefinition> sysdef,
+                                               std::shared_ptr<Trigger> trigger,
+                                               std::shared_ptr<Integrator> integrator,
+                                               std::shared_ptr<VariantConstant> parameter,
+                                               const std::vector<Scalar>& ladder,
+                                               const std::string& observable)
+    : Updater(sysdef, trigger), m_integrator(integrator), m_parameter(parameter), m_ladder(ladder)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing UpdaterReplicaExchange" << std::endl;
+
+    if (observable == "potential_energy")
+        {
+        m_observable = Observable::potential_energy;
+        }
+    else if (observable == "volume")
+        {
+        m_observable = Observable::volume;
+        }
+    else
+        {
+        throw std::invalid_argument("Invalid replica exchange observable: " + observable);
+        }
+
+    const unsigned int n_partitions = m_exec_conf->getNPartitions();
+    if (n_partitions < 2)
+        {
+        throw std::runtime_error("Replica exchange requires at least two MPI partitions.");
+        }
+
+    if (m_ladder.size() != n_partitions)
+        {
+        std::ostringstream s;
+        s << "The replica exchange ladder has " << m_ladder.size() << " values, expected one "
+          << "value per partition (" << n_partitions << ").";
+        throw std::invalid_argument(s.str());
+        }
+
+    if (m_observable == Observable::potential_energy)
+        {
+        for (auto value : m_ladder)
+            {
+            if (value <= 0)
+                {
+                throw std::domain_error("kT must be positive.");
+                }
+            }
+        }
+
+    // partition p starts at ladder index p
+    m_ladder_index = m_exec_conf->getPartition();
+    m_permutation.resize(n_partitions);
+    for (unsigned int p = 0; p < n_partitions; p++)
+        {
+        m_permutation[p] = p;
+        }
+    m_accepted.resize(n_partitions - 1, 0);
+    m_attempted.resize(n_partitions - 1, 0);
+
+    m_parameter->setValue(m_ladder[m_ladder_index]);
+
+#ifdef ENABLE_MPI
+    // connect the root ranks of all partitions to share the ladder permutation
+    int color = m_exec_conf->getRank() == 0 ? 0 : MPI_UNDEFINED;
+    MPI_Comm_split(m_exec_conf->getHOOMDWorldMPICommunicator(),
+                   color,
+                   m_exec_conf->getPartition(),
+                   &m_roots_comm);
+#endif
+    }
+
+UpdaterReplicaExchange::~UpdaterReplicaExchange()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying UpdaterReplicaExchange" << std::endl;
+
+#ifdef ENABLE_MPI
+    if (m_roots_comm != MPI_COMM_NULL)
+        {
+        MPI_Comm_free(&m_roots_comm);
+        }
+#endif
+    }
+
+/** @param timestep Current time step
+    @returns The observable conjugate to the exchanged parameter, reduced over the partition.
+*/
+double UpdaterReplicaExchange::computeObservable(uint64_t timestep)
+    {
+    if (m_observable == Observable::volume)
+        {
+        return m_pdata->getGlobalBox().getVolume(m_sysdef->getNDimensions() == 2);
+        }
+
+    if (!m_integrator)
+        {
+        throw std::runtime_error("Replica exchange of kT requires an integrator.");
+        }
+
+    return m_integrator->computeTotalPotentialEnergy(timestep);
+    }
+
+/** @param new_index Ladder index now held by this partition
+
+    Sets the parameter value and, for temperature exchanges, rescales the momenta so that the
+    kinetic energy matches the new temperature.
+*/
+void UpdaterReplicaExchange::applyLadderIndex(unsigned int new_index)
+    {
+    const Scalar old_value = m_parameter->getValue();
+    const Scalar new_value = m_ladder[new_index];
+    m_ladder_index = new_index;
+    m_parameter->setValue(new_value);
+
+    if (m_observable == Observable::potential_energy && m_rescale_velocities)
+        {
+        const Scalar scale = slow::sqrt(new_value / old_value);
+
+        ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
+                                   access_location::host,
+                                   access_mode::readwrite);
+        ArrayHandle<Scalar4> h_angmom(m_pdata->getAngularMomentumArray(),
+                                      access_location::host,
+                                      access_mode::readwrite);
+
+        for (unsigned int i = 0; i < m_pdata->getN(); i++)
+            {
+            h_vel.data[i].x *= scale;
+            h_vel.data[i].y *= scale;
+            h_vel.data[i].z *= scale;
+
+            h_angmom.data[i].x *= scale;
+            h_angmom.data[i].y *= scale;
+            h_angmom.data[i].z *= scale;
+            h_angmom.data[i].w *= scale;
+            }
+        }
+    }
+
+/** @param timestep Current time step
+
+    Attempt to swap the parameter value with the partition that holds the neighboring ladder index.
+*/
+void UpdaterReplicaExchange::update(uint64_t timestep)
+    {
+    Updater::update(timestep);
+    m_exec_conf->msg->notice(10) << "UpdaterReplicaExchange: " << timestep << std::endl;
+
+#ifdef ENABLE_MPI
+    const unsigned int n_ladder = static_cast<unsigned int>(m_ladder.size());
+    const unsigned int parity = static_cast<unsigned int>(m_n_exchanges % 2);
+    m_n_exchanges++;
+
+    // all ranks in the partition take part in the evaluation of the observable
+    const double observable = computeObservable(timestep);
+
+    // pair (k, k+1) is attempted when k % 2 == parity
+    int partner_index = (m_ladder_index % 2 == parity) ? int(m_ladder_index) + 1
+                                                       : int(m_ladder_index) - 1;
+    const bool active = partner_index >= 0 && partner_index < int(n_ladder);
+
+    std::vector<unsigned int> old_permutation = m_permutation;
+    unsigned int new_index = m_ladder_index;
+
+    // the partition roots check the time steps, all ranks report a mismatch
+    uint64_t partner_timestep = timestep;
+    int mismatch = 0;
+
+    if (m_exec_conf->getRank() == 0)
+        {
+        if (active)
+            {
+            const unsigned int partner_partition = static_cast<unsigned int>(
+                std::find(m_permutation.begin(), m_permutation.end(), unsigned(partner_index))
+                - m_permutation.begin());
+            const int partner_rank = partner_partition * m_exec_conf->getNRanks();
+
+            ReplicaExchangeMessage send_msg {observable, timestep, m_sysdef->getSeed()};
+            ReplicaExchangeMessage recv_msg;
+            MPI_Sendrecv(&send_msg,
+                         sizeof(ReplicaExchangeMessage),
+                         MPI_BYTE,
+                         partner_rank,
+                         0,
+                         &recv_msg,
+                         sizeof(ReplicaExchangeMessage),
+                         MPI_BYTE,
+                         partner_rank,
+                         0,
+                         m_exec_conf->getHOOMDWorldMPICommunicator(),
+                         MPI_STATUS_IGNORE);
+
+            partner_timestep = recv_msg.timestep;
+            mismatch = partner_timestep != timestep;
+
+            if (!mismatch)
+                {
+                // evaluate the acceptance in the same order on both partners
+                const bool lower = int(m_ladder_index) < partner_index;
+                const unsigned int k = lower ? m_ladder_index : partner_index;
+                const double x_a = getCoupling(m_ladder[k]);
+                const double x_b = getCoupling(m_ladder[k + 1]);
+                const double o_a = lower ? observable : recv_msg.observable;
+                const double o_b = lower ? recv_msg.observable : observable;
+                const uint16_t seed = lower ? send_msg.seed : recv_msg.seed;
+
+                hoomd::RandomGenerator rng(
+                    hoomd::Seed(hoomd::RNGIdentifier::UpdaterReplicaExchange, timestep, seed),
+                    hoomd::Counter(k));
+                const double log_acceptance = (x_a - x_b) * (o_a - o_b);
+                const double r = hoomd::detail::generate_canonical<double>(rng);
+
+                if (log_acceptance >= 0 || r < exp(log_acceptance))
+                    {
+                    new_index = partner_index;
+                    }
+                }
+            }
+
+        MPI_Allgather(&new_index,
+                      1,
+                      MPI_UNSIGNED,
+                      m_permutation.data(),
+                      1,
+                      MPI_UNSIGNED,
+                      m_roots_comm);
+
+        // stop all partitions together so that none waits in the next exchange
+        MPI_Allreduce(MPI_IN_PLACE, &mismatch, 1, MPI_INT, MPI_MAX, m_roots_comm);
+        }
+
+    MPI_Bcast(&mismatch, 1, MPI_INT, 0, m_exec_conf->getMPICommunicator());
+    if (mismatch)
+        {
+        MPI_Bcast(&partner_timestep, 1, MPI_UINT64_T, 0, m_exec_conf->getMPICommunicator());
+        std::ostringstream s;
+        s << "Replica exchange partners are at different time steps";
+        if (partner_timestep != timestep)
+            {
+            s << " " << timestep << " != " << partner_timestep;
+            }
+        s << ".";
+        throw std::runtime_error(s.str());
+        }
+
+    MPI_Bcast(m_permutation.data(), n_ladder, MPI_UNSIGNED, 0, m_exec_conf->getMPICommunicator());
+
+    // count attempts and acceptances for every ladder pair
+    for (unsigned int k = parity; k + 1 < n_ladder; k += 2)
+        {
+        m_attempted[k]++;
+        const auto held_k = std::find(old_permutation.begin(), old_permutation.end(), k)
+                            - old_permutation.begin();
+        if (m_permutation[held_k] == k + 1)
+            {
+            m_accepted[k]++;
+            }
+        }
+
+    new_index = m_permutation[m_exec_conf->getPartition()];
+    if (new_index != m_ladder_index)
+        {
+        applyLadderIndex(new_index);
+        }
+#endif
+    }
+
+pybind11::tuple UpdaterReplicaExchange::getLadder()
+    {
+    pybind11::list result;
+    for (auto value : m_ladder)
+        {
+        result.append(value);
+        }
+    return pybind11::tuple(result);
+    }
+
+std::string UpdaterReplicaExchange::getObservable()
+    {
+    if (m_observable == Observable::potential_energy)
+        return "potential_energy";
+    return "volume";
+    }
+
+pybind11::tuple UpdaterReplicaExchange::getPermutation()
+    {
+    pybind11::list result;
+    for (auto index : m_permutation)
+        {
+        result.append(index);
+        }
+    return pybind11::tuple(result);
+    }
+
+pybind11::tuple UpdaterReplicaExchange::getAccepted()
+    {
+    pybind11::list result;
+    for (auto count : m_accepted)
+        {
+        result.append(count);
+        }
+    return pybind11::tuple(result);
+    }
+
+pybind11::tuple UpdaterReplicaExchange::getAttempted()
+    {
+    pybind11::list result;
+    for (auto count : m_attempted)
+        {
+        result.append(count);
+        }
+    return pybind11::tuple(result);
+    }
+
+namespace detail
+    {
+void export_UpdaterReplicaExchange(pybind11::module& m)
+    {
+    pybind11::class_<UpdaterReplicaExchange, Updater, std::shared_ptr<UpdaterReplicaExchange>>(
+        m,
+        "UpdaterReplicaExchange")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            std::shared_ptr<Integrator>,
+                            std::shared_ptr<VariantConstant>,
+                            const std::vector<Scalar>&,
+                            const std::string&>())
+        .def_property_readonly("ladder", &UpdaterReplicaExchange::getLadder)
+        .def_property_readonly("observable", &UpdaterReplicaExchange::getObservable)
+        .def_property("rescale_velocities",
+                      &UpdaterReplicaExchange::getRescaleVelocities,
+                      &UpdaterReplicaExchange::setRescaleVelocities)
+        .def_property_readonly("replica_index", &UpdaterReplicaExchange::getReplicaIndex)
+        .def_property_readonly("permutation", &UpdaterReplicaExchange::getPermutation)
+        .def_property_readonly("accepted", &UpdaterReplicaExchange::getAccepted)
+        .def_property_readonly("attempted", &UpdaterReplicaExchange::getAttempted);
+    }
+
+    } // end namespace detail
+
+    } // end namespace hoomd
@@ -0,0 +1,159 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file UpdaterReplicaExchange.h
+    \brief Declares an updater that exchanges thermodynamic parameters between MPI partitions
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "Integrator.h"
+#include "Updater.h"
+#include "Variant.h"
+
+#include <memory>
+#include <pybind11/pybind11.h>
+#include <string>
+#include <vector>
+
+#pragma once
+
+namespace hoomd
+    {
+/// Exchange thermodynamic parameters between MPI partitions (parallel tempering)
+/** Each MPI partition simulates one replica. The replicas are coupled to a ladder of parameter
+    values (e.g. kT or betaP) and UpdaterReplicaExchange periodically attempts to swap the parameter
+    values held by partitions that are adjacent on the ladder. Instead of moving the configuration
+    between partitions, the updater exchanges only the scalar conjugate observable (the potential
+    energy or volume) with a single MPI_Sendrecv between the partition roots and sets the new
+    parameter value on the Variant shared with the integration method.
+
+    The reduced energy of replica k is x_k * O where x_k is the coupling derived from the ladder
+    value (1/kT or betaP) and O is the observable. Swapping the parameter values of two replicas a
+    and b is accepted with probability min(1, exp((x_a - x_b) (O_a - O_b))).
+
+    Neighboring ladder pairs (k, k+1) with even k are attempted on even exchange attempts and
+    those with odd k on odd attempts. The partition roots share the ladder index each partition
+    holds after every attempt so that all partitions agree on the permutation and the per-pair
+    acceptance counters.
+
+    \ingroup updaters
+*/
+class PYBIND11_EXPORT UpdaterReplicaExchange : public Updater
+    {
+    public:
+    /// The quantity that is exchanged between replicas
+    enum class Observable
+        {
+        potential_energy, //!< Exchange kT; the conjugate observable is the potential energy.
+        volume            //!< Exchange betaP; the conjugate observable is the box volume.
+        };
+
+    /// Constructor
+    UpdaterReplicaExchange(std::shared_ptr<SystemDefinition> sysdef,
+                           std::shared_ptr<Trigger> trigger,
+                           std::shared_ptr<Integrator> integrator,
+                           std::shared_ptr<VariantConstant> parameter,
+                           const std::vector<Scalar>& ladder,
+                           const std::string& observable);
+
+    /// Destructor
+    virtual ~UpdaterReplicaExchange();
+
+    /// Attempt a parameter exchange with the neighboring replica
+    virtual void update(uint64_t timestep);
+
+    /// Get the parameter ladder
+    pybind11::tuple getLadder();
+
+    /// Get the observable name
+    std::string getObservable();
+
+    /// Set whether to rescale velocities after a temperature swap
+    void setRescaleVelocities(bool rescale)
+        {
+        m_rescale_velocities = rescale;
+        }
+
+    /// Get whether to rescale velocities after a temperature swap
+    bool getRescaleVelocities()
+        {
+        return m_rescale_velocities;
+        }
+
+    /// Get the position on the ladder held by this partition
+    unsigned int getReplicaIndex()
+        {
+        return m_ladder_index;
+        }
+
+    /// Get the ladder index held by each partition
+    pybind11::tuple getPermutation();
+
+    /// Get the number of accepted swaps for each neighboring ladder pair (k, k+1)
+    pybind11::tuple getAccepted();
+
+    /// Get the number of attempted swaps for each neighboring ladder pair (k, k+1)
+    pybind11::tuple getAttempted();
+
+    protected:
+    /// Integrator that computes the potential energy
+    std::shared_ptr<Integrator> m_integrator;
+
+    /// Variant shared with the integration method that holds the current parameter value
+    std::shared_ptr<VariantConstant> m_parameter;
+
+    /// Parameter value for each ladder index
+    std::vector<Scalar> m_ladder;
+
+    /// Observable conjugate to the exchanged parameter
+    Observable m_observable;
+
+    /// When true, rescale velocities to the new temperature after a swap
+    bool m_rescale_velocities = true;
+
+    /// Ladder index held by this partition
+    unsigned int m_ladder_index;
+
+    /// Ladder index held by each partition
+    std::vector<unsigned int> m_permutation;
+
+    /// Accepted swaps for each ladder pair
+    std::vector<uint64_t> m_accepted;
+
+    /// Attempted swaps for each ladder pair
+    std::vector<uint64_t> m_attempted;
+
+    /// Number of exchange attempts performed so far (selects even or odd pairs)
+    uint64_t m_n_exchanges = 0;
+
+#ifdef ENABLE_MPI
+    /// Communicator connecting the root ranks of all partitions
+    MPI_Comm m_roots_comm = MPI_COMM_NULL;
+#endif
+
+    /// Evaluate the observable conjugate to the parameter
+    double computeObservable(uint64_t timestep);
+
+    /// Coupling constant x for a given ladder value
+    double getCoupling(Scalar value)
+        {
+        if (m_observable == Observable::potential_energy)
+            return 1.0 / value;
+        return value;
+        }
+
+    /// Apply the parameter for a new ladder index
+    void applyLadderIndex(unsigned int new_index);
+    };
+
+namespace detail
+    {
+/// Export UpdaterReplicaExchange to Python
+void export_UpdaterReplicaExchange(pybind11::module& m);
+
+    } // end namespace detail
+
+    } // end namespace hoomd
@@ -0,0 +1,39 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file bench_cell_list.cc
+    \brief Benchmarks the CellList build
+*/
+
+#include "hoomd/CellList.h"
+
+#include "hoomd/benchmarks/benchmark_harness.h"
+
+using namespace hoomd;
+
+//! Rebuild the cell list of a fluid every step
+void bench_cell_list(benchmark::Harness& harness)
+    {
+    std::vector<unsigned int> sizes = {4096, 32768, 262144};
+    if (harness.quick())
+        sizes.resize(1);
+
+    for (unsigned int N : sizes)
+        {
+        for (Scalar density : {Scalar(0.5), Scalar(0.85)})
+            {
+            auto sysdef = std::make_shared<SystemDefinition>(benchmark::makeFluidSnapshot(N, density),
+                                                             harness.getExecConf());
+            auto cl = std::make_shared<CellList>(sysdef);
+            cl->setNominalWidth(Scalar(2.8));
+
+            // each step is a new timestep, so compute() rebuilds the cell list every call
+            harness.run("cell_list",
+                        {{"N", N}, {"density", density}},
+                        N,
+                        [&](uint64_t timestep) { cl->compute(timestep); });
+            }
+        }
+    }
+
+HOOMD_BENCHMARK_MAIN("bench_cell_list", bench_cell_list)
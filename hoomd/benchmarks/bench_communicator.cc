@@ -0,0 +1,80 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file bench_communicator.cc
+    \brief Benchmarks ghost exchange and particle migration in the Communicator
+*/
+
+#include "hoomd/Communicator.h"
+#include "hoomd/DomainDecomposition.h"
+
+#include "hoomd/benchmarks/benchmark_harness.h"
+
+using namespace hoomd;
+
+//! Constant ghost layer width subscriber
+struct ghost_layer_width
+    {
+    ghost_layer_width(Scalar width) : w(width) { }
+
+    Scalar get(unsigned int type)
+        {
+        return w;
+        }
+
+    Scalar w;
+    };
+
+//! Communicate the ghost particles of a fluid every step
+/*! Run with more than one rank, e.g. `mpirun -n 8 bench_communicator`. The "ghost_update" case
+    measures the ghost position updates performed on steps without migration, "migrate" forces a
+    full migration and ghost exchange every step.
+*/
+void bench_communicator(benchmark::Harness& harness)
+    {
+    auto exec_conf = harness.getExecConf();
+    const unsigned int n_ranks = exec_conf->getNRanks();
+
+    // particles per rank
+    std::vector<unsigned int> sizes = {4096, 32768};
+    if (harness.quick())
+        sizes.resize(1);
+
+    for (unsigned int N_rank : sizes)
+        {
+        for (Scalar density : {Scalar(0.5), Scalar(0.85)})
+            {
+            const unsigned int N = N_rank * n_ranks;
+            auto snap = benchmark::makeFluidSnapshot(N, density);
+            auto decomposition
+                = std::make_shared<DomainDecomposition>(exec_conf, snap->global_box->getL());
+            auto sysdef = std::make_shared<SystemDefinition>(snap, exec_conf, decomposition);
+            auto comm = std::make_shared<Communicator>(sysdef, decomposition);
+            sysdef->setCommunicator(comm);
+
+            ghost_layer_width g(Scalar(2.8));
+            comm->getGhostLayerWidthRequestSignal()
+                .connect<ghost_layer_width, &ghost_layer_width::get>(g);
+
+            comm->forceMigrate();
+            comm->communicate(0);
+
+            std::map<std::string, double> params = {{"N", N}, {"density", density}};
+            harness.run("ghost_update",
+                        params,
+                        N,
+                        [&](uint64_t timestep) { comm->communicate(timestep + 1); });
+
+            harness.run("migrate",
+                        params,
+                        N,
+                        [&](uint64_t timestep)
+                        {
+                            comm->forceMigrate();
+                            comm->communicate(timestep + 1);
+                        });
+            }
+        }
+    }
+
+HOOMD_BENCHMARK_MAIN("bench_communicator", bench_communicator)
@@ -0,0 +1,403 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file benchmark_harness.h
+    \brief Timing harness and synthetic systems for the C++ microbenchmarks
+    \note This file should be included only once and by a file that will compile into a
+        benchmark executable. It replaces the global operator new and delete to count
+        allocations.
+*/
+
+#include "hoomd/ExecutionConfiguration.h"
+#include "hoomd/HOOMDMPI.h"
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/RNGIdentifiers.h"
+#include "hoomd/RandomNumbers.h"
+#include "hoomd/SnapshotSystemData.h"
+#include "hoomd/SystemDefinition.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+//! Number of calls to the global operator new since the start of the program
+std::atomic<uint64_t> g_benchmark_allocations(0);
+
+void* operator new(std::size_t size)
+    {
+    g_benchmark_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+    }
+
+void* operator new[](std::size_t size)
+    {
+    g_benchmark_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+    }
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+    {
+    g_benchmark_allocations.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+    }
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+    {
+    g_benchmark_allocations.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+    }
+
+void operator delete(void* ptr) noexcept
+    {
+    std::free(ptr);
+    }
+
+void operator delete[](void* ptr) noexcept
+    {
+    std::free(ptr);
+    }
+
+void operator delete(void* ptr, std::size_t) noexcept
+    {
+    std::free(ptr);
+    }
+
+void operator delete[](void* ptr, std::size_t) noexcept
+    {
+    std::free(ptr);
+    }
+
+namespace hoomd
+    {
+namespace benchmark
+    {
+//! Result of one benchmark case
+struct Result
+    {
+    std::string suite;                    //!< Name of the benchmark executable
+    std::string name;                     //!< Name of the case
+    std::map<std::string, double> params; //!< Parameters of the case (N, density, ...)
+    double ns_per_particle_step;          //!< Median time per particle and step [ns]
+    double min_ns_per_particle_step;      //!< Fastest repetition [ns]
+    double allocations_per_step;          //!< Calls to operator new per step
+    uint64_t steps;                       //!< Steps per repetition
+    unsigned int repeats;                 //!< Number of timed repetitions
+    };
+
+//! Runs benchmark cases and reports the results
+/*! A case is a function that advances the benchmarked kernel by one step. Harness first calls it
+    for a number of warm up steps, then chooses the number of steps per repetition so that a
+    repetition takes at least the minimum time, and reports the median time per particle and step
+    over the repetitions. Allocations are counted over all timed steps.
+
+    Command line options:
+      - `--json FILE` write the results as a JSON array to FILE
+      - `--min-time SECONDS` minimum duration of each repetition (default 0.1)
+      - `--repeats N` number of repetitions (default 5)
+      - `--filter TEXT` only run cases whose name contains TEXT
+      - `--quick` only run the smallest system size of each case
+
+    Only the root rank prints and writes results. In MPI runs, the time of a repetition is the
+    maximum over all ranks.
+*/
+class Harness
+    {
+    public:
+    //! Constructor
+    /*! \param suite Name of the benchmark executable
+        \param argc Number of command line arguments
+        \param argv Command line arguments
+    */
+    Harness(const std::string& suite, int argc, char** argv) : m_suite(suite)
+        {
+        for (int i = 1; i < argc; i++)
+            {
+            std::string arg(argv[i]);
+            if (arg == "--json" && i + 1 < argc)
+                m_json_filename = argv[++i];
+            else if (arg == "--min-time" && i + 1 < argc)
+                m_min_time = std::atof(argv[++i]);
+            else if (arg == "--repeats" && i + 1 < argc)
+                m_repeats = std::max(1, std::atoi(argv[++i]));
+            else if (arg == "--filter" && i + 1 < argc)
+                m_filter = argv[++i];
+            else if (arg == "--quick")
+                m_quick = true;
+            else
+                throw std::runtime_error("Unknown argument: " + arg);
+            }
+
+        m_exec_conf = std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU);
+        }
+
+    //! Destructor writes the JSON output
+    ~Harness()
+        {
+        if (!m_json_filename.empty() && m_exec_conf->getRank() == 0)
+            {
+            writeJSON(m_json_filename);
+            }
+        }
+
+    //! Get the execution configuration
+    std::shared_ptr<ExecutionConfiguration> getExecConf() const
+        {
+        return m_exec_conf;
+        }
+
+    //! True when only the smallest system sizes should be run
+    bool quick() const
+        {
+        return m_quick;
+        }
+
+    //! Check whether a case should run
+    bool selected(const std::string& name) const
+        {
+        return m_filter.empty() || name.find(m_filter) != std::string::npos;
+        }
+
+    //! Benchmark one case
+    /*! \param name Name of the case
+        \param params Parameters of the case to report
+        \param n_particles Number of particles processed per step (over all ranks)
+        \param step Function that advances the kernel by one step
+        \param n_warmup Number of untimed steps
+    */
+    void run(const std::string& name,
+             const std::map<std::string, double>& params,
+             uint64_t n_particles,
+             const std::function<void(uint64_t)>& step,
+             unsigned int n_warmup = 5)
+        {
+        if (!selected(name))
+            return;
+
+        uint64_t timestep = 0;
+        for (unsigned int i = 0; i < n_warmup; i++)
+            step(timestep++);
+
+        // find the number of steps per repetition
+        uint64_t steps = 1;
+        while (true)
+            {
+            double t = timeSteps(step, timestep, steps);
+            if (t >= m_min_time || steps >= (uint64_t(1) << 30))
+                break;
+            steps = std::max(steps * 2, uint64_t(double(steps) * m_min_time / std::max(t, 1e-9)));
+            }
+
+        std::vector<double> ns_per_particle_step;
+        uint64_t allocations_start = g_benchmark_allocations.load();
+        for (unsigned int r = 0; r < m_repeats; r++)
+            {
+            double t = timeSteps(step, timestep, steps);
+            ns_per_particle_step.push_back(t * 1e9 / double(steps) / double(n_particles));
+            }
+        uint64_t allocations = g_benchmark_allocations.load() - allocations_start;
+
+        std::sort(ns_per_particle_step.begin(), ns_per_particle_step.end());
+
+        Result result;
+        result.suite = m_suite;
+        result.name = name;
+        result.params = params;
+        result.ns_per_particle_step = ns_per_particle_step[ns_per_particle_step.size() / 2];
+        result.min_ns_per_particle_step = ns_per_particle_step.front();
+        result.allocations_per_step = double(allocations) / double(steps * m_repeats);
+        result.steps = steps;
+        result.repeats = m_repeats;
+        m_results.push_back(result);
+
+        if (m_exec_conf->getRank() == 0)
+            {
+            std::cout << std::left << std::setw(40) << name;
+            for (const auto& [key, value] : params)
+                std::cout << " " << key << "=" << value;
+            std::cout << "  " << std::fixed << std::setprecision(2) << result.ns_per_particle_step
+                      << " ns/particle-step, " << result.allocations_per_step
+                      << " allocations/step" << std::endl;
+            std::cout.unsetf(std::ios::fixed);
+            }
+        }
+
+    private:
+    //! Time a number of steps
+    /*! \returns The wall clock time [s], maximum over all ranks
+     */
+    double timeSteps(const std::function<void(uint64_t)>& step, uint64_t& timestep, uint64_t steps)
+        {
+#ifdef ENABLE_MPI
+        MPI_Barrier(m_exec_conf->getMPICommunicator());
+#endif
+        auto start = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < steps; i++)
+            step(timestep++);
+        double t = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+#ifdef ENABLE_MPI
+        MPI_Allreduce(MPI_IN_PLACE, &t, 1, MPI_DOUBLE, MPI_MAX, m_exec_conf->getMPICommunicator());
+#endif
+        return t;
+        }
+
+    //! Write all results as a JSON array
+    void writeJSON(const std::string& filename) const
+        {
+        std::ofstream f(filename);
+        f << std::setprecision(10) << "[\n";
+        for (size_t i = 0; i < m_results.size(); i++)
+            {
+            const Result& r = m_results[i];
+            f << "  {\"suite\": \"" << r.suite << "\", \"name\": \"" << r.name
+              << "\", \"params\": {";
+            bool first = true;
+            for (const auto& [key, value] : r.params)
+                {
+                f << (first ? "" : ", ") << "\"" << key << "\": " << value;
+                first = false;
+                }
+            f << "}, \"ns_per_particle_step\": " << r.ns_per_particle_step
+              << ", \"min_ns_per_particle_step\": " << r.min_ns_per_particle_step
+              << ", \"allocations_per_step\": " << r.allocations_per_step
+              << ", \"steps\": " << r.steps << ", \"repeats\": " << r.repeats
+              << ", \"ranks\": " << m_exec_conf->getNRanks() << "}"
+              << (i + 1 < m_results.size() ? "," : "") << "\n";
+            }
+        f << "]\n";
+        }
+
+    std::string m_suite;                               //!< Name of the benchmark executable
+    std::shared_ptr<ExecutionConfiguration> m_exec_conf; //!< Execution configuration
+    std::string m_json_filename;                       //!< File to write results to
+    std::string m_filter;                              //!< Only run cases matching the filter
+    double m_min_time = 0.1;                           //!< Minimum duration of a repetition [s]
+    unsigned int m_repeats = 5;                        //!< Number of repetitions
+    bool m_quick = false;                              //!< Only run the smallest systems
+    std::vector<Result> m_results;                     //!< Results of all cases
+    };
+
+//! Generate a simple liquid-like configuration
+/*! \param N Number of particles
+    \param density Number density
+    \param seed Random number seed
+    \param jitter Maximum random displacement in units of the lattice spacing
+
+    Places the particles on a simple cubic lattice with ceil(cbrt(N)) sites per side and displaces
+    them randomly by up to 20% of the lattice spacing by default, which avoids the large forces of
+    random placement while breaking the lattice symmetry. When N is not a perfect cube, the
+    occupied sites are spread evenly over the lattice so that the density is uniform across the
+    box. Set \a jitter to 0 to place hard particles without overlaps.
+*/
+inline std::shared_ptr<SnapshotSystemData<Scalar>> makeFluidSnapshot(unsigned int N,
+                                                                       Scalar density,
+                                                                       uint16_t seed = 1,
+                                                                       Scalar jitter = Scalar(0.2))
+    {
+    auto snap = std::make_shared<SnapshotSystemData<Scalar>>();
+    Scalar L = std::cbrt(Scalar(N) / density);
+    snap->global_box = std::make_shared<BoxDim>(L);
+    snap->particle_data.type_mapping.push_back("A");
+    snap->particle_data.resize(N);
+
+    unsigned int n = (unsigned int)std::ceil(std::cbrt(Scalar(N)));
+    Scalar a = L / Scalar(n);
+    uint64_t n_sites = uint64_t(n) * n * n;
+    RandomGenerator rng(Seed(RNGIdentifier::Benchmark, 0, seed), Counter(N));
+    UniformDistribution<Scalar> displacement(-jitter * a, jitter * a);
+
+    for (unsigned int i = 0; i < N; i++)
+        {
+        // n_sites >= N, so the selected sites are distinct and evenly spaced in lattice order
+        unsigned int site = (unsigned int)(uint64_t(i) * n_sites / N);
+        unsigned int ix = site % n;
+        unsigned int iy = (site / n) % n;
+        unsigned int iz = site / (n * n);
+        vec3<Scalar> lattice_site(Scalar(ix) + Scalar(0.5),
+                                  Scalar(iy) + Scalar(0.5),
+                                  Scalar(iz) + Scalar(0.5));
+        vec3<Scalar> r = lattice_site * a - vec3<Scalar>(L, L, L) / Scalar(2.0);
+        r.x += displacement(rng);
+        r.y += displacement(rng);
+        r.z += displacement(rng);
+        snap->particle_data.pos[i] = r;
+        }
+
+    return snap;
+    }
+
+//! Generate a polymer melt of linear chains
+/*! \param n_chains Number of chains
+    \param chain_length Number of monomers per chain
+    \param density Monomer number density
+    \param seed Random number seed
+
+    The monomers are placed like makeFluidSnapshot() and consecutive lattice sites are bonded, so
+    bonds have lengths close to the lattice spacing. Bond type 0 is "backbone".
+*/
+inline std::shared_ptr<SnapshotSystemData<Scalar>> makePolymerMeltSnapshot(unsigned int n_chains,
+                                                                             unsigned int chain_length,
+                                                                             Scalar density,
+                                                                             uint16_t seed = 1)
+    {
+    auto snap = makeFluidSnapshot(n_chains * chain_length, density, seed);
+
+    snap->bond_data.type_mapping.push_back("backbone");
+    snap->bond_data.resize(n_chains * (chain_length - 1));
+    unsigned int b = 0;
+    for (unsigned int c = 0; c < n_chains; c++)
+        {
+        for (unsigned int m = 0; m + 1 < chain_length; m++)
+            {
+            BondData::members_t bond;
+            bond.tag[0] = c * chain_length + m;
+            bond.tag[1] = c * chain_length + m + 1;
+            snap->bond_data.groups[b] = bond;
+            snap->bond_data.type_id[b] = 0;
+            b++;
+            }
+        }
+
+    return snap;
+    }
+
+    } // end namespace benchmark
+    } // end namespace hoomd
+
+#ifdef ENABLE_MPI
+#define HOOMD_BENCHMARK_MAIN(suite_name, body)                                      \
+    int main(int argc, char** argv)                                                 \
+        {                                                                           \
+        MPI_Init(&argc, &argv);                                                     \
+            {                                                                       \
+            hoomd::benchmark::Harness harness(suite_name, argc, argv);              \
+            body(harness);                                                          \
+            }                                                                       \
+        MPI_Finalize();                                                             \
+        return 0;                                                                   \
+        }
+#else
+#define HOOMD_BENCHMARK_MAIN(suite_name, body)                                      \
+    int main(int argc, char** argv)                                                 \
+        {                                                                           \
+        hoomd::benchmark::Harness harness(suite_name, argc, argv);                  \
+        body(harness);                                                              \
+        return 0;                                                                   \
+        }
+#endif
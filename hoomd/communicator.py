@@ -271,6 +271,82 @@ class Communicator(object):
         """
         return self.cpp_mpi_conf.getWalltime()
 
+    @property
+    def exchange(self):
+        """str: Scheme that exchanges particles between domains.
+
+        * ``'staged'`` - Exchange particles with the 6 face neighbors in three
+          sequential passes (x, then y, then z). Particles that go to an edge
+          or corner neighbor are forwarded by the face neighbors.
+        * ``'neighbor'`` - Exchange particles with up to 26 neighbors in a
+          single ``MPI_Neighbor_alltoallv`` round on a distributed graph
+          topology.
+
+        With ``'neighbor'``, particle migration and the ghost particle updates
+        between neighbor list builds send directly to each neighbor. The ghost
+        updates reuse a persistent request and preallocated buffers when the
+        MPI library supports MPI 4.0. The ghost layer is still built with the
+        staged scheme. Particle migration falls back to the staged scheme in
+        systems with bonds, angles, dihedrals, impropers, constraints, special
+        pairs, or meshes.
+
+        The scheme applies to CPU simulations. Set `exchange` at any time. The
+        next time step migrates all particles with the new scheme.
+
+        Note:
+            Has no effect in builds with ENABLE_MPI=off.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            communicator.exchange = 'neighbor'
+        """
+        if hoomd.version.mpi_enabled:
+            return self.cpp_mpi_conf.exchange
+        else:
+            return 'staged'
+
+    @exchange.setter
+    def exchange(self, value):
+        if value not in ('staged', 'neighbor'):
+            raise ValueError("exchange must be 'staged' or 'neighbor'.")
+        if hoomd.version.mpi_enabled:
+            self.cpp_mpi_conf.exchange = value
+
+    @property
+    def shared_memory_ghosts(self):
+        """bool: Share ghost updates between ranks on the same node in memory.
+
+        When `True`, each rank writes the ghost data it sends to neighbors on
+        the same node into a shared memory window
+        (``MPI_Win_allocate_shared``). The neighbors then read it in place
+        after a barrier among the ranks of the node. This avoids a copy
+        through the MPI library for every ghost update between neighbor list
+        builds. Neighbors on other nodes still receive messages.
+
+        The setting applies to the ``'staged'`` `exchange` scheme on the CPU.
+        It takes effect at the next ghost exchange.
+
+        Note:
+            Has no effect in builds with ENABLE_MPI=off.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            communicator.shared_memory_ghosts = True
+        """
+        if hoomd.version.mpi_enabled:
+            return self.cpp_mpi_conf.shared_memory_ghosts
+        else:
+            return False
+
+    @shared_memory_ghosts.setter
+    def shared_memory_ghosts(self, value):
+        if hoomd.version.mpi_enabled:
+            self.cpp_mpi_conf.shared_memory_ghosts = bool(value)
+
 
 # store the "current" communicator to be used for MPI_Abort calls. This defaults
 # to the world communicator, but users can opt in to a more specific
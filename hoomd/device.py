@@ -35,11 +35,14 @@ See Also:
 
     # Rename pytest's tmp_path fixture for clarity in the documentation.
     path = tmp_path
+
+    simulation = hoomd.util.make_example_simulation()
 """
 
 import contextlib
 import hoomd
 from hoomd import _hoomd
+from hoomd.logging import log, Loggable
 import warnings
 
 
@@ -137,6 +140,12 @@ class Device:
         # name of the message file
         self._message_filename = message_filename
 
+        # operation profiler (created on first access)
+        self._profiler = None
+
+        # memory registry (created on first access)
+        self._memory = None
+
     @property
     def communicator(self):
         """hoomd.communicator.Communicator: The MPI Communicator [read only]."""
@@ -249,6 +258,21 @@ class Device:
         else:
             self._cpp_exec_conf.setNumThreads(int(num_cpu_threads))
 
+    @property
+    def profiler(self):
+        """Profiler: Record the time spent in each operation on this device."""
+        if self._profiler is None:
+            self._profiler = Profiler(self)
+        return self._profiler
+
+    @property
+    def memory(self):
+        """MemoryRegistry: Memory held by the simulation objects on this \
+        device."""
+        if self._memory is None:
+            self._memory = MemoryRegistry(self)
+        return self._memory
+
     def notice(self, message, level=1):
         """Write a notice message.
 
@@ -274,6 +298,245 @@ class Device:
         self._cpp_msg.notice(level, str(message) + "\n")
 
 
+class Profiler(metaclass=Loggable):
+    """Record the wall clock time spent in each operation.
+
+    Access the profiler of a device with `Device.profiler`.
+
+    When `enabled`, HOOMD-blue measures the time spent in every tuner, updater,
+    integrator, and writer that executes during `hoomd.Simulation.run`. The
+    profiler also measures the force computes, neighbor lists, and MPI
+    communication phases that execute within these operations. Each region
+    is named after the C++ class that implements the operation. The names of
+    nested regions include the enclosing regions separated by ``/``.
+
+    The profiler is disabled by default. When disabled, it adds no measurable
+    overhead.
+
+    .. rubric:: Example:
+
+    .. code-block:: python
+
+        simulation.device.profiler.enabled = True
+        simulation.run(100)
+        totals = simulation.device.profiler.totals
+
+    Note:
+        Operations that execute asynchronously on the GPU may report less
+        time than they use. The time is then accounted to the first region
+        that synchronizes with the GPU.
+    """
+
+    def __init__(self, device):
+        self._device = device
+
+    @property
+    def _cpp_obj(self):
+        if self._device._cpp_exec_conf is None:
+            raise RuntimeError("The device is not initialized.")
+        return self._device._cpp_exec_conf.getProfiler()
+
+    @property
+    def enabled(self):
+        """bool: Set to `True` to record the time spent in each operation.
+
+        (**default:** `False`)
+        """
+        return self._cpp_obj.enabled
+
+    @enabled.setter
+    def enabled(self, value):
+        self._cpp_obj.enabled = bool(value)
+
+    @property
+    def trace_capacity(self):
+        """int: Number of events kept per thread for `write_trace`.
+
+        The profiler keeps the most recent events and discards older ones.
+        Setting `trace_capacity` discards all recorded data.
+        (**default:** 65536).
+
+        Note:
+            All MPI ranks must set `trace_capacity` together.
+        """
+        return self._cpp_obj.trace_capacity
+
+    @trace_capacity.setter
+    def trace_capacity(self, value):
+        self._cpp_obj.trace_capacity = int(value)
+
+    @log(category='object')
+    def totals(self):
+        """dict[str, float]: Total time spent in each region on this rank \
+        :math:`[\\mathrm{s}]`."""
+        return self._cpp_obj.totals
+
+    @log(category='object')
+    def counts(self):
+        """dict[str, int]: Number of times each region executed on this \
+        rank."""
+        return self._cpp_obj.counts
+
+    @log(category='object')
+    def min_totals(self):
+        """dict[str, float]: Minimum of `totals` over the MPI ranks \
+        :math:`[\\mathrm{s}]`.
+
+        Note:
+            All MPI ranks must access `min_totals` together.
+        """
+        return self._cpp_obj.min_totals
+
+    @log(category='object')
+    def max_totals(self):
+        """dict[str, float]: Maximum of `totals` over the MPI ranks \
+        :math:`[\\mathrm{s}]`.
+
+        Compare `max_totals` to `min_totals` to find operations that are load
+        imbalanced between domains.
+
+        Note:
+            All MPI ranks must access `max_totals` together.
+        """
+        return self._cpp_obj.max_totals
+
+    def reset(self):
+        """Discard all recorded times and events.
+
+        `reset` also sets a new time origin for the trace that is common to
+        all MPI ranks.
+
+        Note:
+            All MPI ranks must call `reset` together.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            simulation.device.profiler.reset()
+        """
+        self._cpp_obj.reset()
+
+    def write_trace(self, filename):
+        """Write the recorded events to a trace file.
+
+        Args:
+            filename (str): Name of the file to write.
+
+        `write_trace` writes the most recent events in the Chrome trace event
+        JSON format. View the trace with https://ui.perfetto.dev or
+        chrome://tracing. Each MPI rank is one process in the trace.
+
+        Note:
+            All MPI ranks must call `write_trace` together. The root rank
+            writes the file.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            simulation.device.profiler.write_trace(
+                filename=path / 'trace.json')
+        """
+        self._cpp_obj.writeTrace(str(filename))
+
+
+class MemoryRegistry(metaclass=Loggable):
+    """Report the memory held by the simulation objects.
+
+    Access the memory registry of a device with `Device.memory`.
+
+    HOOMD-blue over-allocates arrays so that they rarely need to be resized:
+    the particle data arrays grow by a constant factor, the neighbor list
+    reserves room for the largest number of neighbors of each particle type
+    and grows by a constant factor, every cell in the cell list reserves room
+    for the fullest cell, and the MPI communication buffers keep their
+    largest size. `MemoryRegistry` reports the bytes that the particle data,
+    force computes, neighbor lists, cell lists, and MPI communicator allocated
+    and how many of these bytes hold data. Each object is named after the C++
+    class that implements it. When several objects have the same class, the
+    second and later names end in ``#2``, ``#3``, and so on.
+
+    All quantities are summed over the MPI ranks.
+
+    .. rubric:: Example:
+
+    .. code-block:: python
+
+        allocated = simulation.device.memory.allocated
+        used = simulation.device.memory.used
+
+    Note:
+        All MPI ranks must access the quantities and call `trim` together.
+
+    Note:
+        The reported bytes include the arrays that the objects share with
+        their base classes, but not arrays that only some subclasses (such as
+        the GPU implementations) allocate.
+    """
+
+    def __init__(self, device):
+        self._device = device
+
+    @property
+    def _cpp_obj(self):
+        if self._device._cpp_exec_conf is None:
+            raise RuntimeError("The device is not initialized.")
+        return self._device._cpp_exec_conf.getMemoryRegistry()
+
+    @log(category='object')
+    def allocated(self):
+        """dict[str, int]: Bytes allocated by each object."""
+        return self._cpp_obj.allocated
+
+    @log(category='object')
+    def used(self):
+        """dict[str, int]: Bytes of the allocation that hold data.
+
+        The difference between `allocated` and `used` is the slack that
+        `trim` can free.
+        """
+        return self._cpp_obj.used
+
+    @log(category='object')
+    def peak(self):
+        """dict[str, int]: Largest number of bytes each object allocated.
+
+        `peak` is sampled when the quantities are accessed and before `trim`
+        frees memory. The arrays only shrink when trimmed or when the state
+        is replaced.
+        """
+        return self._cpp_obj.peak
+
+    @log
+    def total_allocated(self):
+        """int: Bytes allocated by all objects."""
+        return sum(self._cpp_obj.allocated.values())
+
+    @log
+    def total_used(self):
+        """int: Bytes of the allocations of all objects that hold data."""
+        return sum(self._cpp_obj.used.values())
+
+    def trim(self):
+        """Free the slack of the particle data and neighbor list arrays.
+
+        `trim` shrinks the particle data arrays to the number of local and
+        ghost particles (the force computes follow) and the neighbor lists to
+        the size needed by their last build. The arrays grow again when the
+        simulation needs more memory. Call `trim` after a phase of the
+        simulation that needed more memory than the following phases, such
+        as compressing a dilute system.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            simulation.device.memory.trim()
+        """
+        self._cpp_obj.trim()
+
+
 def _create_messenger(mpi_config, notice_level, message_filename):
     msg = _hoomd.Messenger(mpi_config)
 
@@ -2136,6 +2136,77 @@ int gsd_write_chunk(struct gsd_handle* handle,
     return GSD_SUCCESS;
     }
 
+int gsd_reserve_chunk(struct gsd_handle* handle,
+                      const char* name,
+                      enum gsd_type type,
+                      uint64_t N,
+                      uint32_t M,
+                      uint8_t flags,
+                      uint64_t* location)
+    {
+    // validate input
+    if (handle == NULL || location == NULL)
+        {
+        return GSD_ERROR_INVALID_ARGUMENT;
+        }
+    if (M == 0)
+        {
+        return GSD_ERROR_INVALID_ARGUMENT;
+        }
+    if (handle->open_flags == GSD_OPEN_READONLY)
+        {
+        return GSD_ERROR_FILE_MUST_BE_WRITABLE;
+        }
+    if (flags != 0)
+        {
+        return GSD_ERROR_INVALID_ARGUMENT;
+        }
+    if (gsd_sizeof_type(type) == 0)
+        {
+        return GSD_ERROR_INVALID_ARGUMENT;
+        }
+
+    uint16_t id = gsd_name_id_map_find(&handle->name_map, name);
+    if (id == UINT16_MAX)
+        {
+        // not found, append to the index
+        int retval = gsd_append_name(&id, handle, name);
+        if (retval != GSD_SUCCESS)
+            {
+            return retval;
+            }
+
+        if (id == UINT16_MAX)
+            {
+            // this should never happen
+            return GSD_ERROR_NAMELIST_FULL;
+            }
+        }
+
+    // add an entry to the frame index
+    struct gsd_index_entry* index_entry;
+    int retval = gsd_index_buffer_add(&handle->frame_index, &index_entry);
+    if (retval != GSD_SUCCESS)
+        {
+        return retval;
+        }
+
+    gsd_util_zero_memory(index_entry, sizeof(struct gsd_index_entry));
+    index_entry->frame = handle->cur_frame;
+    index_entry->id = id;
+    index_entry->type = (uint8_t)type;
+    index_entry->N = N;
+    index_entry->M = M;
+
+    // reserve space at the end of the file for the chunk
+    index_entry->location = handle->file_size;
+    *location = handle->file_size;
+    handle->file_size += N * M * gsd_sizeof_type(type);
+
+    handle->pending_index_entries++;
+    return GSD_SUCCESS;
+    }
+
 uint64_t gsd_get_nframes(struct gsd_handle* handle)
     {
     if (handle == NULL)
@@ -2292,6 +2363,182 @@ int gsd_read_chunk(struct gsd_handle* handle, void* data, const struct gsd_index
     return GSD_SUCCESS;
     }
 
+int gsd_read_chunk_rows(struct gsd_handle* handle,
+                        void* data,
+                        const struct gsd_index_entry* chunk,
+                        uint64_t first_row,
+                        uint64_t n_rows)
+    {
+    if (handle == NULL)
+        {
+        return GSD_ERROR_INVALID_ARGUMENT;
+        }
+    if (chunk == NULL)
+        {
+        return GSD_ERROR_INVALID_ARGUMENT;
+        }
+    if (first_row + n_rows > chunk->N)
+        {
+        return GSD_ERROR_INVALID_ARGUMENT;
+        }
+    if (n_rows == 0)
+        {
+        return GSD_SUCCESS;
+        }
+    if (data == NULL)
+        {
+        return GSD_ERROR_INVALID_ARGUMENT;
+        }
+    if (handle->open_flags != GSD_OPEN_READONLY)
+        {
+        int retval = gsd_flush(handle);
+        if (retval != GSD_SUCCESS)
+            {
+            return retval;
+            }
+        }
+
+    size_t row_size = chunk->M * gsd_sizeof_type((enum gsd_type)chunk->type);
+    if (row_size == 0)
+        {
+        return GSD_ERROR_FILE_CORRUPT;
+        }
+    if (chunk->location == 0)
+        {
+        return GSD_ERROR_FILE_CORRUPT;
+        }
+
+    // validate that we don't read past the end of the file
+    if ((chunk->location + chunk->N * row_size) > (uint64_t)handle->file_size)
+        {
+        return GSD_ERROR_FILE_CORRUPT;
+        }
+
+    size_t size = n_rows * row_size;
+    ssize_t bytes_read
+        = gsd_io_pread_retry(handle->fd, data, size, chunk->location + first_row * row_size);
+    if (bytes_read == -1 || bytes_read != size)
+        {
+        return GSD_ERROR_IO;
+        }
+
+    return GSD_SUCCESS;
+    }
+
+int gsd_map_chunk_rows(struct gsd_handle* handle,
+                       struct gsd_chunk_view* view,
+                       const struct gsd_index_entry* chunk,
+                       uint64_t first_row,
+                       uint64_t n_rows)
+    {
+    if (handle == NULL || view == NULL || chunk == NULL)
+        {
+        return GSD_ERROR_INVALID_ARGUMENT;
+        }
+    if (first_row + n_rows > chunk->N)
+        {
+        return GSD_ERROR_INVALID_ARGUMENT;
+        }
+
+    memset(view, 0, sizeof(struct gsd_chunk_view));
+    if (n_rows == 0)
+        {
+        return GSD_SUCCESS;
+        }
+
+    if (handle->open_flags != GSD_OPEN_READONLY)
+        {
+        int retval = gsd_flush(handle);
+        if (retval != GSD_SUCCESS)
+            {
+            return retval;
+            }
+        }
+
+    size_t row_size = chunk->M * gsd_sizeof_type((enum gsd_type)chunk->type);
+    if (row_size == 0)
+        {
+        return GSD_ERROR_FILE_CORRUPT;
+        }
+    if (chunk->location == 0)
+        {
+        return GSD_ERROR_FILE_CORRUPT;
+        }
+
+    // validate that we don't map past the end of the file
+    if ((chunk->location + chunk->N * row_size) > (uint64_t)handle->file_size)
+        {
+        return GSD_ERROR_FILE_CORRUPT;
+        }
+
+    size_t size = n_rows * row_size;
+    uint64_t location = chunk->location + first_row * row_size;
+
+#if GSD_USE_MMAP
+    // mmap requires an offset aligned to the page size
+    size_t page_size = getpagesize();
+    size_t offset = (location / page_size) * page_size;
+    void* mapped_data
+        = mmap(NULL, size + (location - offset), PROT_READ, MAP_SHARED, handle->fd, offset);
+
+    if (mapped_data == MAP_FAILED)
+        {
+        return GSD_ERROR_IO;
+        }
+
+    view->mapped_data = mapped_data;
+    view->mapped_len = size + (location - offset);
+    view->data = ((char*)mapped_data) + (location - offset);
+#else
+    // mmap not supported, read the data from the disk
+    view->allocated_data = malloc(size);
+    if (view->allocated_data == NULL)
+        {
+        return GSD_ERROR_MEMORY_ALLOCATION_FAILED;
+        }
+
+    ssize_t bytes_read = gsd_io_pread_retry(handle->fd, view->allocated_data, size, location);
+    if (bytes_read == -1 || bytes_read != size)
+        {
+        free(view->allocated_data);
+        view->allocated_data = NULL;
+        return GSD_ERROR_IO;
+        }
+    view->data = view->allocated_data;
+#endif
+
+    view->size = size;
+    return GSD_SUCCESS;
+    }
+
+int gsd_unmap_chunk(struct gsd_chunk_view* view)
+    {
+    if (view == NULL)
+        {
+        return GSD_ERROR_INVALID_ARGUMENT;
+        }
+
+#if GSD_USE_MMAP
+    if (view->mapped_data)
+        {
+        int retval = munmap(view->mapped_data, view->mapped_len);
+
+        if (retval != 0)
+            {
+            return GSD_ERROR_IO;
+            }
+        }
+#endif
+
+    if (view->allocated_data)
+        {
+        free(view->allocated_data);
+        }
+
+    memset(view, 0, sizeof(struct gsd_chunk_view));
+    return GSD_SUCCESS;
+    }
+
 size_t gsd_sizeof_type(enum gsd_type type)
     {
     size_t val = 0;
@@ -268,6 +268,28 @@ extern "C"
         size_t n_names;
         };
 
+    /** Read-only view of a range of rows of a data chunk
+
+        Points to a mapped location of the chunk in the file or to an in-memory buffer.
+    */
+    struct gsd_chunk_view
+        {
+        /// Pointer to the first byte of the range
+        const void* data;
+
+        /// Number of bytes in the range
+        size_t size;
+
+        /// Pointer to mapped data (NULL if not mapped)
+        void* mapped_data;
+
+        /// Number of bytes mapped
+        size_t mapped_len;
+
+        /// Pointer to allocated data (NULL if mapped)
+        void* allocated_data;
+        };
+
     /** File handle
 
         A handle to an open GSD file.
@@ -529,6 +551,42 @@ extern "C"
                         uint8_t flags,
                         const void* data);
 
+    /** Add a data chunk to the current frame without writing its data.
+
+        @param handle Handle to an open GSD file.
+        @param name Name of the data chunk.
+        @param type type ID that identifies the type of data in the chunk.
+        @param N Number of rows in the data.
+        @param M Number of columns in the data.
+        @param flags set to 0, non-zero values reserved for future use.
+        @param location Output: offset of the chunk's data in the file.
+
+        @pre *handle* was opened by gsd_open().
+        @pre *name* is a unique name for data chunks in the given frame.
+
+        @post `N * M * gsd_sizeof_type(type)` bytes at the end of the file are reserved for the
+              chunk and the index entry is present in the buffer.
+
+        The caller must write the chunk's data at *location* (for example, in parallel from many
+        processes) and make it durable before the index is flushed by gsd_end_frame() or
+        gsd_flush().
+
+        @return
+          - GSD_SUCCESS (0) on success. Negative value on failure:
+          - GSD_ERROR_INVALID_ARGUMENT: *handle* is NULL, *location* is NULL, *M* == 0, *type* is
+            invalid, or *flags* != 0.
+          - GSD_ERROR_FILE_MUST_BE_WRITABLE: The file was opened read-only.
+          - GSD_ERROR_NAMELIST_FULL: The file cannot store any additional unique chunk names.
+          - GSD_ERROR_MEMORY_ALLOCATION_FAILED: failed to allocate memory.
+    */
+    int gsd_reserve_chunk(struct gsd_handle* handle,
+                          const char* name,
+                          enum gsd_type type,
+                          uint64_t N,
+                          uint32_t M,
+                          uint8_t flags,
+                          uint64_t* location);
+
     /** Find a chunk in the GSD file.
 
         @param handle Handle to an open GSD file
@@ -569,6 +627,82 @@ extern "C"
     */
     int gsd_read_chunk(struct gsd_handle* handle, void* data, const struct gsd_index_entry* chunk);
 
+    /** Read a range of rows of a chunk from the GSD file.
+
+        @param handle Handle to an open GSD file.
+        @param data Data buffer to read into.
+        @param chunk Chunk to read.
+        @param first_row Index of the first row to read.
+        @param n_rows Number of rows to read.
+
+        @pre *handle* was opened in read or readwrite mode.
+        @pre *chunk* was found by gsd_find_chunk().
+        @pre *data* points to an allocated buffer with at least `n_rows * M * gsd_sizeof_type(type)`
+       bytes.
+
+        Many processes may each read a different range of rows of the same chunk.
+
+        @return
+          - GSD_SUCCESS (0) on success. Negative value on failure:
+          - GSD_ERROR_IO: IO error (check errno).
+          - GSD_ERROR_INVALID_ARGUMENT: *handle* is NULL, *data* is NULL and *n_rows* > 0, *chunk*
+            is NULL, or the range exceeds the N rows of the chunk.
+          - GSD_ERROR_FILE_CORRUPT: The GSD file is corrupt.
+
+        @note gsd_read_chunk_rows() calls gsd_flush() when the file is writable.
+    */
+    int gsd_read_chunk_rows(struct gsd_handle* handle,
+                            void* data,
+                            const struct gsd_index_entry* chunk,
+                            uint64_t first_row,
+                            uint64_t n_rows);
+
+    /** Map a range of rows of a chunk from the GSD file into memory.
+
+        @param handle Handle to an open GSD file.
+        @param view View to initialize.
+        @param chunk Chunk to map.
+        @param first_row Index of the first row to map.
+        @param n_rows Number of rows to map.
+
+        @pre *handle* was opened in read or readwrite mode.
+        @pre *chunk* was found by gsd_find_chunk().
+
+        @post *view->data* points to the `n_rows * M * gsd_sizeof_type(type)` bytes of the rows.
+
+        On systems that support mmap, the view maps the rows of the file and reads them on demand
+        without copying. On others, the view allocates a buffer and reads the rows into it. Call
+        gsd_unmap_chunk() to release the view. The view remains valid after gsd_close().
+
+        @return
+          - GSD_SUCCESS (0) on success. Negative value on failure:
+          - GSD_ERROR_IO: IO error (check errno).
+          - GSD_ERROR_INVALID_ARGUMENT: *handle* is NULL, *view* is NULL, *chunk* is NULL, or the
+            range exceeds the N rows of the chunk.
+          - GSD_ERROR_FILE_CORRUPT: The GSD file is corrupt.
+          - GSD_ERROR_MEMORY_ALLOCATION_FAILED: failed to allocate memory.
+
+        @note gsd_map_chunk_rows() calls gsd_flush() when the file is writable.
+    */
+    int gsd_map_chunk_rows(struct gsd_handle* handle,
+                           struct gsd_chunk_view* view,
+                           const struct gsd_index_entry* chunk,
+                           uint64_t first_row,
+                           uint64_t n_rows);
+
+    /** Release a view created by gsd_map_chunk_rows().
+
+        @param view View to release.
+
+        @post *view* is empty.
+
+        @return
+          - GSD_SUCCESS (0) on success. Negative value on failure:
+          - GSD_ERROR_IO: IO error (check errno).
+          - GSD_ERROR_INVALID_ARGUMENT: *view* is NULL.
+    */
+    int gsd_unmap_chunk(struct gsd_chunk_view* view);
+
     /** Get the number of frames in the GSD file.
 
         @param handle Handle to an open GSD file
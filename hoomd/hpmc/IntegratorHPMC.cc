@@ -126,6 +126,18 @@ bool IntegratorHPMC::checkParticleOrientations()
     \returns false if resize results in overlaps
 */
 bool IntegratorHPMC::attemptBoxResize(uint64_t timestep, const BoxDim& new_box)
+    {
+    scaleParticlesToBox(new_box);
+
+    // check overlaps
+    return !this->countOverlaps(true);
+    }
+
+/*! \param new_box The new box
+
+    Particles keep their fractional coordinates. Communicates the moved particles.
+*/
+void IntegratorHPMC::scaleParticlesToBox(const BoxDim& new_box)
     {
     unsigned int N = m_pdata->getN();
 
@@ -165,9 +177,6 @@ bool IntegratorHPMC::attemptBoxResize(uint64_t timestep, const BoxDim& new_box)
 
     // we have moved particles, communicate those changes
     this->communicate(false);
-
-    // check overlaps
-    return !this->countOverlaps(true);
     }
 
 /*! \param mode 0 -> Absolute count, 1 -> relative to the start of the run, 2 -> relative to the
@@ -405,6 +405,26 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
     //! Method to scale the box
     virtual bool attemptBoxResize(uint64_t timestep, const BoxDim& new_box);
 
+    /// Scale the particles and the origin into a new box without checking for overlaps
+    void scaleParticlesToBox(const BoxDim& new_box);
+
+    /** Evaluate a trial box without moving the particles.
+
+        @param timestep Current time step.
+        @param new_box Trial box.
+        @param allowed Set to true when there are no overlaps in the trial box.
+        @param delta_U_pair Set to the change in the total pair energy when allowed.
+        @returns true when the trial was evaluated. false when the caller must scale the particles
+            and call attemptBoxResize instead.
+    */
+    virtual bool evaluateBoxResize(uint64_t timestep,
+                                   const BoxDim& new_box,
+                                   bool& allowed,
+                                   double& delta_U_pair)
+        {
+        return false;
+        }
+
     ExternalField* getExternalField()
         {
         return m_external_base;
@@ -435,6 +455,12 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
         return 0.0;
         }
 
+    /// Compute the total potential energy from pair and external interactions.
+    virtual double computeTotalPotentialEnergy(uint64_t timestep)
+        {
+        return computeTotalPairEnergy(timestep) + computeTotalExternalEnergy();
+        }
+
     //! Prepare for the run
     virtual void prepRun(uint64_t timestep)
         {
@@ -12,6 +12,7 @@
 #include <iostream>
 #include <iomanip>
 #include <sstream>
+#include <algorithm>
 
 #include "hoomd/Integrator.h"
 #include "IntegratorHPMC.h"
@@ -220,6 +221,18 @@ class IntegratorHPMCMono : public IntegratorHPMC
         //! Method to scale the box
         virtual bool attemptBoxResize(uint64_t timestep, const BoxDim& new_box);
 
+        //! Evaluate a trial box on a cached pair list without moving the particles
+        virtual bool evaluateBoxResize(uint64_t timestep, const BoxDim& new_box, bool& allowed, double& delta_U_pair);
+
+        //! Evaluate a trial box and return (evaluated, allowed, delta_U_pair) to python
+        pybind11::tuple evaluateBoxResizePy(uint64_t timestep, const BoxDim& new_box)
+            {
+            bool allowed = false;
+            double delta_U_pair = 0.0;
+            const bool evaluated = evaluateBoxResize(timestep, new_box, allowed, delta_U_pair);
+            return pybind11::make_tuple(evaluated, allowed, delta_U_pair);
+            }
+
         /*
          * Common HPMC API
          */
@@ -456,6 +469,32 @@ class IntegratorHPMCMono : public IntegratorHPMC
         /// Cached shape radius by type.
         std::vector<LongReal> m_shape_circumsphere_radius;
 
+        /// Interaction range covered by the image list
+        Scalar m_image_list_range = 0;
+
+        /// A pair of particles that may interact after a box move
+        struct BoxResizePair
+            {
+            unsigned int i;   //!< Index of the first particle
+            unsigned int j;   //!< Index of the second particle
+            int3 image;       //!< Lattice shift from unwrapped i to the listed image of unwrapped j
+            };
+
+        /// Candidate pairs for box trial moves, closest to overlapping first
+        std::vector<BoxResizePair> m_box_resize_pairs;
+
+        /// Box in which m_box_resize_pairs was built
+        BoxDim m_box_resize_box;
+
+        /// Tag (x) and type (y) of each particle when m_box_resize_pairs was built
+        std::vector<uint2> m_box_resize_particle;
+
+        /// Unwrapped fractional coordinates of each particle when m_box_resize_pairs was built
+        std::vector<vec3<LongReal> > m_box_resize_fraction;
+
+        /// Radius of m_box_resize_pairs in m_box_resize_box, by type
+        std::vector<LongReal> m_box_resize_list_radius;
+
         /* Depletants related data members */
 
         GlobalVector<Scalar> m_fugacity;            //!< Average depletant number density in free volume, per type
@@ -481,6 +520,10 @@ class IntegratorHPMCMono : public IntegratorHPMC
         //! Limit the maximum move distances
         virtual void limitMoveDistances();
 
+        /// Rebuild m_box_resize_pairs in the current configuration
+        void buildBoxResizePairs(const std::vector<LongReal>& list_radius,
+                                 const std::vector<LongReal>& circumsphere_radius);
+
         //! callback so that the box change signal can invalidate the image list
         virtual void slotBoxChanged()
             {
@@ -608,6 +651,9 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
     m_exec_conf->msg->notice(10) << "HPMCMono update: " << timestep << std::endl;
     IntegratorHPMC::update(timestep);
 
+    // measure the time spent in trial moves for cost-based load balancing
+    ScopedComputeTime compute_time(m_exec_conf->getProfiler());
+
     // get needed vars
     ArrayHandle<hpmc_counters_t> h_counters(m_count_total, access_location::host, access_mode::readwrite);
     hpmc_counters_t& counters = h_counters.data[0];
@@ -1056,6 +1102,8 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
         }
     #endif
 
+    compute_time.stop();
+
     // migrate and exchange particles
     communicate(true);
 
@@ -1525,6 +1573,7 @@ inline const std::vector<vec3<Scalar> >& IntegratorHPMCMono<Shape>::updateImageL
 
     // add any extra requested width
     range += m_extra_image_width;
+    m_image_list_range = range;
 
     m_exec_conf->msg->notice(6) << "Image list: range = " << range << std::endl;
 
@@ -1548,10 +1597,11 @@ inline const std::vector<vec3<Scalar> >& IntegratorHPMCMono<Shape>::updateImageL
         #ifdef ENABLE_MPI
         if (m_pdata->getDomainDecomposition())
             {
-            Index3D di = m_pdata->getDomainDecomposition()->getDomainIndexer();
-            if (di.getW() > 1) x_max = 0;
-            if (di.getH() > 1) y_max = 0;
-            if (di.getD() > 1) z_max = 0;
+            // the local box is periodic only along the axes that are not decomposed
+            uchar3 periodic = m_pdata->getBox().getPeriodic();
+            if (!periodic.x) x_max = 0;
+            if (!periodic.y) y_max = 0;
+            if (!periodic.z) z_max = 0;
             }
         #endif
 
@@ -2717,6 +2767,396 @@ bool IntegratorHPMCMono<Shape>::attemptBoxResize(uint64_t timestep, const BoxDim
     return result;
     }
 
+/*! \param list_radius Radius of the pair list by type
+    \param circumsphere_radius Circumsphere radius by type
+
+    Collect all pairs within list_radius of the first particle in one AABB tree traversal and sort
+    them by circumsphere gap. Record the tags, types, and unwrapped fractional coordinates of the
+    particles so that later box trials can bound how far the particles have moved since.
+*/
+template<class Shape>
+void IntegratorHPMCMono<Shape>::buildBoxResizePairs(const std::vector<LongReal>& list_radius,
+                                                    const std::vector<LongReal>& circumsphere_radius)
+    {
+    buildAABBTree();
+
+    const BoxDim box = m_pdata->getGlobalBox();
+    const unsigned int N = m_pdata->getN();
+
+    ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
+
+    m_box_resize_box = box;
+    m_box_resize_list_radius = list_radius;
+    m_box_resize_particle.resize(N);
+    m_box_resize_fraction.resize(N);
+    for (unsigned int i = 0; i < N; i++)
+        {
+        const int3 image_i = h_image.data[i];
+        m_box_resize_particle[i] = make_uint2(h_tag.data[i], __scalar_as_int(h_postype.data[i].w));
+        m_box_resize_fraction[i] = vec3<LongReal>(box.makeFraction(vec3<Scalar>(h_postype.data[i])))
+                                   + vec3<LongReal>(image_i.x, image_i.y, image_i.z);
+        }
+
+    std::vector<std::pair<LongReal, BoxResizePair> > pairs;
+    const unsigned int n_images = (unsigned int)m_image_list.size();
+    for (unsigned int i = 0; i < N; i++)
+        {
+        const Scalar4 postype_i = h_postype.data[i];
+        const unsigned int typ_i = __scalar_as_int(postype_i.w);
+        const vec3<Scalar> pos_i = vec3<Scalar>(postype_i);
+        const int3 image_i = h_image.data[i];
+        const LongReal R_i = list_radius[typ_i];
+        const hoomd::detail::AABB aabb_i_local(vec3<Scalar>(0, 0, 0), R_i);
+
+        for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
+            {
+            vec3<Scalar> pos_i_image = pos_i + m_image_list[cur_image];
+            hoomd::detail::AABB aabb = aabb_i_local;
+            aabb.translate(pos_i_image);
+
+            // stackless search
+            for (unsigned int cur_node_idx = 0; cur_node_idx < m_aabb_tree.getNumNodes(); cur_node_idx++)
+                {
+                if (aabb.overlaps(m_aabb_tree.getNodeAABB(cur_node_idx)))
+                    {
+                    if (m_aabb_tree.isNodeLeaf(cur_node_idx))
+                        {
+                        for (unsigned int cur_p = 0; cur_p < m_aabb_tree.getNodeNumParticles(cur_node_idx); cur_p++)
+                            {
+                            unsigned int j = m_aabb_tree.getNodeParticle(cur_node_idx, cur_p);
+
+                            // skip i==j in the 0 image
+                            if (cur_image == 0 && i == j)
+                                continue;
+
+                            // count unique pairs
+                            if (h_tag.data[i] > h_tag.data[j])
+                                continue;
+
+                            const vec3<LongReal> r_ij = vec3<LongReal>(vec3<Scalar>(h_postype.data[j]) - pos_i_image);
+                            const LongReal r_squared = dot(r_ij, r_ij);
+                            if (r_squared <= R_i * R_i)
+                                {
+                                // r_ij = unwrapped j - unwrapped i - image . lattice vectors
+                                const int3 hkl = m_image_hkl[cur_image];
+                                const int3 image_j = h_image.data[j];
+                                const BoxResizePair pair = {i,
+                                                            j,
+                                                            make_int3(image_j.x - image_i.x + hkl.x,
+                                                                      image_j.y - image_i.y + hkl.y,
+                                                                      image_j.z - image_i.z + hkl.z)};
+                                const unsigned int typ_j = __scalar_as_int(h_postype.data[j].w);
+                                const LongReal gap = fast::sqrt(r_squared) - circumsphere_radius[typ_i]
+                                                     - circumsphere_radius[typ_j];
+                                pairs.push_back(std::make_pair(gap, pair));
+                                }
+                            }
+                        }
+                    }
+                else
+                    {
+                    // skip ahead
+                    cur_node_idx += m_aabb_tree.getNodeSkip(cur_node_idx);
+                    }
+                } // end loop over AABB nodes
+            } // end loop over images
+        } // end loop over particles
+
+    // test the pairs that are closest to overlapping first
+    std::sort(pairs.begin(),
+              pairs.end(),
+              [](const std::pair<LongReal, BoxResizePair>& a, const std::pair<LongReal, BoxResizePair>& b)
+              { return a.first < b.first; });
+
+    m_box_resize_pairs.clear();
+    m_box_resize_pairs.reserve(pairs.size());
+    for (const auto& pair : pairs)
+        m_box_resize_pairs.push_back(pair.second);
+    }
+
+/*! \param timestep Current time step
+    \param new_box Trial box
+    \param allowed Set to true when there are no overlaps in the trial box
+    \param delta_U_pair Set to the change in the total pair energy when allowed
+    \returns true when the trial was evaluated
+
+    Separations between particles transform linearly with the box: r_new = M r_old, where M maps
+    the current lattice vectors onto the trial lattice vectors. evaluateBoxResize keeps a list of
+    all pairs within a list radius of each other, built in the reference box in which the list was
+    last rebuilt, and reuses it across trials. A pair outside of the list radius L in the reference
+    box is at least L / ||M_ref^{-1}|| - d apart in another box, where M_ref maps the reference
+    lattice vectors onto those of the other box and d bounds the change of the separation caused
+    by the particle displacements since the rebuild. The list is rebuilt only when that bound falls
+    below the interaction range in either the current or the trial box. The extra skin in the list
+    radius lets many trials and many sweeps of particle moves share one list.
+
+    Bounding the displacements requires one pass over the particles per trial, but no tree
+    traversal and no sort. The pairs are tested in the order of their circumsphere gap at the
+    rebuild so that rejected compressions exit early, and both pair energies are evaluated from
+    the listed separations. The particles are not moved.
+
+    Domain decomposed simulations, simulations with depletants, and trials that stretch the
+    interaction range beyond the image list use the full path through attemptBoxResize.
+*/
+template<class Shape>
+bool IntegratorHPMCMono<Shape>::evaluateBoxResize(uint64_t timestep,
+                                                  const BoxDim& new_box,
+                                                  bool& allowed,
+                                                  double& delta_U_pair)
+    {
+    if (m_sysdef->isDomainDecomposed() || !m_past_first_run)
+        return false;
+
+    for (unsigned int ptype = 0; ptype < this->m_pdata->getNTypes(); ++ptype)
+        {
+        if (getDepletantFugacity(ptype) != 0.0)
+            return false;
+        }
+
+    const BoxDim cur_box = m_pdata->getGlobalBox();
+    const unsigned int ndim = m_sysdef->getNDimensions();
+
+    // map a separation vector from one box to another, keeping its fractional coordinates
+    auto transform = [ndim](const BoxDim& from, const BoxDim& to, const vec3<LongReal>& r)
+        {
+        const vec3<LongReal> a1(from.getLatticeVector(0));
+        const vec3<LongReal> a2(from.getLatticeVector(1));
+        const vec3<LongReal> a3(from.getLatticeVector(2));
+        LongReal c3 = (ndim == 3) ? r.z / a3.z : LongReal(0.0);
+        LongReal c2 = (r.y - c3 * a3.y) / a2.y;
+        LongReal c1 = (r.x - c2 * a2.x - c3 * a3.x) / a1.x;
+        vec3<LongReal> result = c1 * vec3<LongReal>(to.getLatticeVector(0))
+                                + c2 * vec3<LongReal>(to.getLatticeVector(1));
+        if (ndim == 3)
+            result += c3 * vec3<LongReal>(to.getLatticeVector(2));
+        else
+            result.z = r.z;
+        return result;
+        };
+
+    // bound the spectral norm of the map from one box to another with sqrt(||T||_1 ||T||_inf)
+    auto stretch_bound = [ndim, &transform](const BoxDim& from, const BoxDim& to)
+        {
+        LongReal column_sum[3] = {0, 0, 0};
+        LongReal row_sum[3] = {0, 0, 0};
+        for (unsigned int k = 0; k < ndim; k++)
+            {
+            vec3<LongReal> e_k(0, 0, 0);
+            if (k == 0) e_k.x = 1;
+            if (k == 1) e_k.y = 1;
+            if (k == 2) e_k.z = 1;
+            const vec3<LongReal> u = transform(from, to, e_k);
+            column_sum[k] = fabs(u.x) + fabs(u.y) + fabs(u.z);
+            row_sum[0] += fabs(u.x);
+            row_sum[1] += fabs(u.y);
+            row_sum[2] += fabs(u.z);
+            }
+        const LongReal max_column = std::max(column_sum[0], std::max(column_sum[1], column_sum[2]));
+        const LongReal max_row = std::max(row_sum[0], std::max(row_sum[1], row_sum[2]));
+        return std::max(LongReal(1.0), slow::sqrt(max_column * max_row));
+        };
+
+    // interaction range of each type
+    const unsigned int n_types = m_pdata->getNTypes();
+    std::vector<LongReal> circumsphere_radius(n_types);
+    LongReal max_circumsphere_radius = 0;
+    LongReal max_additive_cutoff = 0;
+    for (unsigned int typ = 0; typ < n_types; typ++)
+        {
+        Shape shape(quat<Scalar>(), m_params[typ]);
+        circumsphere_radius[typ] = LongReal(0.5) * shape.getCircumsphereDiameter();
+        max_circumsphere_radius = std::max(max_circumsphere_radius, circumsphere_radius[typ]);
+        max_additive_cutoff = std::max(max_additive_cutoff, getMaxPairInteractionAdditiveRCut(typ));
+        }
+
+    const bool has_pair_interactions = hasPairInteractions();
+    const LongReal max_pair_r_cut = has_pair_interactions ? getMaxPairEnergyRCutNonAdditive() : LongReal(0.0);
+
+    std::vector<LongReal> interaction_range(n_types);
+    LongReal max_interaction_range = 0;
+    for (unsigned int typ = 0; typ < n_types; typ++)
+        {
+        LongReal r = circumsphere_radius[typ] + max_circumsphere_radius;
+        if (has_pair_interactions)
+            {
+            r = std::max(r, max_pair_r_cut + LongReal(0.5) * (getMaxPairInteractionAdditiveRCut(typ) + max_additive_cutoff));
+            }
+        interaction_range[typ] = r;
+        max_interaction_range = std::max(max_interaction_range, r);
+        }
+
+    // bound the displacements since the last rebuild by the spread of the change in the unwrapped
+    // fractional coordinates, which is invariant to the random origin shifts of the particle moves
+    const unsigned int N = m_pdata->getN();
+    bool rebuild = m_box_resize_particle.size() != N || m_box_resize_list_radius.size() != n_types;
+    LongReal width[3] = {0, 0, 0};
+    if (!rebuild)
+        {
+        ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::read);
+        ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
+
+        LongReal lo[3] = {0, 0, 0};
+        LongReal hi[3] = {0, 0, 0};
+        for (unsigned int i = 0; i < N; i++)
+            {
+            const uint2 particle = m_box_resize_particle[i];
+            if (particle.x != h_tag.data[i] || particle.y != (unsigned int)__scalar_as_int(h_postype.data[i].w))
+                {
+                rebuild = true;
+                break;
+                }
+
+            const int3 image_i = h_image.data[i];
+            const vec3<LongReal> delta = vec3<LongReal>(cur_box.makeFraction(vec3<Scalar>(h_postype.data[i])))
+                                         + vec3<LongReal>(image_i.x, image_i.y, image_i.z)
+                                         - m_box_resize_fraction[i];
+            const LongReal delta_c[3] = {delta.x, delta.y, delta.z};
+            for (unsigned int c = 0; c < 3; c++)
+                {
+                lo[c] = (i == 0) ? delta_c[c] : std::min(lo[c], delta_c[c]);
+                hi[c] = (i == 0) ? delta_c[c] : std::max(hi[c], delta_c[c]);
+                }
+            }
+
+        for (unsigned int c = 0; c < 3; c++)
+            width[c] = hi[c] - lo[c];
+        }
+
+    // the list holds every pair within range in box when no pair outside of the list radius in the
+    // reference box can have come within range
+    auto list_covers = [&](const BoxDim& box)
+        {
+        const LongReal stretch = stretch_bound(box, m_box_resize_box);
+        LongReal displacement = 0;
+        for (unsigned int c = 0; c < ndim; c++)
+            {
+            const vec3<LongReal> a(box.getLatticeVector(c));
+            displacement += width[c] * slow::sqrt(dot(a, a));
+            }
+
+        for (unsigned int typ = 0; typ < n_types; typ++)
+            {
+            if (m_box_resize_list_radius[typ] / stretch - displacement < interaction_range[typ])
+                return false;
+            }
+        return true;
+        };
+
+    if (!rebuild)
+        rebuild = !list_covers(cur_box) || !list_covers(new_box);
+
+    if (rebuild)
+        {
+        updateImageList();
+
+        // the image list must cover the interaction range stretched into the trial box
+        const LongReal stretch = stretch_bound(new_box, cur_box);
+        const LongReal skin = LongReal(0.25) * max_interaction_range;
+        std::vector<LongReal> list_radius(n_types);
+        for (unsigned int typ = 0; typ < n_types; typ++)
+            {
+            const LongReal required_radius = interaction_range[typ] * stretch;
+            if (required_radius > m_image_list_range)
+                return false;
+            list_radius[typ] = std::min(required_radius + skin, LongReal(m_image_list_range));
+            }
+
+        buildBoxResizePairs(list_radius, circumsphere_radius);
+        }
+
+    ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_diameter(m_pdata->getDiameters(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
+    ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_overlaps(m_overlaps, access_location::host, access_mode::read);
+
+    // separation of a listed pair in the current box
+    const vec3<LongReal> a1(cur_box.getLatticeVector(0));
+    const vec3<LongReal> a2(cur_box.getLatticeVector(1));
+    const vec3<LongReal> a3(cur_box.getLatticeVector(2));
+    auto separation = [&](const BoxResizePair& pair)
+        {
+        const int3 image_i = h_image.data[pair.i];
+        const int3 image_j = h_image.data[pair.j];
+        return vec3<LongReal>(vec3<Scalar>(h_postype.data[pair.j]) - vec3<Scalar>(h_postype.data[pair.i]))
+               + LongReal(image_j.x - image_i.x - pair.image.x) * a1
+               + LongReal(image_j.y - image_i.y - pair.image.y) * a2
+               + LongReal(image_j.z - image_i.z - pair.image.z) * a3;
+        };
+
+    unsigned int err_count = 0;
+    for (const auto& pair : m_box_resize_pairs)
+        {
+        const unsigned int typ_i = __scalar_as_int(h_postype.data[pair.i].w);
+        const unsigned int typ_j = __scalar_as_int(h_postype.data[pair.j].w);
+        if (!h_overlaps.data[m_overlap_idx(typ_i, typ_j)])
+            continue;
+
+        const vec3<LongReal> r_new = transform(cur_box, new_box, separation(pair));
+        const LongReal max_overlap_distance = circumsphere_radius[typ_i] + circumsphere_radius[typ_j];
+        if (dot(r_new, r_new) > max_overlap_distance * max_overlap_distance)
+            continue;
+
+        Shape shape_i(quat<Scalar>(h_orientation.data[pair.i]), m_params[typ_i]);
+        Shape shape_j(quat<Scalar>(h_orientation.data[pair.j]), m_params[typ_j]);
+        const vec3<Scalar> r_ij(r_new);
+
+        if (test_overlap(r_ij, shape_i, shape_j, err_count)
+            && test_overlap(-r_ij, shape_j, shape_i, err_count))
+            {
+            allowed = false;
+            return true;
+            }
+        }
+
+    allowed = true;
+    delta_U_pair = 0.0;
+
+    if (has_pair_interactions)
+        {
+        for (const auto& pair : m_box_resize_pairs)
+            {
+            const unsigned int typ_i = __scalar_as_int(h_postype.data[pair.i].w);
+            const unsigned int typ_j = __scalar_as_int(h_postype.data[pair.j].w);
+            const quat<LongReal> orientation_i(h_orientation.data[pair.i]);
+            const quat<LongReal> orientation_j(h_orientation.data[pair.j]);
+            const LongReal d_i = h_diameter.data[pair.i];
+            const LongReal d_j = h_diameter.data[pair.j];
+            const LongReal charge_i = h_charge.data[pair.i];
+            const LongReal charge_j = h_charge.data[pair.j];
+            const vec3<LongReal> r_old = separation(pair);
+            const vec3<LongReal> r_new = transform(cur_box, new_box, r_old);
+
+            delta_U_pair += computeOnePairEnergy(dot(r_new, r_new),
+                                                 r_new,
+                                                 typ_i,
+                                                 orientation_i,
+                                                 d_i,
+                                                 charge_i,
+                                                 typ_j,
+                                                 orientation_j,
+                                                 d_j,
+                                                 charge_j);
+            delta_U_pair -= computeOnePairEnergy(dot(r_old, r_old),
+                                                 r_old,
+                                                 typ_i,
+                                                 orientation_i,
+                                                 d_i,
+                                                 charge_i,
+                                                 typ_j,
+                                                 orientation_j,
+                                                 d_j,
+                                                 charge_j);
+            }
+        }
+
+    return true;
+    }
+
 namespace detail {
 
 //! Export the IntegratorHPMCMono class to python
@@ -2743,6 +3183,7 @@ template < class Shape > void export_IntegratorHPMCMono(pybind11::module& m, con
           .def("getShape", &IntegratorHPMCMono<Shape>::getShape)
           .def("setShape", &IntegratorHPMCMono<Shape>::setShape)
           .def("computePairEnergy", &IntegratorHPMCMono<Shape>::computePairEnergy)
+          .def("evaluateBoxResize", &IntegratorHPMCMono<Shape>::evaluateBoxResizePy)
           ;
     }
 
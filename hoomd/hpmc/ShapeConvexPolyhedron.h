@@ -237,8 +237,6 @@ struct PolyhedronVertices : ShapeParams
     /// Z coordinate of vertices
     ManagedArray<ShortReal> z;
 
-    /// TODO: store aligned copy of d here for use in the support function.
-
     /** List of triangles hull_verts[3*i], hull_verts[3*i+1], hull_verts[3*i+2] making up the convex
         hull
     */
@@ -298,13 +296,16 @@ class SupportFuncConvexPolyhedron
         if (verts.N > 0)
             {
 #if !defined(__HIPCC__) && defined(__AVX__) && HOOMD_SHORTREAL_SIZE == 32
-            // process dot products with AVX 8 at a time on the CPU when working with more than
-            // 4 verts
+            // process dot products with AVX 8 at a time on the CPU. Each channel tracks its own
+            // maximum and the index where it occurs so that a single pass over the vertices
+            // suffices. Indices are exact in single precision because N <= MAX_VERTS.
             __m256 nx_v = _mm256_broadcast_ss(&n.x);
             __m256 ny_v = _mm256_broadcast_ss(&n.y);
             __m256 nz_v = _mm256_broadcast_ss(&n.z);
             __m256 max_dot_v = _mm256_broadcast_ss(&max_dot);
-            float d_s[PolyhedronVertices::MAX_VERTS] __attribute__((aligned(32)));
+            __m256 idx_v = _mm256_set_ps(7, 6, 5, 4, 3, 2, 1, 0);
+            __m256 max_idx_v = idx_v;
+            const __m256 stride_v = _mm256_set1_ps(8);
 
             for (unsigned int i = 0; i < verts.N; i += 8)
                 {
@@ -316,47 +317,40 @@ class SupportFuncConvexPolyhedron
                     _mm256_mul_ps(nx_v, x_v),
                     _mm256_add_ps(_mm256_mul_ps(ny_v, y_v), _mm256_mul_ps(nz_v, z_v)));
 
-                // determine a maximum in each of the 8 channels as we go
-                max_dot_v = _mm256_max_ps(max_dot_v, d_v);
-
-                _mm256_store_ps(d_s + i, d_v);
+                // keep the first occurrence of the maximum in each channel
+                __m256 greater_v = _mm256_cmp_ps(d_v, max_dot_v, _CMP_GT_OQ);
+                max_dot_v = _mm256_blendv_ps(max_dot_v, d_v, greater_v);
+                max_idx_v = _mm256_blendv_ps(max_idx_v, idx_v, greater_v);
+                idx_v = _mm256_add_ps(idx_v, stride_v);
                 }
 
-            // find the maximum of the 8 channels
-            // https://stackoverflow.com/questions/17638487/minimum-of-4-sp-values-in-m128
-            max_dot_v
-                = _mm256_max_ps(max_dot_v,
-                                _mm256_shuffle_ps(max_dot_v, max_dot_v, _MM_SHUFFLE(2, 1, 0, 3)));
-            max_dot_v
-                = _mm256_max_ps(max_dot_v,
-                                _mm256_shuffle_ps(max_dot_v, max_dot_v, _MM_SHUFFLE(1, 0, 3, 2)));
-            // shuffles work only within the two 128b segments, so right now we have two separate
-            // max values swap the left and right hand sides and max again to get the final max
-            max_dot_v = _mm256_max_ps(max_dot_v, _mm256_permute2f128_ps(max_dot_v, max_dot_v, 1));
-
-            // loop again and find the max. The reason this is in a 2nd loop is because branch
-            // mis-predictions and the extra max calls kill performance if this is in the first loop
-            // Use BSF to find the first index of the max element
-            // https://software.intel.com/en-us/forums/topic/285956
-            for (unsigned int i = 0; i < verts.N; i += 8)
-                {
-                __m256 d_v = _mm256_load_ps(d_s + i);
-
-                int id = __builtin_ffs(_mm256_movemask_ps(_mm256_cmp_ps(max_dot_v, d_v, 0)));
+            // reduce the 8 channels, preferring the lowest index among equal maxima
+            float max_dot_s[8] __attribute__((aligned(32)));
+            float max_idx_s[8] __attribute__((aligned(32)));
+            _mm256_store_ps(max_dot_s, max_dot_v);
+            _mm256_store_ps(max_idx_s, max_idx_v);
 
-                if (id)
+            max_dot = max_dot_s[0];
+            max_idx = (unsigned int)max_idx_s[0];
+            for (unsigned int k = 1; k < 8; ++k)
+                {
+                unsigned int idx_k = (unsigned int)max_idx_s[k];
+                if (max_dot_s[k] > max_dot || (max_dot_s[k] == max_dot && idx_k < max_idx))
                     {
-                    max_idx = i + id - 1;
-                    break;
+                    max_dot = max_dot_s[k];
+                    max_idx = idx_k;
                     }
                 }
 #elif !defined(__HIPCC__) && defined(__SSE__) && HOOMD_SHORTREAL_SIZE == 32
-            // process dot products with SSE 4 at a time on the CPU
+            // process dot products with SSE 4 at a time on the CPU, tracking the per-channel
+            // maximum and its index in a single pass
             __m128 nx_v = _mm_load_ps1(&n.x);
             __m128 ny_v = _mm_load_ps1(&n.y);
             __m128 nz_v = _mm_load_ps1(&n.z);
             __m128 max_dot_v = _mm_load_ps1(&max_dot);
-            float d_s[PolyhedronVertices::MAX_VERTS] __attribute__((aligned(16)));
+            __m128 idx_v = _mm_set_ps(3, 2, 1, 0);
+            __m128 max_idx_v = idx_v;
+            const __m128 stride_v = _mm_set1_ps(4);
 
             for (unsigned int i = 0; i < verts.N; i += 4)
                 {
@@ -367,33 +361,30 @@ class SupportFuncConvexPolyhedron
                 __m128 d_v = _mm_add_ps(_mm_mul_ps(nx_v, x_v),
                                         _mm_add_ps(_mm_mul_ps(ny_v, y_v), _mm_mul_ps(nz_v, z_v)));
 
-                // determine a maximum in each of the 4 channels as we go
-                max_dot_v = _mm_max_ps(max_dot_v, d_v);
-
-                _mm_store_ps(d_s + i, d_v);
+                // keep the first occurrence of the maximum in each channel (SSE has no blend)
+                __m128 greater_v = _mm_cmpgt_ps(d_v, max_dot_v);
+                max_dot_v = _mm_or_ps(_mm_and_ps(greater_v, d_v),
+                                      _mm_andnot_ps(greater_v, max_dot_v));
+                max_idx_v = _mm_or_ps(_mm_and_ps(greater_v, idx_v),
+                                      _mm_andnot_ps(greater_v, max_idx_v));
+                idx_v = _mm_add_ps(idx_v, stride_v);
                 }
 
-            // find the maximum of the 4 channels
-            // https://stackoverflow.com/questions/17638487/minimum-of-4-sp-values-in-m128
-            max_dot_v = _mm_max_ps(max_dot_v,
-                                   _mm_shuffle_ps(max_dot_v, max_dot_v, _MM_SHUFFLE(2, 1, 0, 3)));
-            max_dot_v = _mm_max_ps(max_dot_v,
-                                   _mm_shuffle_ps(max_dot_v, max_dot_v, _MM_SHUFFLE(1, 0, 3, 2)));
-
-            // loop again and find the max. The reason this is in a 2nd loop is because branch
-            // mis-predictions and the extra max calls kill performance if this is in the first loop
-            // Use BSF to find the first index of the max element
-            // https://software.intel.com/en-us/forums/topic/285956
-            for (unsigned int i = 0; i < verts.N; i += 4)
-                {
-                __m128 d_v = _mm_load_ps(d_s + i);
+            // reduce the 4 channels, preferring the lowest index among equal maxima
+            float max_dot_s[4] __attribute__((aligned(16)));
+            float max_idx_s[4] __attribute__((aligned(16)));
+            _mm_store_ps(max_dot_s, max_dot_v);
+            _mm_store_ps(max_idx_s, max_idx_v);
 
-                int id = __builtin_ffs(_mm_movemask_ps(_mm_cmpeq_ps(max_dot_v, d_v)));
-
-                if (id)
+            max_dot = max_dot_s[0];
+            max_idx = (unsigned int)max_idx_s[0];
+            for (unsigned int k = 1; k < 4; ++k)
+                {
+                unsigned int idx_k = (unsigned int)max_idx_s[k];
+                if (max_dot_s[k] > max_dot || (max_dot_s[k] == max_dot && idx_k < max_idx))
                     {
-                    max_idx = i + id - 1;
-                    break;
+                    max_dot = max_dot_s[k];
+                    max_idx = idx_k;
                     }
                 }
 #else
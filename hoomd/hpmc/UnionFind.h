@@ -0,0 +1,132 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef _HPMC_UNION_FIND_H_
+#define _HPMC_UNION_FIND_H_
+
+/*! \file UnionFind.h
+    \brief Declaration of UnionFind
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace hoomd
+    {
+namespace hpmc
+    {
+namespace detail
+    {
+//! Disjoint set forest with lock-free concurrent union
+/*! UnionFind partitions the vertices 0..N-1 of an undirected graph into connected components.
+    unite() may be called concurrently from any number of threads. A root is always linked below
+    the root with the smaller index, so parent indices only ever decrease and the representative of
+    every set is its smallest vertex. find() shortens paths by halving with a compare-and-swap; a
+    failed exchange only means that another thread has already shortened the path.
+*/
+class UnionFind
+    {
+    public:
+    //! Default constructor
+    UnionFind() { }
+
+    //! Reset to N singleton sets
+    void reset(unsigned int N)
+        {
+        if (N > m_capacity)
+            {
+            m_parent.reset(new std::atomic<unsigned int>[N]);
+            m_capacity = N;
+            }
+        m_N = N;
+
+        for (unsigned int v = 0; v < N; ++v)
+            m_parent[v].store(v, std::memory_order_relaxed);
+        }
+
+    //! Get the number of vertices
+    unsigned int size() const
+        {
+        return m_N;
+        }
+
+    //! Find the representative (smallest vertex) of the set containing v
+    unsigned int find(unsigned int v)
+        {
+        while (true)
+            {
+            unsigned int parent = m_parent[v].load();
+            if (parent == v)
+                return v;
+
+            unsigned int grandparent = m_parent[parent].load();
+            if (grandparent != parent)
+                m_parent[v].compare_exchange_weak(parent, grandparent);
+
+            v = grandparent;
+            }
+        }
+
+    //! Merge the sets containing v and w
+    void unite(unsigned int v, unsigned int w)
+        {
+        while (true)
+            {
+            v = find(v);
+            w = find(w);
+            if (v == w)
+                return;
+
+            // link the larger root below the smaller one
+            if (v < w)
+                std::swap(v, w);
+
+            unsigned int expected = v;
+            if (m_parent[v].compare_exchange_strong(expected, w))
+                return;
+            }
+        }
+
+    //! Gather the connected components
+    /*! \param cc Output list of components
+
+        Components are ordered by their smallest vertex, and each component lists its vertices in
+        ascending order. Call only after all concurrent unite() calls have completed.
+    */
+    void connectedComponents(std::vector<std::vector<unsigned int>>& cc)
+        {
+        cc.clear();
+        m_component.resize(m_N);
+
+        for (unsigned int v = 0; v < m_N; ++v)
+            {
+            unsigned int root = find(v);
+            if (root == v)
+                {
+                m_component[v] = (unsigned int)cc.size();
+                cc.emplace_back();
+                }
+
+            // the root is never larger than v, so its component has been assigned already
+            cc[m_component[root]].push_back(v);
+            }
+        }
+
+    private:
+    std::unique_ptr<std::atomic<unsigned int>[]> m_parent; //!< Parent of each vertex
+    unsigned int m_capacity = 0;                           //!< Allocated number of vertices
+    unsigned int m_N = 0;                                  //!< Number of vertices
+    std::vector<unsigned int> m_component;                 //!< Component index of each root
+    };
+
+    } // end namespace detail
+    } // end namespace hpmc
+    } // end namespace hoomd
+
+#endif // _HPMC_UNION_FIND_H_
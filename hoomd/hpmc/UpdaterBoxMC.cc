@@ -229,6 +229,37 @@ inline bool UpdaterBoxMC::box_resize_trial(Scalar Lx,
                                            double delta_beta_H,
                                            hoomd::RandomGenerator& rng)
     {
+    BoxDim curBox = m_pdata->getGlobalBox();
+    double delta_U_pair = 0;
+    double delta_U_external = 0;
+
+    BoxDim newBox = m_pdata->getGlobalBox();
+    newBox.setL(make_scalar3(Lx, Ly, Lz));
+    newBox.setTiltFactors(xy, xz, yz);
+
+    // Check for overlaps and compute the pair energy change without moving the particles when
+    // the integrator supports it. Rejected trials then leave the particle data untouched.
+    bool allowed = false;
+    const bool evaluated = m_mc->evaluateBoxResize(timestep, newBox, allowed, delta_U_pair);
+    if (evaluated)
+        {
+        if (!allowed)
+            {
+            return false;
+            }
+
+        if (m_mc->getExternalPotentials().empty() && !m_mc->getExternalField())
+            {
+            double p = hoomd::detail::generate_canonical<double>(rng);
+            if (p < exp(-delta_beta_H) * exp(-delta_U_pair))
+                {
+                m_mc->scaleParticlesToBox(newBox);
+                return true;
+                }
+            return false;
+            }
+        }
+
     // Make a backup copy of position data
     unsigned int N_backup = m_pdata->getN();
         {
@@ -241,28 +272,32 @@ inline bool UpdaterBoxMC::box_resize_trial(Scalar Lx,
         memcpy(h_pos_backup.data, h_pos.data, sizeof(Scalar4) * N_backup);
         }
 
-    BoxDim curBox = m_pdata->getGlobalBox();
-    double delta_U_pair = 0;
-    double delta_U_external = 0;
-
     // energy of old configuration
-    delta_U_pair -= m_mc->computeTotalPairEnergy(timestep);
+    if (!evaluated)
+        {
+        delta_U_pair -= m_mc->computeTotalPairEnergy(timestep);
+        }
     delta_U_external -= m_mc->computeTotalExternalEnergy(false);
 
     // Attempt box resize and check for overlaps
-    BoxDim newBox = m_pdata->getGlobalBox();
-
-    newBox.setL(make_scalar3(Lx, Ly, Lz));
-    newBox.setTiltFactors(xy, xz, yz);
-
     Scalar3 old_origin = m_pdata->getOrigin();
-    bool allowed = m_mc->attemptBoxResize(timestep, newBox);
+    if (evaluated)
+        {
+        m_mc->scaleParticlesToBox(newBox);
+        }
+    else
+        {
+        allowed = m_mc->attemptBoxResize(timestep, newBox);
+        }
     Scalar3 new_origin = m_pdata->getOrigin();
     Scalar3 origin_shift = new_origin - old_origin;
 
     if (allowed)
         {
-        delta_U_pair += m_mc->computeTotalPairEnergy(timestep);
+        if (!evaluated)
+            {
+            delta_U_pair += m_mc->computeTotalPairEnergy(timestep);
+            }
         delta_U_external += m_mc->computeTotalExternalEnergy(true);
         }
 
@@ -18,6 +18,11 @@
 #include <pybind11/stl.h>
 #endif
 
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 namespace hoomd
     {
 namespace hpmc
@@ -147,6 +152,22 @@ template<class Shape> class UpdaterMuVT : public Updater
         return m_n_trial;
         }
 
+    //! Set the number of insertion or removal trials performed per update
+    void setBatchSize(unsigned int batch_size)
+        {
+        if (batch_size == 0)
+            {
+            throw std::domain_error("batch_size must be positive.");
+            }
+        m_batch_size = batch_size;
+        }
+
+    //! Get the number of insertion or removal trials performed per update
+    unsigned int getBatchSize()
+        {
+        return m_batch_size;
+        }
+
     //! Get the current counter values
     hpmc_muvt_counters_t getCounters(unsigned int mode = 0);
 
@@ -180,6 +201,57 @@ template<class Shape> class UpdaterMuVT : public Updater
 
     unsigned int m_n_trial;
 
+    unsigned int m_batch_size = 1; //!< Number of insertion or removal trials per update
+
+    //! A candidate particle for a batched insertion
+    struct InsertionCandidate
+        {
+        unsigned int type;        //!< Particle type
+        vec3<Scalar> pos;         //!< Position
+        quat<Scalar> orientation; //!< Orientation
+        Scalar lnboltzmann;       //!< Log of the Boltzmann weight against the current configuration
+        bool nonzero;             //!< False when the candidate overlaps with the configuration
+        };
+
+    std::vector<InsertionCandidate> m_candidates; //!< Candidates of the current insertion batch
+
+    //! Perform consecutive grand canonical insertion trials and add the accepted particles at once
+    /*! \param timestep Current time step
+     * \param rng Random number generator for the insertion trials
+     * \param n_trials Number of insertion trials
+     */
+    void insertBatch(uint64_t timestep, hoomd::RandomGenerator& rng, unsigned int n_trials);
+
+    //! Perform consecutive grand canonical removal trials
+    /*! \param timestep Current time step
+     * \param rng Random number generator for the removal trials
+     * \param n_trials Number of removal trials
+     */
+    void removeBatch(uint64_t timestep, hoomd::RandomGenerator& rng, unsigned int n_trials);
+
+    /*! Check a candidate insertion against the current configuration without side effects
+     * \param candidate The candidate (lnboltzmann and nonzero are set on return)
+     * \param aabb_tree AABB tree of the current configuration (may be null if nptl_local == 0)
+     * \param image_list List of periodic images
+     * \param h_postype Particle positions and types
+     * \param h_orientation Particle orientations
+     * \param h_diameter Particle diameters
+     * \param h_charge Particle charges
+     * \param h_overlaps Interaction matrix
+     * \param nptl_local Number of particles in the AABB tree
+     *
+     * This method is safe to call concurrently from multiple threads.
+     */
+    void evaluateInsertionCandidate(InsertionCandidate& candidate,
+                                    const hoomd::detail::AABBTree* aabb_tree,
+                                    const std::vector<vec3<Scalar>>& image_list,
+                                    const Scalar4* h_postype,
+                                    const Scalar4* h_orientation,
+                                    const Scalar* h_diameter,
+                                    const Scalar* h_charge,
+                                    const unsigned int* h_overlaps,
+                                    unsigned int nptl_local);
+
     /*! Check for overlaps of a fictitious particle
      * \param timestep Current time step
      * \param type Type of particle to test
@@ -351,6 +423,12 @@ UpdaterMuVT<Shape>::UpdaterMuVT(std::shared_ptr<SystemDefinition> sysdef,
     m_move_type_seed = m_sysdef->getSeed();
 
 #ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition()
+        && m_pdata->getDomainDecomposition()->isRecursiveBisection())
+        {
+        throw std::runtime_error("UpdaterMuVT does not support recursive bisection domains.");
+        }
+
     if (m_gibbs)
         {
         if (m_exec_conf->getNPartitions() % npartition)
@@ -1032,7 +1110,53 @@ template<class Shape> void UpdaterMuVT<Shape>::update(uint64_t timestep)
                         this->m_sysdef->getSeed()),
             hoomd::Counter(group, partition));
 
-        if (insert)
+        if (m_batch_size > 1)
+            {
+            if (m_gibbs || m_sysdef->isDomainDecomposed())
+                {
+                throw std::runtime_error("batch_size > 1 is only supported in grand canonical "
+                                         "simulations on a single rank.");
+                }
+
+            for (unsigned int type_d = 0; type_d < m_pdata->getNTypes(); ++type_d)
+                {
+                if (m_mc->getDepletantFugacity(type_d) != 0.0)
+                    {
+                    throw std::runtime_error("batch_size > 1 is not supported with depletants.");
+                    }
+                }
+
+            // Choose insertion or removal separately for every trial, so that the batch is
+            // m_batch_size consecutive single particle trials. Each run of consecutive insertion
+            // trials is evaluated together.
+            bool insert_trial = insert;
+            unsigned int n_done = 0;
+            while (n_done < m_batch_size)
+                {
+                unsigned int n_trials = 1;
+                bool next_insert = insert_trial;
+                while (n_done + n_trials < m_batch_size)
+                    {
+                    next_insert = hoomd::UniformIntDistribution(1)(rng_insert_remove);
+                    if (next_insert != insert_trial)
+                        break;
+                    n_trials++;
+                    }
+
+                if (insert_trial)
+                    {
+                    insertBatch(timestep, rng_insert_remove, n_trials);
+                    }
+                else
+                    {
+                    removeBatch(timestep, rng_insert_remove, n_trials);
+                    }
+
+                n_done += n_trials;
+                insert_trial = next_insert;
+                }
+            }
+        else if (insert)
             {
             // Try inserting a particle
             unsigned int type = 0;
@@ -3152,6 +3276,459 @@ unsigned int UpdaterMuVT<Shape>::countDepletantOverlaps(uint64_t timestep,
     return n_overlap;
     }
 
+template<class Shape>
+void UpdaterMuVT<Shape>::evaluateInsertionCandidate(InsertionCandidate& candidate,
+                                                    const hoomd::detail::AABBTree* aabb_tree,
+                                                    const std::vector<vec3<Scalar>>& image_list,
+                                                    const Scalar4* h_postype,
+                                                    const Scalar4* h_orientation,
+                                                    const Scalar* h_diameter,
+                                                    const Scalar* h_charge,
+                                                    const unsigned int* h_overlaps,
+                                                    unsigned int nptl_local)
+    {
+    const unsigned int n_images = (unsigned int)image_list.size();
+    auto& params = m_mc->getParams();
+    const Index2D& overlap_idx = m_mc->getOverlapIndexer();
+
+    const unsigned int type = candidate.type;
+    const vec3<Scalar> pos = candidate.pos;
+    const quat<Scalar> orientation = candidate.orientation;
+
+    candidate.lnboltzmann = Scalar(0.0);
+    candidate.nonzero = true;
+
+    LongReal r_cut_patch(0.0);
+    if (m_mc->hasPairInteractions())
+        {
+        r_cut_patch = m_mc->getMaxPairEnergyRCutNonAdditive()
+                      + LongReal(0.5) * m_mc->getMaxPairInteractionAdditiveRCut(type);
+        }
+
+    unsigned int err_count = 0;
+    Shape shape(orientation, params[type]);
+
+    // check for self-overlap with all images except the original
+    for (unsigned int cur_image = 1; cur_image < n_images; cur_image++)
+        {
+        vec3<Scalar> r_ij = pos - (pos + image_list[cur_image]);
+        if (h_overlaps[overlap_idx(type, type)] && check_circumsphere_overlap(r_ij, shape, shape)
+            && test_overlap(r_ij, shape, shape, err_count))
+            {
+            candidate.nonzero = false;
+            return;
+            }
+
+        // self-energy
+        candidate.lnboltzmann -= m_mc->computeOnePairEnergy(dot(r_ij, r_ij),
+                                                            r_ij,
+                                                            type,
+                                                            orientation,
+                                                            1.0, // diameter i
+                                                            0.0, // charge i
+                                                            type,
+                                                            orientation,
+                                                            1.0, // diameter i
+                                                            0.0  // charge i
+        );
+        }
+
+    // we cannot rely on a valid AABB tree when there are 0 particles
+    if (nptl_local == 0)
+        {
+        return;
+        }
+
+    LongReal R_query = std::max(shape.getCircumsphereDiameter() / LongReal(2.0),
+                                r_cut_patch - m_mc->getMinCoreDiameter() / LongReal(2.0));
+    hoomd::detail::AABB aabb_local = hoomd::detail::AABB(vec3<Scalar>(0, 0, 0), R_query);
+
+    for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
+        {
+        vec3<Scalar> pos_image = pos + image_list[cur_image];
+
+        hoomd::detail::AABB aabb = aabb_local;
+        aabb.translate(pos_image);
+
+        // stackless search
+        for (unsigned int cur_node_idx = 0; cur_node_idx < aabb_tree->getNumNodes(); cur_node_idx++)
+            {
+            if (aabb.overlaps(aabb_tree->getNodeAABB(cur_node_idx)))
+                {
+                if (aabb_tree->isNodeLeaf(cur_node_idx))
+                    {
+                    for (unsigned int cur_p = 0; cur_p < aabb_tree->getNodeNumParticles(cur_node_idx);
+                         cur_p++)
+                        {
+                        // read in its position and orientation
+                        unsigned int j = aabb_tree->getNodeParticle(cur_node_idx, cur_p);
+
+                        Scalar4 postype_j = h_postype[j];
+                        quat<LongReal> orientation_j(h_orientation[j]);
+
+                        // put particles in coordinate system of particle i
+                        vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_image;
+
+                        unsigned int typ_j = __scalar_as_int(postype_j.w);
+                        Shape shape_j(orientation_j, params[typ_j]);
+
+                        if (h_overlaps[overlap_idx(type, typ_j)]
+                            && check_circumsphere_overlap(r_ij, shape, shape_j)
+                            && test_overlap(r_ij, shape, shape_j, err_count))
+                            {
+                            candidate.nonzero = false;
+                            return;
+                            }
+
+                        candidate.lnboltzmann -= m_mc->computeOnePairEnergy(dot(r_ij, r_ij),
+                                                                            r_ij,
+                                                                            type,
+                                                                            orientation,
+                                                                            1.0, // diameter i
+                                                                            0.0, // charge i
+                                                                            typ_j,
+                                                                            orientation_j,
+                                                                            h_diameter[j],
+                                                                            h_charge[j]);
+                        }
+                    }
+                }
+            else
+                {
+                // skip ahead
+                cur_node_idx += aabb_tree->getNodeSkip(cur_node_idx);
+                }
+            } // end loop over AABB nodes
+        } // end loop over images
+    }
+
+template<class Shape>
+void UpdaterMuVT<Shape>::insertBatch(uint64_t timestep,
+                                     hoomd::RandomGenerator& rng,
+                                     unsigned int n_trials)
+    {
+    const unsigned int ndim = m_sysdef->getNDimensions();
+    const BoxDim box = m_pdata->getGlobalBox();
+    const Scalar V = box.getVolume();
+    auto& params = m_mc->getParams();
+
+    assert(m_transfer_types.size() > 0);
+
+    // draw all candidates before evaluating any of them
+    m_candidates.resize(n_trials);
+    for (auto& candidate : m_candidates)
+        {
+        // choose a random particle type out of those being inserted or removed
+        candidate.type = m_transfer_types[hoomd::UniformIntDistribution(
+            (unsigned int)(m_transfer_types.size() - 1))(rng)];
+
+        // Propose a random position uniformly in the box
+        Scalar3 f;
+        f.x = hoomd::detail::generate_canonical<Scalar>(rng);
+        f.y = hoomd::detail::generate_canonical<Scalar>(rng);
+        if (ndim == 2)
+            {
+            f.z = Scalar(0.5);
+            }
+        else
+            {
+            f.z = hoomd::detail::generate_canonical<Scalar>(rng);
+            }
+        candidate.pos = vec3<Scalar>(box.makeCoordinates(f));
+
+        Shape shape_test(quat<Scalar>(), params[candidate.type]);
+        if (shape_test.hasOrientation())
+            {
+            shape_test.orientation = generateRandomOrientation(rng, ndim);
+            }
+        candidate.orientation = shape_test.orientation;
+        }
+
+    // build the AABB tree and image list once, all candidates share them read-only
+    const unsigned int nptl_local = m_pdata->getN() + m_pdata->getNGhosts();
+    const std::vector<vec3<Scalar>>& image_list = m_mc->updateImageList();
+    const hoomd::detail::AABBTree* aabb_tree = nullptr;
+    if (nptl_local > 0)
+        {
+        aabb_tree = &m_mc->buildAABBTree();
+        }
+
+    ArrayHandle<unsigned int> h_overlaps(m_mc->getInteractionMatrix(),
+                                         access_location::host,
+                                         access_mode::read);
+
+        {
+        // test all candidates against the current configuration
+        ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
+                                       access_location::host,
+                                       access_mode::read);
+        ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                           access_location::host,
+                                           access_mode::read);
+        ArrayHandle<Scalar> h_diameter(m_pdata->getDiameters(),
+                                       access_location::host,
+                                       access_mode::read);
+        ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
+
+#ifdef ENABLE_TBB
+        m_exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                tbb::parallel_for(tbb::blocked_range<size_t>(0, m_candidates.size()),
+                                  [&](const tbb::blocked_range<size_t>& r)
+                                  {
+                                      for (size_t k = r.begin(); k != r.end(); ++k)
+                                          {
+                                          evaluateInsertionCandidate(m_candidates[k],
+                                                                     aabb_tree,
+                                                                     image_list,
+                                                                     h_postype.data,
+                                                                     h_orientation.data,
+                                                                     h_diameter.data,
+                                                                     h_charge.data,
+                                                                     h_overlaps.data,
+                                                                     nptl_local);
+                                          }
+                                  });
+            });
+#else
+        for (auto& candidate : m_candidates)
+            {
+            evaluateInsertionCandidate(candidate,
+                                       aabb_tree,
+                                       image_list,
+                                       h_postype.data,
+                                       h_orientation.data,
+                                       h_diameter.data,
+                                       h_charge.data,
+                                       h_overlaps.data,
+                                       nptl_local);
+            }
+#endif
+        }
+
+    // external potentials are evaluated serially
+    auto field = m_mc->getExternalField();
+    if (field || !m_mc->getExternalPotentials().empty())
+        {
+        for (auto& candidate : m_candidates)
+            {
+            if (!candidate.nonzero)
+                continue;
+
+            candidate.lnboltzmann += m_mc->computeOneExternalEnergy(candidate.type,
+                                                                    candidate.pos,
+                                                                    candidate.orientation,
+                                                                    0.0,
+                                                                    true);
+            if (field)
+                {
+                candidate.lnboltzmann -= field->energy(box,
+                                                       candidate.type,
+                                                       candidate.pos,
+                                                       quat<float>(candidate.orientation),
+                                                       1.0, // diameter i
+                                                       0.0  // charge i
+                );
+                }
+            candidate.lnboltzmann += m_mc->computeOneExternalEnergy(candidate.type,
+                                                                    candidate.pos,
+                                                                    candidate.orientation,
+                                                                    0.0,
+                                                                    true);
+            }
+        }
+
+    // Apply the acceptance criterion to the candidates in order. Each trial sees the particles
+    // accepted earlier in the batch, so the batch is equivalent to n_trials consecutive trials.
+    std::vector<unsigned int> nptl_type(m_pdata->getNTypes());
+    for (unsigned int type = 0; type < m_pdata->getNTypes(); ++type)
+        {
+        nptl_type[type] = getNumParticlesType(type);
+        }
+
+    const Index2D& overlap_idx = m_mc->getOverlapIndexer();
+    const unsigned int n_images = (unsigned int)image_list.size();
+    std::vector<unsigned int> accepted;
+
+    for (unsigned int k = 0; k < m_candidates.size(); ++k)
+        {
+        const InsertionCandidate& candidate = m_candidates[k];
+
+        // get fugacity value
+        Scalar fugacity = (*m_fugacity[candidate.type])(timestep);
+
+        // sanity check
+        if (fugacity <= Scalar(0.0))
+            {
+            m_exec_conf->msg->error() << "Fugacity has to be greater than zero." << std::endl;
+            throw std::runtime_error("Error in UpdaterMuVT");
+            }
+
+        // acceptance probability
+        Scalar lnboltzmann = log(fugacity * V / (Scalar)(nptl_type[candidate.type] + 1));
+        bool nonzero = candidate.nonzero;
+        if (nonzero)
+            {
+            lnboltzmann += candidate.lnboltzmann;
+            }
+
+        // interactions with the candidates accepted earlier in this batch
+        Shape shape_k(candidate.orientation, params[candidate.type]);
+        for (unsigned int a = 0; a < accepted.size() && nonzero; ++a)
+            {
+            const InsertionCandidate& other = m_candidates[accepted[a]];
+            Shape shape_a(other.orientation, params[other.type]);
+
+            for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
+                {
+                vec3<Scalar> r_ij = other.pos - (candidate.pos + image_list[cur_image]);
+
+                unsigned int err_count = 0;
+                if (h_overlaps.data[overlap_idx(candidate.type, other.type)]
+                    && check_circumsphere_overlap(r_ij, shape_k, shape_a)
+                    && test_overlap(r_ij, shape_k, shape_a, err_count))
+                    {
+                    nonzero = false;
+                    break;
+                    }
+
+                lnboltzmann -= m_mc->computeOnePairEnergy(dot(r_ij, r_ij),
+                                                          r_ij,
+                                                          candidate.type,
+                                                          candidate.orientation,
+                                                          1.0, // diameter i
+                                                          0.0, // charge i
+                                                          other.type,
+                                                          other.orientation,
+                                                          1.0, // diameter j
+                                                          0.0  // charge j
+                );
+                }
+            }
+
+        bool accept = false;
+        if (nonzero)
+            {
+            accept = (hoomd::detail::generate_canonical<double>(rng) < exp(lnboltzmann));
+            }
+
+        if (accept)
+            {
+            accepted.push_back(k);
+            nptl_type[candidate.type]++;
+            m_count_total.insert_accept_count++;
+            }
+        else
+            {
+            m_count_total.insert_reject_count++;
+            }
+        }
+
+    if (accepted.empty())
+        {
+        return;
+        }
+
+    // add all accepted particles together
+    std::vector<unsigned int> types;
+    types.reserve(accepted.size());
+    for (auto k : accepted)
+        {
+        types.push_back(m_candidates[k].type);
+        }
+
+    std::vector<unsigned int> tags = m_pdata->addNewParticles(types);
+
+    for (unsigned int a = 0; a < accepted.size(); ++a)
+        {
+        const InsertionCandidate& candidate = m_candidates[accepted[a]];
+
+        // setPosition() takes into account the grid shift, so subtract that one
+        Scalar3 p = vec_to_scalar3(candidate.pos) - m_pdata->getOrigin();
+        int3 tmp = make_int3(0, 0, 0);
+        m_pdata->getGlobalBox().wrap(p, tmp);
+        m_pdata->setPosition(tags[a], p);
+
+        Shape shape(candidate.orientation, params[candidate.type]);
+        if (shape.hasOrientation())
+            {
+            m_pdata->setOrientation(tags[a], quat_to_scalar4(candidate.orientation));
+            }
+        }
+    }
+
+template<class Shape>
+void UpdaterMuVT<Shape>::removeBatch(uint64_t timestep,
+                                     hoomd::RandomGenerator& rng,
+                                     unsigned int n_trials)
+    {
+    assert(m_transfer_types.size() > 0);
+
+    for (unsigned int k = 0; k < n_trials; ++k)
+        {
+        // choose a random particle type out of those being transferred
+        unsigned int type = m_transfer_types[hoomd::UniformIntDistribution(
+            (unsigned int)(m_transfer_types.size() - 1))(rng)];
+
+        // choose a random particle of that type
+        unsigned int nptl_type = getNumParticlesType(type);
+
+        unsigned int tag = UINT_MAX;
+        if (nptl_type)
+            {
+            unsigned int type_offset = hoomd::UniformIntDistribution(nptl_type - 1)(rng);
+            tag = getNthTypeTag(type, type_offset);
+            }
+
+        // get fugacity value
+        Scalar fugacity = (*m_fugacity[type])(timestep);
+
+        // sanity check
+        if (fugacity <= Scalar(0.0))
+            {
+            m_exec_conf->msg->error() << "Fugacity has to be greater than zero." << std::endl;
+            throw std::runtime_error("Error in UpdaterMuVT");
+            }
+
+        Scalar V = m_pdata->getGlobalBox().getVolume();
+        Scalar lnboltzmann = -log(fugacity);
+
+        bool nonzero = nptl_type > 0;
+        if (nonzero)
+            {
+            lnboltzmann += log((Scalar)nptl_type / V);
+            }
+
+        // get weight for removal
+        Scalar lnb(0.0);
+        if (tryRemoveParticle(timestep, tag, lnb))
+            {
+            lnboltzmann += lnb;
+            }
+        else
+            {
+            nonzero = false;
+            }
+
+        bool accept = false;
+        if (nonzero)
+            {
+            accept = (hoomd::detail::generate_canonical<double>(rng) < exp(lnboltzmann));
+            }
+
+        if (accept)
+            {
+            m_pdata->removeParticle(tag);
+            m_count_total.remove_accept_count++;
+            }
+        else
+            {
+            m_count_total.remove_reject_count++;
+            }
+        }
+    }
+
 namespace detail
     {
 //! Export the UpdaterMuVT class to python
@@ -3178,6 +3755,9 @@ template<class Shape> void export_UpdaterMuVT(pybind11::module& m, const std::st
                       &UpdaterMuVT<Shape>::getTransferTypes,
                       &UpdaterMuVT<Shape>::setTransferTypes)
         .def_property("ntrial", &UpdaterMuVT<Shape>::getNTrial, &UpdaterMuVT<Shape>::setNTrial)
+        .def_property("batch_size",
+                      &UpdaterMuVT<Shape>::getBatchSize,
+                      &UpdaterMuVT<Shape>::setBatchSize)
         .def_property_readonly("N", &UpdaterMuVT<Shape>::getN)
         .def("getCounters", &UpdaterMuVT<Shape>::getCounters);
     }
@@ -0,0 +1,147 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file bench_hpmc.cc
+    \brief Benchmarks HPMC sweeps and narrow phase overlap checks
+*/
+
+#include "hoomd/hpmc/IntegratorHPMCMono.h"
+#include "hoomd/hpmc/Moves.h"
+#include "hoomd/hpmc/ShapeConvexPolyhedron.h"
+#include "hoomd/hpmc/ShapeSphere.h"
+
+#include "hoomd/benchmarks/benchmark_harness.h"
+
+using namespace hoomd;
+using namespace hoomd::hpmc;
+using namespace hoomd::hpmc::detail;
+
+//! Vertices of a unit cube
+static PolyhedronVertices cube_vertices()
+    {
+    std::vector<vec3<ShortReal>> vertices;
+    for (int i = 0; i < 8; i++)
+        {
+        vertices.push_back(vec3<ShortReal>(i & 1 ? 0.5f : -0.5f,
+                                           i & 2 ? 0.5f : -0.5f,
+                                           i & 4 ? 0.5f : -0.5f));
+        }
+    return PolyhedronVertices(vertices, 0, 0);
+    }
+
+//! Sphere of unit diameter
+static SphereParams sphere_params()
+    {
+    SphereParams params;
+    params.radius = 0.5f;
+    params.ignore = false;
+    params.isOriented = false;
+    return params;
+    }
+
+//! Full trial move sweeps on a packing of hard shapes
+/*! \param harness Benchmark harness
+    \param name Name of the case
+    \param param Shape parameters
+    \param volume Volume of one shape
+    \param orientable Set to true to include rotation moves
+*/
+template<class Shape>
+void bench_sweep(benchmark::Harness& harness,
+                 const std::string& name,
+                 const typename Shape::param_type& param,
+                 Scalar volume,
+                 bool orientable)
+    {
+    if (!harness.selected(name))
+        return;
+
+    std::vector<unsigned int> sizes = {4096, 32768, 262144};
+    if (harness.quick())
+        sizes.resize(1);
+
+    for (unsigned int N : sizes)
+        {
+        for (Scalar packing_fraction : {Scalar(0.3), Scalar(0.5)})
+            {
+            // start from an overlap free lattice, the warm up sweeps melt it
+            auto snap = benchmark::makeFluidSnapshot(N, packing_fraction / volume, 1, 0);
+            auto sysdef = std::make_shared<SystemDefinition>(snap, harness.getExecConf());
+
+            auto mc = std::make_shared<IntegratorHPMCMono<Shape>>(sysdef);
+            mc->setParam(0, param);
+            mc->setD("A", Scalar(0.1));
+            mc->setA("A", orientable ? Scalar(0.1) : Scalar(0.0));
+            if (!orientable)
+                mc->setTranslationMoveProbability(Scalar(1.0));
+            mc->prepRun(0);
+
+            harness.run(name,
+                        {{"N", N}, {"packing_fraction", packing_fraction}},
+                        N,
+                        [&](uint64_t timestep) { mc->update(timestep); },
+                        20);
+            }
+        }
+    }
+
+//! Narrow phase overlap checks between pairs of shapes near contact
+/*! \param harness Benchmark harness
+    \param name Name of the case
+    \param param Shape parameters
+    \param contact_distance Typical center to center distance at contact
+
+    Each step tests a fixed batch of random pairs with random orientations at distances between
+    0.8 and 1.2 times the contact distance, where the overlap check does the most work.
+*/
+template<class Shape>
+void bench_overlap(benchmark::Harness& harness,
+                   const std::string& name,
+                   const typename Shape::param_type& param,
+                   Scalar contact_distance)
+    {
+    const unsigned int n_pairs = 1024;
+
+    std::vector<vec3<Scalar>> r_ab(n_pairs);
+    std::vector<quat<Scalar>> q_a(n_pairs), q_b(n_pairs);
+    RandomGenerator rng(Seed(RNGIdentifier::Benchmark, 1, 1), Counter());
+    UniformDistribution<Scalar> distance(Scalar(0.8) * contact_distance,
+                                         Scalar(1.2) * contact_distance);
+    for (unsigned int i = 0; i < n_pairs; i++)
+        {
+        r_ab[i] = rotate(generateRandomOrientation(rng, 3), vec3<Scalar>(distance(rng), 0, 0));
+        q_a[i] = generateRandomOrientation(rng, 3);
+        q_b[i] = generateRandomOrientation(rng, 3);
+        }
+
+    unsigned int n_overlaps = 0;
+    harness.run(name,
+                {{"pairs", n_pairs}},
+                n_pairs,
+                [&](uint64_t timestep)
+                {
+                    unsigned int err = 0;
+                    for (unsigned int i = 0; i < n_pairs; i++)
+                        {
+                        Shape a(q_a[i], param);
+                        Shape b(q_b[i], param);
+                        n_overlaps += test_overlap(r_ab[i], a, b, err);
+                        }
+                });
+
+    // use the result so that the compiler does not remove the overlap checks
+    if (n_overlaps == 0)
+        std::cout << name << ": no overlaps" << std::endl;
+    }
+
+//! Run all benchmarks in this file
+void bench_hpmc(benchmark::Harness& harness)
+    {
+    bench_sweep<ShapeSphere>(harness, "sweep_sphere", sphere_params(), M_PI / 6.0, false);
+    bench_sweep<ShapeConvexPolyhedron>(harness, "sweep_cube", cube_vertices(), 1.0, true);
+
+    bench_overlap<ShapeSphere>(harness, "overlap_sphere", sphere_params(), 1.0);
+    bench_overlap<ShapeConvexPolyhedron>(harness, "overlap_cube", cube_vertices(), 1.2);
+    }
+
+HOOMD_BENCHMARK_MAIN("bench_hpmc", bench_hpmc)
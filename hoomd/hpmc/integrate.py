@@ -371,6 +371,7 @@ class HPMCIntegrator(Integrator):
     _remove_for_pickling = Integrator._remove_for_pickling + ('_cpp_cell',)
     _skip_for_equality = Integrator._skip_for_equality | {'_cpp_cell'}
     _cpp_cls = None
+    _checkpoint_typeparams = ('d', 'a')
 
     def __init__(self, default_d, default_a, translation_move_probability,
                  nselect):
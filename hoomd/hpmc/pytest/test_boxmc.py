@@ -290,6 +290,108 @@ def test_counters(box_move, simulation_factory, lattice_snapshot_factory,
             assert ctr[0] + ctr[1] == 10
 
 
+def _scale_snapshot(snapshot, box):
+    """Map the particles into box, keeping their fractional coordinates."""
+    old_matrix = hoomd.Box.from_box(snapshot.configuration.box).to_matrix()
+    fractions = np.linalg.solve(old_matrix, snapshot.particles.position.T)
+    snapshot.particles.position[:] = (box.to_matrix() @ fractions).T
+    snapshot.configuration.box = box
+
+
+def _trial_box(box, Lx=1, Ly=1, Lz=1, xy=0, xz=0, yz=0):
+    return hoomd.Box(Lx=box.Lx * Lx,
+                     Ly=box.Ly * Ly,
+                     Lz=box.Lz * Lz,
+                     xy=box.xy + xy,
+                     xz=box.xz + xz,
+                     yz=box.yz + yz)
+
+
+box_trials = [
+    dict(Lx=1.02, Ly=1.02, Lz=1.02),
+    dict(Lx=0.97, Ly=0.97, Lz=0.97),
+    dict(Lx=1.05, Ly=0.96),
+    dict(xy=0.05, yz=-0.03),
+    dict(Lx=0.9, Ly=0.9, Lz=0.9),
+    dict(Lz=0.86),
+]
+
+
+@pytest.mark.serial
+@pytest.mark.parametrize("pair_potential", [False, True])
+def test_box_trial_matches_full_path(pair_potential, simulation_factory,
+                                     lattice_snapshot_factory):
+    """Test that box trials on the cached pair list match the full path."""
+    sim = simulation_factory(lattice_snapshot_factory(n=6, a=1.2))
+    mc = hoomd.hpmc.integrate.Sphere(default_d=0.1)
+    mc.shape['A'] = dict(diameter=1)
+    if pair_potential:
+        lennard_jones = hoomd.hpmc.pair.LennardJones()
+        lennard_jones.params[('A', 'A')] = dict(epsilon=0.5,
+                                                sigma=1.0,
+                                                r_cut=2.0)
+        mc.pair_potentials = [lennard_jones]
+    sim.operations.integrator = mc
+
+    # evaluate the trials after the particles have moved by different
+    # amounts since the pair list was built
+    for steps in (10, 2, 20):
+        sim.run(steps)
+        snapshot = sim.state.get_snapshot()
+        box = sim.state.box
+        energy = mc.pair_energy
+
+        results = [
+            mc._cpp_obj.evaluateBoxResize(sim.timestep,
+                                          _trial_box(box, **trial)._cpp_obj)
+            for trial in box_trials
+        ]
+
+        for trial, (evaluated, allowed, delta_U_pair) in zip(box_trials,
+                                                              results):
+            assert evaluated
+
+            trial_snapshot = sim.state.get_snapshot()
+            _scale_snapshot(trial_snapshot, _trial_box(box, **trial))
+            sim.state.set_snapshot(trial_snapshot)
+            assert allowed == (mc.overlaps == 0)
+            if allowed:
+                assert delta_U_pair == pytest.approx(mc.pair_energy - energy,
+                                                     rel=1e-5,
+                                                     abs=1e-5)
+            sim.state.set_snapshot(snapshot)
+
+
+@pytest.mark.serial
+def test_box_trial_fallback(simulation_factory, lattice_snapshot_factory):
+    """Test that trials beyond the image list range use the full path."""
+    sim = simulation_factory(lattice_snapshot_factory(n=6, a=1.2))
+    mc = hoomd.hpmc.integrate.Sphere(default_d=0.1)
+    mc.shape['A'] = dict(diameter=1)
+    sim.operations.integrator = mc
+    sim.run(10)
+    box = sim.state.box
+
+    # the interaction range stretched into this box exceeds the image list
+    trial = _trial_box(box, Lx=0.6, Ly=0.6, Lz=0.6)
+    evaluated, _, _ = mc._cpp_obj.evaluateBoxResize(sim.timestep,
+                                                    trial._cpp_obj)
+    assert not evaluated
+
+    # the pair list still serves trials within range
+    trial = _trial_box(box, Lx=1.01, Ly=1.01, Lz=1.01)
+    evaluated, allowed, _ = mc._cpp_obj.evaluateBoxResize(
+        sim.timestep, trial._cpp_obj)
+    assert evaluated
+    assert allowed
+
+    boxmc = hoomd.hpmc.update.BoxMC(betaP=1000, trigger=1)
+    boxmc.volume = dict(mode='standard', weight=1, delta=0.8 * box.volume)
+    sim.operations.updaters.append(boxmc)
+    sim.run(20)
+    assert mc.overlaps == 0
+
+
 @pytest.mark.parametrize("box_move", box_moves_attrs)
 def test_pickling(box_move, simulation_factory, two_particle_snapshot_factory):
     boxmc = hoomd.hpmc.update.BoxMC(betaP=3, trigger=1)
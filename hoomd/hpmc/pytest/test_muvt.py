@@ -29,6 +29,7 @@ valid_attrs = [
     ("transfer_types", ["A"]),
     ("transfer_types", ["B"]),
     ("transfer_types", ["A", "B"]),
+    ("batch_size", 8),
 ]
 
 
@@ -172,6 +173,76 @@ def test_insertion_removal(device, simulation_factory,
     assert muvt.N["B"] > 0
 
 
+@pytest.mark.serial
+@pytest.mark.cpu
+def test_batch_insertion_removal(simulation_factory, lattice_snapshot_factory):
+    """Test that MuVT inserts and removes particles in batches."""
+    sim = simulation_factory(
+        lattice_snapshot_factory(particle_types=["A", "B"],
+                                 dimensions=3,
+                                 a=4,
+                                 n=7,
+                                 r=0.1))
+
+    mc = hoomd.hpmc.integrate.Sphere(default_d=0.1, default_a=0.1)
+    mc.shape["A"] = dict(diameter=1.1)
+    mc.shape["B"] = dict(diameter=1.3)
+    sim.operations.integrator = mc
+
+    muvt = hoomd.hpmc.update.MuVT(trigger=hoomd.trigger.Periodic(5),
+                                  transfer_types=["B"])
+    muvt.batch_size = 16
+    muvt.fugacity["B"] = 1
+    sim.operations.updaters.append(muvt)
+
+    sim.run(20)
+    assert (sum(muvt.insert_moves) + sum(muvt.remove_moves)) % 16 == 0
+    assert sum(muvt.insert_moves) > 0
+    assert sum(muvt.remove_moves) > 0
+    assert muvt.N["B"] > 0
+
+    # the inserted particles do not overlap
+    assert mc.overlaps == 0
+
+
+@pytest.mark.serial
+@pytest.mark.cpu
+@pytest.mark.parametrize("batch_size", [2, 5])
+def test_batch_ideal_gas(batch_size, simulation_factory,
+                         lattice_snapshot_factory):
+    """Test that batched trials sample the ideal gas distribution."""
+    sim = simulation_factory(
+        lattice_snapshot_factory(particle_types=["A", "B"],
+                                 dimensions=3,
+                                 a=5,
+                                 n=2))
+
+    mc = hoomd.hpmc.integrate.Sphere(default_d=0.1)
+    mc.shape["A"] = dict(diameter=1)
+    mc.shape["B"] = dict(diameter=1)
+    mc.interaction_matrix[("A", "B")] = False
+    mc.interaction_matrix[("B", "B")] = False
+    sim.operations.integrator = mc
+
+    # the number of ideal gas particles is Poisson distributed with mean z V
+    z_V = 2.0
+    muvt = hoomd.hpmc.update.MuVT(trigger=hoomd.trigger.Periodic(1),
+                                  transfer_types=["B"])
+    muvt.batch_size = batch_size
+    muvt.fugacity["B"] = z_V / sim.state.box.volume
+    sim.operations.updaters.append(muvt)
+
+    sim.run(100)
+
+    n_samples = 4000
+    total = 0
+    for _ in range(n_samples):
+        sim.run(1)
+        total += muvt.N["B"]
+
+    assert total / n_samples == pytest.approx(z_V, abs=0.2)
+
+
 @pytest.mark.cpu
 @pytest.mark.skipif(not hoomd.version.llvm_enabled, reason="LLVM not enabled")
 def test_jit_remove_insert(device, simulation_factory,
@@ -0,0 +1,110 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/test/upp11_config.h"
+
+HOOMD_UP_MAIN();
+
+#include "hoomd/hpmc/UnionFind.h"
+
+#include <thread>
+#include <vector>
+
+#include "hoomd/RandomNumbers.h"
+
+using namespace hoomd;
+using namespace hoomd::hpmc::detail;
+
+UP_TEST(singletons)
+    {
+    UnionFind uf;
+    uf.reset(4);
+
+    std::vector<std::vector<unsigned int>> cc;
+    uf.connectedComponents(cc);
+    UP_ASSERT_EQUAL(cc.size(), 4);
+    for (unsigned int v = 0; v < 4; ++v)
+        {
+        UP_ASSERT_EQUAL(cc[v].size(), 1);
+        UP_ASSERT_EQUAL(cc[v][0], v);
+        }
+    }
+
+UP_TEST(components)
+    {
+    UnionFind uf;
+    uf.reset(7);
+
+    // two chains and an isolated vertex: {0, 2, 5}, {1, 3, 4, 6}
+    uf.unite(5, 2);
+    uf.unite(2, 0);
+    uf.unite(6, 4);
+    uf.unite(3, 1);
+    uf.unite(4, 3);
+    uf.unite(4, 6);
+
+    UP_ASSERT_EQUAL(uf.find(5), 0);
+    UP_ASSERT_EQUAL(uf.find(6), 1);
+
+    std::vector<std::vector<unsigned int>> cc;
+    uf.connectedComponents(cc);
+    UP_ASSERT_EQUAL(cc.size(), 2);
+
+    // components are ordered by, and start with, their smallest vertex
+    std::vector<unsigned int> cc_0 = {0, 2, 5};
+    std::vector<unsigned int> cc_1 = {1, 3, 4, 6};
+    UP_ASSERT(cc[0] == cc_0);
+    UP_ASSERT(cc[1] == cc_1);
+
+    // reset to fewer vertices
+    uf.reset(3);
+    uf.connectedComponents(cc);
+    UP_ASSERT_EQUAL(cc.size(), 3);
+    }
+
+UP_TEST(concurrent)
+    {
+    const unsigned int N = 10000;
+    const unsigned int n_edges = 8000;
+    const unsigned int n_threads = 4;
+
+    std::vector<std::pair<unsigned int, unsigned int>> edges;
+    hoomd::RandomGenerator rng(hoomd::Seed(0, 1, 2), hoomd::Counter(3));
+    for (unsigned int k = 0; k < n_edges; ++k)
+        {
+        unsigned int v = hoomd::UniformIntDistribution(N - 1)(rng);
+        unsigned int w = hoomd::UniformIntDistribution(N - 1)(rng);
+        edges.push_back(std::make_pair(v, w));
+        }
+
+    // reference result
+    UnionFind serial;
+    serial.reset(N);
+    for (auto& edge : edges)
+        serial.unite(edge.first, edge.second);
+
+    std::vector<std::vector<unsigned int>> cc_serial;
+    serial.connectedComponents(cc_serial);
+
+    // unite the same edges from several threads
+    UnionFind parallel;
+    parallel.reset(N);
+
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < n_threads; ++t)
+        {
+        threads.emplace_back(
+            [&, t]()
+            {
+                for (size_t k = t; k < edges.size(); k += n_threads)
+                    parallel.unite(edges[k].first, edges[k].second);
+            });
+        }
+    for (auto& thread : threads)
+        thread.join();
+
+    std::vector<std::vector<unsigned int>> cc_parallel;
+    parallel.connectedComponents(cc_parallel);
+
+    UP_ASSERT(cc_serial == cc_parallel);
+    }
@@ -409,6 +409,14 @@ class MuVT(Updater):
           (applies to Gibbs ensemble)
         ntrial (float): (**default**: 1) Number of configurational bias attempts
           to swap depletants
+        batch_size (int): (**default**: 1) Number of insertion or removal
+          trials performed per update. Each trial chooses between insertion
+          and removal with equal probability, as a single trial does. `MuVT`
+          evaluates consecutive insertion candidates against the current
+          configuration in parallel and then accepts or rejects them in
+          order, accounting for the candidates accepted earlier in the batch.
+          Batching requires a grand canonical simulation on a single rank
+          without depletants.
         fugacity (`TypeParameter` [ ``particle type``, `float`]):
             Particle fugacity
             :math:`[\mathrm{volume}^{-1}]` (**default:** 0).
@@ -424,7 +432,7 @@ class MuVT(Updater):
 
         self.ngibbs = int(ngibbs)
 
-        _default_dict = dict(ntrial=1)
+        _default_dict = dict(ntrial=1, batch_size=1)
         param_dict = ParameterDict(
             transfer_types=list(transfer_types),
             max_volume_rescale=float(max_volume_rescale),
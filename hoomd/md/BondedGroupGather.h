@@ -0,0 +1,107 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file BondedGroupGather.h
+    \brief Declares a helper to evaluate bonded forces per particle on the CPU
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#pragma once
+
+#include "hoomd/BondedGroupData.h"
+#include "hoomd/ExecutionConfiguration.h"
+
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace detail
+    {
+//! Loop over the bonded groups of each local particle
+/*! \param exec_conf Execution configuration
+    \param group_data Bonded group data
+    \param N Number of local particles
+    \param f Function called as f(idx, members, pos, type) for each group of each local particle
+
+    gatherBondedGroups walks the particle-centric group table that BondedGroupData builds for the
+    GPU. For every local particle \a idx and every group it belongs to, \a f receives the particle
+    indices of all group members in group order, the position \a pos of \a idx in the group, and
+    the group type. A group is visited once per local member, so \a f evaluates the whole group
+    and accumulates only the contribution of member \a pos into the force and virial of \a idx.
+
+    \a f never writes to other particles, so the loop over particles runs in parallel when TBB
+    is enabled.
+*/
+template<class GroupData, class Func>
+void gatherBondedGroups(const ExecutionConfiguration& exec_conf,
+                        GroupData& group_data,
+                        unsigned int N,
+                        const Func& f)
+    {
+    typedef typename GroupData::members_t members_t;
+    constexpr unsigned int group_size = GroupData::size;
+
+    // accessing the table rebuilds it when the groups have changed
+    const GPUVector<members_t>& table = group_data.getGPUTable();
+    const Index2D& table_indexer = group_data.getGPUTableIndexer();
+
+    ArrayHandle<members_t> h_table(table, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_pos_table(group_data.getGPUPosTable(),
+                                          access_location::host,
+                                          access_mode::read);
+    ArrayHandle<unsigned int> h_n_groups(group_data.getNGroupsArray(),
+                                         access_location::host,
+                                         access_mode::read);
+
+    auto gather_particle = [&](unsigned int idx)
+    {
+        const unsigned int n_groups = h_n_groups.data[idx];
+        for (unsigned int k = 0; k < n_groups; k++)
+            {
+            const members_t& entry = h_table.data[table_indexer(idx, k)];
+            const unsigned int pos = h_pos_table.data[table_indexer(idx, k)];
+
+            // the table lists the other members in group order, followed by the type
+            unsigned int members[group_size];
+            unsigned int n = 0;
+            for (unsigned int j = 0; j < group_size; j++)
+                {
+                members[j] = (j == pos) ? idx : entry.idx[n++];
+                }
+
+            f(idx, members, pos, entry.idx[group_size - 1]);
+            }
+    };
+
+#ifdef ENABLE_TBB
+    exec_conf.getTaskArena()->execute(
+        [&]
+        {
+            tbb::parallel_for(tbb::blocked_range<unsigned int>(0, N),
+                              [&](const tbb::blocked_range<unsigned int>& r)
+                              {
+                                  for (unsigned int idx = r.begin(); idx != r.end(); ++idx)
+                                      {
+                                      gather_particle(idx);
+                                      }
+                              });
+        });
+#else
+    for (unsigned int idx = 0; idx < N; idx++)
+        {
+        gather_particle(idx);
+        }
+#endif
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
@@ -59,6 +59,11 @@ CommunicatorGrid<T>::CommunicatorGrid(std::shared_ptr<SystemDefinition> sysdef,
     {
     m_exec_conf->msg->notice(5) << "Constructing CommunicatorGrid" << std::endl;
 
+    if (m_pdata->getDomainDecomposition()->isRecursiveBisection())
+        {
+        throw std::runtime_error("Mesh methods do not support recursive bisection domains.");
+        }
+
     initGridComm();
     }
 
@@ -0,0 +1,477 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ComputeRDF.cc
+    \brief Defines the ComputeRDF class
+*/
+
+#include "ComputeRDF.h"
+
+#ifdef ENABLE_MPI
+#include "hoomd/Communicator.h"
+#include "hoomd/HOOMDMPI.h"
+#endif
+
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <pybind11/numpy.h>
+
+#include <cmath>
+#include <stdexcept>
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace
+    {
+/// Loop over local particles in parallel with one histogram per thread
+/** @param exec_conf Execution configuration
+    @param N Number of local particles
+    @param hist Histogram to add to
+    @param f Function called as f(i, hist) for each local particle
+*/
+template<class Func>
+void histogramParticles(const ExecutionConfiguration& exec_conf,
+                        unsigned int N,
+                        std::vector<double>& hist,
+                        const Func& f)
+    {
+#ifdef ENABLE_TBB
+    tbb::enumerable_thread_specific<std::vector<double>> thread_hist(
+        std::vector<double>(hist.size(), 0.0));
+    exec_conf.getTaskArena()->execute(
+        [&]
+        {
+            tbb::parallel_for(tbb::blocked_range<unsigned int>(0, N),
+                              [&](const tbb::blocked_range<unsigned int>& r)
+                              {
+                                  std::vector<double>& local = thread_hist.local();
+                                  for (unsigned int i = r.begin(); i != r.end(); ++i)
+                                      {
+                                      f(i, local);
+                                      }
+                              });
+        });
+    for (const auto& local : thread_hist)
+        {
+        for (size_t k = 0; k < hist.size(); k++)
+            {
+            hist[k] += local[k];
+            }
+        }
+#else
+    for (unsigned int i = 0; i < N; i++)
+        {
+        f(i, hist);
+        }
+#endif
+    }
+    } // end anonymous namespace
+
+/*! \param sysdef System definition
+    \param nlist Neighbor list to reuse when its cutoff covers r_max (may be null)
+    \param r_max Maximum pair distance
+    \param bins Number of bins
+*/
+ComputeRDF::ComputeRDF(std::shared_ptr<SystemDefinition> sysdef,
+                       std::shared_ptr<NeighborList> nlist,
+                       Scalar r_max,
+                       unsigned int bins)
+    : Compute(sysdef), m_nlist(nlist), m_r_max(r_max), m_bins(bins),
+      m_pair_idx(m_pdata->getNTypes())
+    {
+    m_exec_conf->msg->notice(5) << "Constructing ComputeRDF" << endl;
+
+    if (m_r_max <= Scalar(0.0))
+        {
+        throw std::domain_error("r_max must be positive.");
+        }
+    if (m_bins == 0)
+        {
+        throw std::domain_error("bins must be positive.");
+        }
+
+    reset();
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        auto comm_weak = m_sysdef->getCommunicator();
+        assert(comm_weak.lock());
+        m_comm = comm_weak.lock();
+        m_comm->getGhostLayerWidthRequestSignal()
+            .connect<ComputeRDF, &ComputeRDF::getGhostLayerWidth>(this);
+        }
+#endif
+    }
+
+ComputeRDF::~ComputeRDF()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying ComputeRDF" << endl;
+
+#ifdef ENABLE_MPI
+    if (m_comm)
+        {
+        m_comm->getGhostLayerWidthRequestSignal()
+            .disconnect<ComputeRDF, &ComputeRDF::getGhostLayerWidth>(this);
+        }
+#endif
+    }
+
+void ComputeRDF::reset()
+    {
+    m_rdf_sum.assign(size_t(m_pair_idx.getNumElements()) * m_bins, 0.0);
+    m_n_frames = 0;
+    }
+
+/*! The neighbor list includes every pair within r_cut of the type pair. Pairs between r_cut and
+    r_cut + r_buff may be missing, so the buffer does not count towards r_max.
+*/
+bool ComputeRDF::nlistCoversRMax()
+    {
+    const Index2D& typpair_idx = m_nlist->getTypePairIndexer();
+    ArrayHandle<Scalar> h_r_cut(m_nlist->getRCutMatrix(), access_location::host, access_mode::read);
+    for (unsigned int k = 0; k < typpair_idx.getNumElements(); k++)
+        {
+        if (h_r_cut.data[k] < m_r_max)
+            {
+            return false;
+            }
+        }
+    return true;
+    }
+
+/*! \param timestep Current time step of the simulation
+
+    Adds the normalized histogram of the current configuration to the accumulated sum.
+*/
+void ComputeRDF::compute(uint64_t timestep)
+    {
+    Compute::compute(timestep);
+    if (!shouldCompute(timestep))
+        return;
+
+    const BoxDim& global_box = m_pdata->getGlobalBox();
+    const bool two_d = m_sysdef->getNDimensions() == 2;
+    Scalar3 L = global_box.getNearestPlaneDistance();
+    if (m_r_max * Scalar(2.0) > L.x || m_r_max * Scalar(2.0) > L.y
+        || (!two_d && m_r_max * Scalar(2.0) > L.z))
+        {
+        throw std::runtime_error("ComputeRDF: r_max is larger than half the box.");
+        }
+
+    const unsigned int n_types = m_pdata->getNTypes();
+    std::vector<double> hist(size_t(m_pair_idx.getNumElements()) * m_bins, 0.0);
+
+    m_used_nlist = m_nlist && nlistCoversRMax();
+    if (m_used_nlist)
+        {
+        m_nlist->compute(timestep);
+        countNeighborList(timestep, hist);
+        }
+    else
+        {
+        if (!m_use_cell_list)
+            {
+            m_use_cell_list = true;
+            m_cl = std::make_shared<CellList>(m_sysdef);
+            m_cl->setRadius(1);
+            m_cl->setComputeXYZF(true);
+            m_cl->setComputeTypeBody(false);
+            m_cl->setFlagIndex();
+            m_cl->setNominalWidth(m_r_max);
+
+#ifdef ENABLE_MPI
+            // exchange ghosts again with the wider ghost layer
+            if (m_comm)
+                {
+                m_comm->forceMigrate();
+                m_comm->communicate(timestep);
+                }
+#endif
+            }
+        countCellList(timestep, hist);
+        }
+
+    // count the particles of each type
+    std::vector<double> n_type(n_types, 0.0);
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+        for (unsigned int i = 0; i < m_pdata->getN(); i++)
+            {
+            n_type[__scalar_as_int(h_pos.data[i].w)] += 1.0;
+            }
+        }
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      hist.data(),
+                      (int)hist.size(),
+                      MPI_DOUBLE,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        MPI_Allreduce(MPI_IN_PLACE,
+                      n_type.data(),
+                      (int)n_type.size(),
+                      MPI_DOUBLE,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    // hist counts every pair once from each side: a-b pairs are expected 2 N_a N_b / V times per
+    // unit volume and a-a pairs N_a (N_a - 1) / V times
+    const double volume = global_box.getVolume(two_d);
+    const double dr = double(m_r_max) / m_bins;
+    for (unsigned int a = 0; a < n_types; a++)
+        {
+        for (unsigned int b = a; b < n_types; b++)
+            {
+            const double n_pairs
+                = (a == b) ? n_type[a] * (n_type[a] - 1.0) : 2.0 * n_type[a] * n_type[b];
+            if (n_pairs <= 0.0)
+                continue;
+
+            const size_t offset = size_t(m_pair_idx(a, b)) * m_bins;
+            for (unsigned int k = 0; k < m_bins; k++)
+                {
+                const double r_lo = k * dr;
+                const double r_hi = (k + 1) * dr;
+                const double shell = two_d ? M_PI * (r_hi * r_hi - r_lo * r_lo)
+                                           : 4.0 / 3.0 * M_PI
+                                                 * (r_hi * r_hi * r_hi - r_lo * r_lo * r_lo);
+                m_rdf_sum[offset + k] += hist[offset + k] / (n_pairs / volume * shell);
+                }
+            }
+        }
+
+    m_n_frames++;
+    }
+
+/*! \param timestep Current time step of the simulation
+    \param hist Histogram to add to
+
+    In half storage mode, a pair of two local particles is listed once and counts for both
+    particles. A pair with a ghost counts once here and once on the rank that owns the ghost.
+*/
+void ComputeRDF::countNeighborList(uint64_t timestep, std::vector<double>& hist)
+    {
+    const unsigned int N = m_pdata->getN();
+    const BoxDim& box = m_pdata->getBox();
+    const bool half = m_nlist->getStorageMode() == NeighborList::half;
+    const Scalar r_max_sq = m_r_max * m_r_max;
+    const Scalar inv_dr = Scalar(m_bins) / m_r_max;
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_n_neigh(m_nlist->getNNeighArray(),
+                                        access_location::host,
+                                        access_mode::read);
+    ArrayHandle<unsigned int> h_nlist(m_nlist->getNListArray(),
+                                      access_location::host,
+                                      access_mode::read);
+    ArrayHandle<size_t> h_head_list(m_nlist->getHeadList(),
+                                    access_location::host,
+                                    access_mode::read);
+
+    histogramParticles(*m_exec_conf,
+                       N,
+                       hist,
+                       [&](unsigned int i, std::vector<double>& local)
+                       {
+                           const Scalar3 pos_i = make_scalar3(h_pos.data[i].x,
+                                                              h_pos.data[i].y,
+                                                              h_pos.data[i].z);
+                           const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
+                           const size_t head_i = h_head_list.data[i];
+
+                           for (unsigned int k = 0; k < h_n_neigh.data[i]; k++)
+                               {
+                               const unsigned int j = h_nlist.data[head_i + k];
+                               Scalar3 dx = pos_i
+                                            - make_scalar3(h_pos.data[j].x,
+                                                           h_pos.data[j].y,
+                                                           h_pos.data[j].z);
+                               dx = box.minImage(dx);
+                               const Scalar r_sq = dot(dx, dx);
+                               if (r_sq >= r_max_sq)
+                                   continue;
+
+                               const unsigned int bin
+                                   = std::min((unsigned int)(sqrt(r_sq) * inv_dr), m_bins - 1);
+                               const unsigned int type_j = __scalar_as_int(h_pos.data[j].w);
+                               local[size_t(m_pair_idx(type_i, type_j)) * m_bins + bin]
+                                   += (half && j < N) ? 2.0 : 1.0;
+                               }
+                       });
+    }
+
+/*! \param timestep Current time step of the simulation
+    \param hist Histogram to add to
+
+    Every local particle counts all of its neighbors within r_max, including ghosts.
+*/
+void ComputeRDF::countCellList(uint64_t timestep, std::vector<double>& hist)
+    {
+    m_cl->compute(timestep);
+
+    const unsigned int N = m_pdata->getN();
+    const BoxDim& box = m_pdata->getBox();
+    const uint3 dim = m_cl->getDim();
+    const Scalar3 ghost_width = m_cl->getGhostWidth();
+    const uchar3 periodic = box.getPeriodic();
+    const Scalar r_max_sq = m_r_max * m_r_max;
+    const Scalar inv_dr = Scalar(m_bins) / m_r_max;
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_cell_size(m_cl->getCellSizeArray(),
+                                          access_location::host,
+                                          access_mode::read);
+    ArrayHandle<Scalar4> h_cell_xyzf(m_cl->getXYZFArray(),
+                                     access_location::host,
+                                     access_mode::read);
+    ArrayHandle<unsigned int> h_cell_adj(m_cl->getCellAdjArray(),
+                                         access_location::host,
+                                         access_mode::read);
+
+    const Index3D ci = m_cl->getCellIndexer();
+    const Index2D cli = m_cl->getCellListIndexer();
+    const Index2D cadji = m_cl->getCellAdjIndexer();
+
+    histogramParticles(
+        *m_exec_conf,
+        N,
+        hist,
+        [&](unsigned int i, std::vector<double>& local)
+        {
+            const Scalar3 pos_i = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+            const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
+
+            // find the cell of particle i
+            Scalar3 f = box.makeFraction(pos_i, ghost_width);
+            int ib = (int)(f.x * dim.x);
+            int jb = (int)(f.y * dim.y);
+            int kb = (int)(f.z * dim.z);
+
+            // handle particles exactly at the box hi
+            if (ib == (int)dim.x && periodic.x)
+                ib = 0;
+            if (jb == (int)dim.y && periodic.y)
+                jb = 0;
+            if (kb == (int)dim.z && periodic.z)
+                kb = 0;
+
+            const unsigned int my_cell = ci(ib, jb, kb);
+
+            for (unsigned int cur_adj = 0; cur_adj < cadji.getW(); cur_adj++)
+                {
+                const unsigned int neigh_cell = h_cell_adj.data[cadji(cur_adj, my_cell)];
+                const unsigned int size = h_cell_size.data[neigh_cell];
+                for (unsigned int offset = 0; offset < size; offset++)
+                    {
+                    const Scalar4& xyzf = h_cell_xyzf.data[cli(offset, neigh_cell)];
+                    const unsigned int j = __scalar_as_int(xyzf.w);
+                    if (j == i)
+                        continue;
+
+                    Scalar3 dx = pos_i - make_scalar3(xyzf.x, xyzf.y, xyzf.z);
+                    dx = box.minImage(dx);
+                    const Scalar r_sq = dot(dx, dx);
+                    if (r_sq >= r_max_sq)
+                        continue;
+
+                    const unsigned int bin
+                        = std::min((unsigned int)(sqrt(r_sq) * inv_dr), m_bins - 1);
+                    const unsigned int type_j = __scalar_as_int(h_pos.data[j].w);
+                    local[size_t(m_pair_idx(type_i, type_j)) * m_bins + bin] += 1.0;
+                    }
+                }
+        });
+    }
+
+/*! \returns The average g(r) of each type pair over the accumulated timesteps.
+ */
+std::vector<double> ComputeRDF::getRDF()
+    {
+    std::vector<double> rdf(m_rdf_sum.size(), 0.0);
+    if (m_n_frames > 0)
+        {
+        for (size_t k = 0; k < rdf.size(); k++)
+            {
+            rdf[k] = m_rdf_sum[k] / double(m_n_frames);
+            }
+        }
+    return rdf;
+    }
+
+pybind11::object ComputeRDF::getRDFPython()
+    {
+    std::vector<double> rdf = getRDF();
+    return pybind11::array_t<double>(
+        std::vector<size_t> {size_t(m_pair_idx.getNumElements()), size_t(m_bins)},
+        rdf.data());
+    }
+
+pybind11::object ComputeRDF::getBinCentersPython()
+    {
+    std::vector<double> centers(m_bins);
+    const double dr = double(m_r_max) / m_bins;
+    for (unsigned int k = 0; k < m_bins; k++)
+        {
+        centers[k] = (k + 0.5) * dr;
+        }
+    return pybind11::array_t<double>(centers.size(), centers.data());
+    }
+
+/*! \param name Name of the loggable quantity in Python
+
+    Provides rdf. Sampling histograms the current timestep and returns the running average.
+*/
+LogQuantity ComputeRDF::getLogQuantity(const std::string& name)
+    {
+    LogQuantity quantity;
+    if (name == "rdf")
+        {
+        quantity.size = m_pair_idx.getNumElements() * m_bins;
+        quantity.sample = [this](uint64_t timestep, double* values)
+        {
+            compute(timestep);
+            std::vector<double> rdf = getRDF();
+            std::copy(rdf.begin(), rdf.end(), values);
+        };
+        }
+    return quantity;
+    }
+
+namespace detail
+    {
+void export_ComputeRDF(pybind11::module& m)
+    {
+    pybind11::class_<ComputeRDF, Compute, std::shared_ptr<ComputeRDF>>(m, "ComputeRDF")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<NeighborList>,
+                            Scalar,
+                            unsigned int>())
+        .def("reset", &ComputeRDF::reset)
+        .def_property_readonly("r_max", &ComputeRDF::getRMax)
+        .def_property_readonly("bins", &ComputeRDF::getBins)
+        .def_property_readonly("num_frames", &ComputeRDF::getNumFrames)
+        .def_property_readonly("used_neighbor_list", &ComputeRDF::getUsedNeighborList)
+        .def_property_readonly("rdf", &ComputeRDF::getRDFPython)
+        .def_property_readonly("bin_centers", &ComputeRDF::getBinCentersPython);
+    }
+
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
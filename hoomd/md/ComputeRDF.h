@@ -0,0 +1,139 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ComputeRDF.h
+    \brief Declares the ComputeRDF class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#pragma once
+
+#include "NeighborList.h"
+
+#include "hoomd/CellList.h"
+#include "hoomd/Compute.h"
+#include "hoomd/Index1D.h"
+
+#include <memory>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+namespace md
+    {
+/// Accumulate partial radial distribution functions in situ
+/** ComputeRDF histograms the distances between all pairs of particles closer than r_max, separately
+    for each unordered pair of particle types, and accumulates the normalized histograms over every
+    timestep it computes. getRDF() returns the average g_ab(r) over those timesteps.
+
+    Pairs come from the neighbor list when one is given and its cutoff covers r_max for every type
+    pair. The neighbor list includes all pairs within r_cut, so the pair histogram reuses the list
+    that the pair force already built. Pairs that the neighbor list excludes (e.g. bonded pairs)
+    are not counted in this case. Otherwise, ComputeRDF bins the particles in its own cell list
+    and requests ghost particles out to r_max.
+
+    The loop over particles runs in parallel when TBB is enabled. Histograms are summed over the
+    MPI ranks, so all ranks hold the same result.
+
+    \ingroup computes
+*/
+class PYBIND11_EXPORT ComputeRDF : public Compute
+    {
+    public:
+    /// Constructor
+    ComputeRDF(std::shared_ptr<SystemDefinition> sysdef,
+               std::shared_ptr<NeighborList> nlist,
+               Scalar r_max,
+               unsigned int bins);
+
+    /// Destructor
+    virtual ~ComputeRDF();
+
+    /// Histogram the current configuration
+    virtual void compute(uint64_t timestep);
+
+    /// Discard the accumulated histograms
+    void reset();
+
+    /// Get the maximum pair distance
+    Scalar getRMax()
+        {
+        return m_r_max;
+        }
+
+    /// Get the number of bins
+    unsigned int getBins()
+        {
+        return m_bins;
+        }
+
+    /// Get the number of accumulated timesteps
+    uint64_t getNumFrames()
+        {
+        return m_n_frames;
+        }
+
+    /// Get whether the last histogram used the neighbor list
+    bool getUsedNeighborList()
+        {
+        return m_used_nlist;
+        }
+
+    /// Get the average g(r) (indexed by type pair, then bin)
+    std::vector<double> getRDF();
+
+    /// Get the average g(r) for Python as a (N_pairs, bins) array
+    pybind11::object getRDFPython();
+
+    /// Get the bin centers for Python
+    pybind11::object getBinCentersPython();
+
+    /// Provide rdf to the native logger
+    virtual LogQuantity getLogQuantity(const std::string& name);
+
+    protected:
+    /// Histogram the pairs in the neighbor list
+    void countNeighborList(uint64_t timestep, std::vector<double>& hist);
+
+    /// Histogram the pairs in the cell list
+    void countCellList(uint64_t timestep, std::vector<double>& hist);
+
+    /// Get whether the neighbor list includes all pairs within r_max
+    bool nlistCoversRMax();
+
+    /// Request ghost particles out to r_max
+    Scalar getGhostLayerWidth(unsigned int type)
+        {
+        return m_use_cell_list ? m_r_max : Scalar(0.0);
+        }
+
+    std::shared_ptr<NeighborList> m_nlist; //!< Neighbor list (may be null)
+    std::shared_ptr<CellList> m_cl;        //!< Cell list used when the neighbor list is too short
+    Scalar m_r_max;                        //!< Maximum pair distance
+    unsigned int m_bins;                   //!< Number of bins
+    Index2DUpperTriangular m_pair_idx;     //!< Index unordered type pairs
+
+    std::vector<double> m_rdf_sum; //!< Sum of the normalized histograms
+    uint64_t m_n_frames = 0;       //!< Number of accumulated timesteps
+    bool m_used_nlist = false;     //!< True when the last histogram used the neighbor list
+    bool m_use_cell_list = false;  //!< True when ghosts out to r_max are requested
+
+#ifdef ENABLE_MPI
+    std::shared_ptr<Communicator> m_comm; //!< Communicator that provides ghost particles
+#endif
+    };
+
+namespace detail
+    {
+/// Export ComputeRDF to Python
+void export_ComputeRDF(pybind11::module& m);
+
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
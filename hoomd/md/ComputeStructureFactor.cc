@@ -0,0 +1,345 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ComputeStructureFactor.cc
+    \brief Defines the ComputeStructureFactor class
+*/
+
+#include "ComputeStructureFactor.h"
+
+#ifdef ENABLE_MPI
+#include "hoomd/HOOMDMPI.h"
+#endif
+
+#include <pybind11/numpy.h>
+
+#include <cmath>
+#include <stdexcept>
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System definition
+    \param mesh Number of mesh points along each box vector
+    \param q_max Largest wave vector magnitude
+    \param bins Number of bins
+*/
+ComputeStructureFactor::ComputeStructureFactor(std::shared_ptr<SystemDefinition> sysdef,
+                                               unsigned int mesh,
+                                               Scalar q_max,
+                                               unsigned int bins)
+    : Compute(sysdef), m_mesh(mesh), m_q_max(q_max), m_bins(bins)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing ComputeStructureFactor" << endl;
+
+    if (m_mesh < 2)
+        {
+        throw std::domain_error("mesh must be at least 2.");
+        }
+    if (m_q_max <= Scalar(0.0))
+        {
+        throw std::domain_error("q_max must be positive.");
+        }
+    if (m_bins == 0)
+        {
+        throw std::domain_error("bins must be positive.");
+        }
+
+    reset();
+    }
+
+ComputeStructureFactor::~ComputeStructureFactor()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying ComputeStructureFactor" << endl;
+
+    if (m_kiss_fft)
+        {
+        kiss_fft_free(m_kiss_fft);
+        }
+    }
+
+void ComputeStructureFactor::reset()
+    {
+    m_sum.assign(m_bins, 0.0);
+    m_count.assign(m_bins, 0.0);
+    m_n_frames = 0;
+    }
+
+/*! \param timestep Current time step of the simulation
+ */
+void ComputeStructureFactor::compute(uint64_t timestep)
+    {
+    Compute::compute(timestep);
+    if (!shouldCompute(timestep))
+        return;
+
+    const unsigned int mesh_z = m_sysdef->getNDimensions() == 2 ? 1 : m_mesh;
+    std::vector<double> density(size_t(m_mesh) * m_mesh * mesh_z, 0.0);
+    assignParticles(density);
+
+    std::vector<double> sum(m_bins, 0.0);
+    std::vector<double> count(m_bins, 0.0);
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        const bool root = m_exec_conf->isRoot();
+        MPI_Reduce(root ? MPI_IN_PLACE : density.data(),
+                   root ? density.data() : nullptr,
+                   (int)density.size(),
+                   MPI_DOUBLE,
+                   MPI_SUM,
+                   0,
+                   m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    if (m_exec_conf->isRoot())
+        {
+        binModes(density, sum, count);
+        }
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        bcast(sum, 0, m_exec_conf->getMPICommunicator());
+        bcast(count, 0, m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    for (unsigned int k = 0; k < m_bins; k++)
+        {
+        m_sum[k] += sum[k];
+        m_count[k] += count[k];
+        }
+    m_n_frames++;
+    }
+
+/*! \param density Mesh to add the particles to (x index varies fastest)
+
+    Each particle adds weight to the 4 (2D) or 8 (3D) nearest mesh points in fractional
+    coordinates of the global box.
+*/
+void ComputeStructureFactor::assignParticles(std::vector<double>& density)
+    {
+    const BoxDim& global_box = m_pdata->getGlobalBox();
+    const bool two_d = m_sysdef->getNDimensions() == 2;
+    const unsigned int mesh_z = two_d ? 1 : m_mesh;
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+
+    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+        {
+        Scalar3 pos = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+        Scalar3 f = global_box.makeFraction(pos);
+
+        double u[3] = {f.x * m_mesh, f.y * m_mesh, two_d ? 0.0 : f.z * m_mesh};
+        int lo[3];
+        double w[3];
+        for (unsigned int d = 0; d < 3; d++)
+            {
+            lo[d] = int(floor(u[d]));
+            w[d] = u[d] - lo[d];
+            }
+
+        for (unsigned int dz = 0; dz < (two_d ? 1u : 2u); dz++)
+            {
+            const unsigned int z = (unsigned int)((lo[2] + int(dz)) % int(mesh_z) + mesh_z)
+                                   % mesh_z;
+            const double wz = two_d ? 1.0 : (dz ? w[2] : 1.0 - w[2]);
+            for (unsigned int dy = 0; dy < 2; dy++)
+                {
+                const unsigned int y = (unsigned int)((lo[1] + int(dy)) % int(m_mesh) + m_mesh)
+                                       % m_mesh;
+                const double wy = dy ? w[1] : 1.0 - w[1];
+                for (unsigned int dx = 0; dx < 2; dx++)
+                    {
+                    const unsigned int x
+                        = (unsigned int)((lo[0] + int(dx)) % int(m_mesh) + m_mesh) % m_mesh;
+                    const double wx = dx ? w[0] : 1.0 - w[0];
+                    density[(size_t(z) * m_mesh + y) * m_mesh + x] += wx * wy * wz;
+                    }
+                }
+            }
+        }
+    }
+
+/*! \param density Global density mesh
+    \param sum Sum of S(q) over the modes in each bin
+    \param count Number of modes in each bin
+*/
+void ComputeStructureFactor::binModes(const std::vector<double>& density,
+                                      std::vector<double>& sum,
+                                      std::vector<double>& count)
+    {
+    const BoxDim& global_box = m_pdata->getGlobalBox();
+    const bool two_d = m_sysdef->getNDimensions() == 2;
+    const unsigned int mesh_z = two_d ? 1 : m_mesh;
+
+    if (!m_kiss_fft || m_mesh_z != mesh_z)
+        {
+        if (m_kiss_fft)
+            {
+            kiss_fft_free(m_kiss_fft);
+            }
+
+        int dims[3] = {int(mesh_z), int(m_mesh), int(m_mesh)};
+        m_kiss_fft = two_d ? kiss_fftnd_alloc(dims + 1, 2, 0, NULL, NULL)
+                           : kiss_fftnd_alloc(dims, 3, 0, NULL, NULL);
+        m_mesh_z = mesh_z;
+        }
+
+    std::vector<kiss_fft_cpx> in(density.size());
+    std::vector<kiss_fft_cpx> out(density.size());
+    for (size_t k = 0; k < density.size(); k++)
+        {
+        in[k].r = kiss_fft_scalar(density[k]);
+        in[k].i = kiss_fft_scalar(0.0);
+        }
+    kiss_fftnd(m_kiss_fft, in.data(), out.data());
+
+    // compute reciprocal lattice vectors
+    Scalar3 a1 = global_box.getLatticeVector(0);
+    Scalar3 a2 = global_box.getLatticeVector(1);
+    Scalar3 a3 = global_box.getLatticeVector(2);
+    Scalar V_box = global_box.getVolume();
+    Scalar3 b1 = Scalar(2.0 * M_PI)
+                 * make_scalar3(a2.y * a3.z - a2.z * a3.y,
+                                a2.z * a3.x - a2.x * a3.z,
+                                a2.x * a3.y - a2.y * a3.x)
+                 / V_box;
+    Scalar3 b2 = Scalar(2.0 * M_PI)
+                 * make_scalar3(a3.y * a1.z - a3.z * a1.y,
+                                a3.z * a1.x - a3.x * a1.z,
+                                a3.x * a1.y - a3.y * a1.x)
+                 / V_box;
+    Scalar3 b3 = Scalar(2.0 * M_PI)
+                 * make_scalar3(a1.y * a2.z - a1.z * a2.y,
+                                a1.z * a2.x - a1.x * a2.z,
+                                a1.x * a2.y - a1.y * a2.x)
+                 / V_box;
+
+    // squared cloud-in-cell window along one box vector
+    auto window_sq = [this](int n)
+    {
+        if (n == 0)
+            return 1.0;
+        const double arg = M_PI * n / m_mesh;
+        const double sinc = sin(arg) / arg;
+        return sinc * sinc * sinc * sinc;
+    };
+
+    const double n_global = double(m_pdata->getNGlobal());
+    const double dq = double(m_q_max) / m_bins;
+    const int half = int(m_mesh) / 2;
+    for (unsigned int z = 0; z < mesh_z; z++)
+        {
+        const int nz = two_d ? 0 : (int(z) > half ? int(z) - int(m_mesh) : int(z));
+        for (unsigned int y = 0; y < m_mesh; y++)
+            {
+            const int ny = int(y) > half ? int(y) - int(m_mesh) : int(y);
+            for (unsigned int x = 0; x < m_mesh; x++)
+                {
+                const int nx = int(x) > half ? int(x) - int(m_mesh) : int(x);
+                if (nx == 0 && ny == 0 && nz == 0)
+                    continue;
+
+                Scalar3 q = Scalar(nx) * b1 + Scalar(ny) * b2 + Scalar(nz) * b3;
+                const double q_len = sqrt(dot(q, q));
+                if (q_len >= m_q_max)
+                    continue;
+
+                const kiss_fft_cpx& rho = out[(size_t(z) * m_mesh + y) * m_mesh + x];
+                const double window = window_sq(nx) * window_sq(ny) * window_sq(nz);
+                const double s = (double(rho.r) * rho.r + double(rho.i) * rho.i)
+                                 / (n_global * window);
+
+                const unsigned int bin = std::min((unsigned int)(q_len / dq), m_bins - 1);
+                sum[bin] += s;
+                count[bin] += 1.0;
+                }
+            }
+        }
+    }
+
+/*! \returns The average S(q) over all modes in each bin and all accumulated timesteps. Bins
+    without modes are 0.
+*/
+std::vector<double> ComputeStructureFactor::getStructureFactor()
+    {
+    std::vector<double> result(m_bins, 0.0);
+    for (unsigned int k = 0; k < m_bins; k++)
+        {
+        if (m_count[k] > 0.0)
+            {
+            result[k] = m_sum[k] / m_count[k];
+            }
+        }
+    return result;
+    }
+
+pybind11::object ComputeStructureFactor::getStructureFactorPython()
+    {
+    std::vector<double> result = getStructureFactor();
+    return pybind11::array_t<double>(result.size(), result.data());
+    }
+
+pybind11::object ComputeStructureFactor::getBinCentersPython()
+    {
+    std::vector<double> centers(m_bins);
+    const double dq = double(m_q_max) / m_bins;
+    for (unsigned int k = 0; k < m_bins; k++)
+        {
+        centers[k] = (k + 0.5) * dq;
+        }
+    return pybind11::array_t<double>(centers.size(), centers.data());
+    }
+
+/*! \param name Name of the loggable quantity in Python
+
+    Provides structure_factor. Sampling adds the current timestep and returns the running average.
+*/
+LogQuantity ComputeStructureFactor::getLogQuantity(const std::string& name)
+    {
+    LogQuantity quantity;
+    if (name == "structure_factor")
+        {
+        quantity.size = m_bins;
+        quantity.sample = [this](uint64_t timestep, double* values)
+        {
+            compute(timestep);
+            std::vector<double> result = getStructureFactor();
+            std::copy(result.begin(), result.end(), values);
+        };
+        }
+    return quantity;
+    }
+
+namespace detail
+    {
+void export_ComputeStructureFactor(pybind11::module& m)
+    {
+    pybind11::class_<ComputeStructureFactor, Compute, std::shared_ptr<ComputeStructureFactor>>(
+        m,
+        "ComputeStructureFactor")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            unsigned int,
+                            Scalar,
+                            unsigned int>())
+        .def("reset", &ComputeStructureFactor::reset)
+        .def_property_readonly("mesh", &ComputeStructureFactor::getMesh)
+        .def_property_readonly("q_max", &ComputeStructureFactor::getQMax)
+        .def_property_readonly("bins", &ComputeStructureFactor::getBins)
+        .def_property_readonly("num_frames", &ComputeStructureFactor::getNumFrames)
+        .def_property_readonly("structure_factor",
+                               &ComputeStructureFactor::getStructureFactorPython)
+        .def_property_readonly("bin_centers", &ComputeStructureFactor::getBinCentersPython);
+    }
+
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
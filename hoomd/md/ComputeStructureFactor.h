@@ -0,0 +1,123 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ComputeStructureFactor.h
+    \brief Declares the ComputeStructureFactor class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#pragma once
+
+#include "hoomd/Compute.h"
+#include "hoomd/extern/kiss_fftnd.h"
+
+#include <memory>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+namespace md
+    {
+/// Accumulate the static structure factor in situ
+/** ComputeStructureFactor evaluates S(q) = |rho(q)|^2 / N on the reciprocal lattice of the
+    simulation box. Like PPPMForceCompute, it assigns the particles to a mesh with a cloud-in-cell
+    scheme and transforms the mesh with KISS FFT. Dividing by the squared assignment window removes
+    the smoothing of the mesh. The modes are averaged in spherical shells of |q| up to q_max and the
+    shell averages accumulate over every timestep the compute runs.
+
+    In MPI simulations, each rank assigns its own particles to the global mesh and the meshes are
+    summed over the ranks. The root rank transforms the mesh and broadcasts the shell averages.
+
+    Modes near the Nyquist frequency pi * mesh / L are aliased, so q_max should be well below it.
+
+    \ingroup computes
+*/
+class PYBIND11_EXPORT ComputeStructureFactor : public Compute
+    {
+    public:
+    /// Constructor
+    ComputeStructureFactor(std::shared_ptr<SystemDefinition> sysdef,
+                           unsigned int mesh,
+                           Scalar q_max,
+                           unsigned int bins);
+
+    /// Destructor
+    virtual ~ComputeStructureFactor();
+
+    /// Add the structure factor of the current configuration
+    virtual void compute(uint64_t timestep);
+
+    /// Discard the accumulated shell averages
+    void reset();
+
+    /// Get the number of mesh points along each box vector
+    unsigned int getMesh()
+        {
+        return m_mesh;
+        }
+
+    /// Get the largest wave vector magnitude
+    Scalar getQMax()
+        {
+        return m_q_max;
+        }
+
+    /// Get the number of bins
+    unsigned int getBins()
+        {
+        return m_bins;
+        }
+
+    /// Get the number of accumulated timesteps
+    uint64_t getNumFrames()
+        {
+        return m_n_frames;
+        }
+
+    /// Get the average S(q) in each bin
+    std::vector<double> getStructureFactor();
+
+    /// Get the average S(q) for Python
+    pybind11::object getStructureFactorPython();
+
+    /// Get the bin centers for Python
+    pybind11::object getBinCentersPython();
+
+    /// Provide structure_factor to the native logger
+    virtual LogQuantity getLogQuantity(const std::string& name);
+
+    protected:
+    /// Assign the local particles to the density mesh
+    void assignParticles(std::vector<double>& density);
+
+    /// Transform the density and add the modes to the shell sums
+    void binModes(const std::vector<double>& density,
+                  std::vector<double>& sum,
+                  std::vector<double>& count);
+
+    unsigned int m_mesh; //!< Number of mesh points along each box vector
+    Scalar m_q_max;      //!< Largest wave vector magnitude
+    unsigned int m_bins; //!< Number of bins
+
+    kiss_fftnd_cfg m_kiss_fft = NULL; //!< The FFT configuration
+    unsigned int m_mesh_z = 0;        //!< Mesh points along the third box vector in m_kiss_fft
+
+    std::vector<double> m_sum;   //!< Accumulated sum of S(q) over the modes in each bin
+    std::vector<double> m_count; //!< Accumulated number of modes in each bin
+    uint64_t m_n_frames = 0;     //!< Number of accumulated timesteps
+    };
+
+namespace detail
+    {
+/// Export ComputeStructureFactor to Python
+void export_ComputeStructureFactor(pybind11::module& m);
+
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
@@ -14,6 +14,7 @@
 #endif
 
 #include <iostream>
+#include <map>
 using namespace std;
 
 namespace hoomd
@@ -310,6 +311,59 @@ void ComputeThermo::reduceProperties()
     }
 #endif
 
+/*! \param name Name of the loggable quantity in Python
+
+    Provides all loggable quantities of hoomd.md.compute.ThermodynamicQuantities. Sampling computes
+    the properties once per timestep and reduces them over the ranks in a single call.
+*/
+LogQuantity ComputeThermo::getLogQuantity(const std::string& name)
+    {
+    static const std::map<std::string, std::function<double(ComputeThermo&)>> scalars = {
+        {"kinetic_temperature", [](ComputeThermo& c) { return c.getTemperature(); }},
+        {"pressure", [](ComputeThermo& c) { return c.getPressure(); }},
+        {"kinetic_energy", [](ComputeThermo& c) { return c.getKineticEnergy(); }},
+        {"translational_kinetic_energy",
+         [](ComputeThermo& c) { return c.getTranslationalKineticEnergy(); }},
+        {"rotational_kinetic_energy",
+         [](ComputeThermo& c) { return c.getRotationalKineticEnergy(); }},
+        {"potential_energy", [](ComputeThermo& c) { return c.getPotentialEnergy(); }},
+        {"degrees_of_freedom", [](ComputeThermo& c) { return c.getNDOF(); }},
+        {"translational_degrees_of_freedom",
+         [](ComputeThermo& c) { return c.getTranslationalDOF(); }},
+        {"rotational_degrees_of_freedom", [](ComputeThermo& c) { return c.getRotationalDOF(); }},
+        {"num_particles", [](ComputeThermo& c) { return double(c.getNumParticles()); }},
+        {"volume", [](ComputeThermo& c) { return c.getVolume(); }}};
+
+    LogQuantity quantity;
+    auto it = scalars.find(name);
+    if (it != scalars.end())
+        {
+        auto getter = it->second;
+        quantity.size = 1;
+        quantity.sample = [this, getter](uint64_t timestep, double* values)
+        {
+            compute(timestep);
+            values[0] = getter(*this);
+        };
+        }
+    else if (name == "pressure_tensor")
+        {
+        quantity.size = 6;
+        quantity.sample = [this](uint64_t timestep, double* values)
+        {
+            compute(timestep);
+            PressureTensor p = getPressureTensor();
+            values[0] = p.xx;
+            values[1] = p.xy;
+            values[2] = p.xz;
+            values[3] = p.yy;
+            values[4] = p.yz;
+            values[5] = p.zz;
+        };
+        }
+    return quantity;
+    }
+
 namespace detail
     {
 void export_ComputeThermo(pybind11::module& m)
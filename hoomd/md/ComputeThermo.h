@@ -329,6 +329,9 @@ class PYBIND11_EXPORT ComputeThermo : public Compute
         return m_sysdef->getParticleData()->getGlobalBox().getVolume(two_d);
         }
 
+    /// Get a quantity for the native logger
+    virtual LogQuantity getLogQuantity(const std::string& name);
+
     protected:
     std::shared_ptr<ParticleGroup> m_group; //!< Group to compute properties for
     GlobalArray<Scalar> m_properties;       //!< Stores the computed properties
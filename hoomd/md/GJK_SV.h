@@ -36,17 +36,25 @@ HOSTDEVICE inline void support_polyhedron(const ManagedArray<vec3<Scalar>>& vert
                                           const vec3<Scalar> shift,
                                           unsigned int& idx)
     {
-    // Compute the support function of the polyhedron.
-    unsigned int index = 0;
+    // Compute the support function of the polyhedron. The shift adds the same amount to every
+    // projection and dot(mat * v, vector) == dot(v, mat^T * vector), so rotate the direction into
+    // the body frame once instead of rotating every vertex.
+    const vec3<Scalar> body_vector(mat[0][0] * vector.x + mat[1][0] * vector.y
+                                       + mat[2][0] * vector.z,
+                                   mat[0][1] * vector.x + mat[1][1] * vector.y
+                                       + mat[2][1] * vector.z,
+                                   mat[0][2] * vector.x + mat[1][2] * vector.y
+                                       + mat[2][2] * vector.z);
 
-    Scalar max_dist_sq = dot((rotate(mat, verts[index]) + shift), vector);
+    unsigned int index = 0;
+    Scalar max_dist = dot(verts[0], body_vector);
     for (unsigned int i = 1; i < verts.size(); ++i)
         {
-        Scalar dist_sq = dot((rotate(mat, verts[i]) + shift), vector);
+        Scalar dist = dot(verts[i], body_vector);
 
-        if (dist_sq > max_dist_sq)
+        if (dist > max_dist)
             {
-            max_dist_sq = dist_sq;
+            max_dist = dist;
             index = i;
             }
         }
@@ -202,6 +202,12 @@ void MuellerPlatheFlow::updateDomainDecomposition(void)
     std::shared_ptr<DomainDecomposition> dec = m_pdata->getDomainDecomposition();
     if (dec)
         {
+        if (dec->isRecursiveBisection())
+            {
+            throw std::runtime_error(
+                "MuellerPlatheFlow does not support recursive bisection domains.");
+            }
+
         const Scalar min_frac = m_min_slab / static_cast<Scalar>(m_N_slabs);
         const Scalar max_frac = m_max_slab / static_cast<Scalar>(m_N_slabs);
 
@@ -0,0 +1,200 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file MultiTauCorrelator.cc
+    \brief Defines the MultiTauCorrelator class
+*/
+
+#include "MultiTauCorrelator.h"
+
+#ifdef ENABLE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param n Number of values in each sample
+    \param levels Number of levels
+    \param p Number of samples kept in each level
+    \param m Number of samples of one level per sample of the next
+    \param mode How to correlate two samples
+    \param compression How to pass samples to the next level
+*/
+MultiTauCorrelator::MultiTauCorrelator(unsigned int n,
+                                       unsigned int levels,
+                                       unsigned int p,
+                                       unsigned int m,
+                                       Mode mode,
+                                       Compression compression)
+    : m_n(n), m_p(p), m_m(m), m_mode(mode), m_compression(compression)
+    {
+    if (levels == 0)
+        {
+        throw std::domain_error("levels must be positive.");
+        }
+    if (m < 2)
+        {
+        throw std::domain_error("m must be at least 2.");
+        }
+    if (p < m || p % m != 0)
+        {
+        throw std::domain_error("p must be a positive multiple of m.");
+        }
+
+    m_levels.resize(levels);
+
+    // level 0 has the lags 0 to p-1, the higher levels add the lags j m^k for j = p/m to p-1
+    uint64_t spacing = 1;
+    for (unsigned int k = 0; k < levels; k++)
+        {
+        for (unsigned int j = (k == 0 ? 0 : p / m); j < p; j++)
+            {
+            m_lags.push_back(j * spacing);
+            }
+        spacing *= m;
+        }
+
+    reset();
+    }
+
+void MultiTauCorrelator::reset()
+    {
+    for (Level& level : m_levels)
+        {
+        level.buffer.assign(size_t(m_p) * m_n, 0.0);
+        level.accumulator.assign(m_n, 0.0);
+        level.head = 0;
+        level.n_samples = 0;
+        level.n_accumulated = 0;
+        }
+
+    m_sum.assign(m_lags.size(), 0.0);
+    m_count.assign(m_lags.size(), 0);
+    }
+
+/*! \param sample Array of getN() values
+ */
+void MultiTauCorrelator::add(const double* sample)
+    {
+    addToLevel(0, sample);
+    }
+
+/*! \param k Index of the level
+    \param sample Array of getN() values
+*/
+void MultiTauCorrelator::addToLevel(unsigned int k, const double* sample)
+    {
+    Level& level = m_levels[k];
+    double* slot = level.buffer.data() + size_t(level.head) * m_n;
+    std::copy(sample, sample + m_n, slot);
+    level.n_samples++;
+
+    correlate(k, slot);
+    level.head = (level.head + 1) % m_p;
+
+    if (k + 1 == m_levels.size())
+        return;
+
+    if (m_compression == Compression::subsample)
+        {
+        // level k+1 holds the samples 0, m, 2m, ... of level k
+        if ((level.n_samples - 1) % m_m == 0)
+            {
+            addToLevel(k + 1, slot);
+            }
+        }
+    else
+        {
+        for (unsigned int i = 0; i < m_n; i++)
+            {
+            level.accumulator[i] += slot[i];
+            }
+        level.n_accumulated++;
+
+        if (level.n_accumulated == m_m)
+            {
+            std::vector<double> average(m_n);
+            for (unsigned int i = 0; i < m_n; i++)
+                {
+                average[i] = level.accumulator[i] / m_m;
+                }
+            level.accumulator.assign(m_n, 0.0);
+            level.n_accumulated = 0;
+            addToLevel(k + 1, average.data());
+            }
+        }
+    }
+
+/*! \param k Index of the level
+    \param sample The newest sample of the level
+*/
+void MultiTauCorrelator::correlate(unsigned int k, const double* sample)
+    {
+    const Level& level = m_levels[k];
+    const unsigned int j_min = k == 0 ? 0 : m_p / m_m;
+    const unsigned int j_max = (unsigned int)std::min<uint64_t>(m_p, level.n_samples);
+    if (j_min >= j_max)
+        return;
+
+    const size_t offset = k == 0 ? 0 : m_p + size_t(k - 1) * (m_p - j_min);
+
+    auto correlate_lag = [&](unsigned int j)
+    {
+        const double* origin
+            = level.buffer.data() + size_t((level.head + m_p - j) % m_p) * m_n;
+
+        double sum = 0.0;
+        if (m_mode == Mode::product)
+            {
+            for (unsigned int i = 0; i < m_n; i++)
+                {
+                sum += origin[i] * sample[i];
+                }
+            }
+        else
+            {
+            for (unsigned int i = 0; i < m_n; i++)
+                {
+                const double delta = sample[i] - origin[i];
+                sum += delta * delta;
+                }
+            }
+
+        m_sum[offset + j - j_min] += sum;
+        m_count[offset + j - j_min]++;
+    };
+
+#ifdef ENABLE_TBB
+    if (m_task_arena)
+        {
+        m_task_arena->execute(
+            [&]
+            {
+                tbb::parallel_for(tbb::blocked_range<unsigned int>(j_min, j_max),
+                                  [&](const tbb::blocked_range<unsigned int>& r)
+                                  {
+                                      for (unsigned int j = r.begin(); j != r.end(); ++j)
+                                          {
+                                          correlate_lag(j);
+                                          }
+                                  });
+            });
+        return;
+        }
+#endif
+
+    for (unsigned int j = j_min; j < j_max; j++)
+        {
+        correlate_lag(j);
+        }
+    }
+
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,144 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file MultiTauCorrelator.h
+    \brief Declares the MultiTauCorrelator class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#pragma once
+
+#include "hoomd/ExecutionConfiguration.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace hoomd
+    {
+namespace md
+    {
+/// Accumulate time correlation functions with logarithmically spaced lags
+/** MultiTauCorrelator implements the multiple tau (block) correlator. Each sample is a vector of
+    n values. Level 0 keeps the last p samples and correlates each new sample with them at lags
+    0 to p-1. Every m samples, level k passes one sample to level k+1, so level k holds samples
+    spaced m^k apart and adds the lags j m^k for j = p/m to p-1. The memory and the work per
+    sample are O(L p n) for L levels, while the longest lag grows as p m^(L-1).
+
+    Level k+1 receives either the average of m consecutive samples of level k (Compression::average,
+    which smooths fluctuating signals such as the stress) or every m-th sample of level k
+    (Compression::subsample, which keeps the correlation of quantities such as positions exact).
+
+    The correlation at each lag is the sum over the n values of a(t) b(t + tau) (Mode::product) or
+    (b(t + tau) - a(t))^2 (Mode::squared_difference), accumulated over all time origins. getSum()
+    and getCount() return the sums and the number of time origins. The caller normalizes them.
+
+    \note When TBB is enabled, the lags of a level are correlated in parallel.
+*/
+class PYBIND11_EXPORT MultiTauCorrelator
+    {
+    public:
+    /// How to correlate two samples
+    enum class Mode
+        {
+        product,
+        squared_difference
+        };
+
+    /// How to pass samples to the next level
+    enum class Compression
+        {
+        average,
+        subsample
+        };
+
+    /// Constructor
+    MultiTauCorrelator(unsigned int n,
+                       unsigned int levels,
+                       unsigned int p,
+                       unsigned int m,
+                       Mode mode,
+                       Compression compression);
+
+    /// Add the next sample
+    void add(const double* sample);
+
+    /// Discard all samples and sums
+    void reset();
+
+    /// Get the number of values in each sample
+    unsigned int getN() const
+        {
+        return m_n;
+        }
+
+    /// Get the number of lags
+    unsigned int getNumLags() const
+        {
+        return (unsigned int)m_lags.size();
+        }
+
+    /// Get the lags in units of the sample period
+    const std::vector<uint64_t>& getLags() const
+        {
+        return m_lags;
+        }
+
+    /// Get the sum of the correlations at each lag
+    const std::vector<double>& getSum() const
+        {
+        return m_sum;
+        }
+
+    /// Get the number of time origins at each lag
+    const std::vector<uint64_t>& getCount() const
+        {
+        return m_count;
+        }
+
+#ifdef ENABLE_TBB
+    /// Set the task arena to run the correlation in
+    void setTaskArena(std::shared_ptr<tbb::task_arena> task_arena)
+        {
+        m_task_arena = task_arena;
+        }
+#endif
+
+    protected:
+    /// State of one level
+    struct Level
+        {
+        std::vector<double> buffer;      //!< Last p samples (ring buffer of p * n values)
+        std::vector<double> accumulator; //!< Sum of the samples to pass to the next level
+        unsigned int head = 0;           //!< Position of the next sample in the buffer
+        uint64_t n_samples = 0;          //!< Number of samples added to this level
+        unsigned int n_accumulated = 0;  //!< Number of samples in the accumulator
+        };
+
+    /// Add a sample to the given level
+    void addToLevel(unsigned int k, const double* sample);
+
+    /// Correlate the newest sample of a level with the older ones
+    void correlate(unsigned int k, const double* sample);
+
+    unsigned int m_n;          //!< Number of values in each sample
+    unsigned int m_p;          //!< Number of samples kept in each level
+    unsigned int m_m;          //!< Number of samples of one level per sample of the next
+    Mode m_mode;               //!< How to correlate two samples
+    Compression m_compression; //!< How to pass samples to the next level
+
+    std::vector<Level> m_levels;    //!< State of each level
+    std::vector<uint64_t> m_lags;   //!< Lag of each correlation in units of the sample period
+    std::vector<double> m_sum;      //!< Sum of the correlations at each lag
+    std::vector<uint64_t> m_count;  //!< Number of time origins at each lag
+
+#ifdef ENABLE_TBB
+    std::shared_ptr<tbb::task_arena> m_task_arena; //!< Task arena to correlate in (may be null)
+#endif
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
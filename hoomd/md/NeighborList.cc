@@ -279,6 +279,51 @@ NeighborList::NeighborList(std::shared_ptr<SystemDefinition> sysdef, Scalar r_bu
             .connect<NeighborList, &NeighborList::getGhostLayerWidth>(this);
         }
 #endif
+
+    registerMemory();
+    }
+
+/*! The per-particle arrays hold data for the local particles and the neighbor list holds the
+    elements requested by the last build. The remaining elements are slack from amortized resizing.
+*/
+void NeighborList::registerMemory()
+    {
+    MemoryRegistry* registry = m_exec_conf->getMemoryRegistry();
+    registry->addObject(this, [this]() { trimMemory(); });
+
+    auto n_rows = [this]() { return size_t(m_pdata->getN()); };
+    registry->addArray(this, m_nlist, [this]() { return m_nlist_size; });
+    registry->addArray(this, m_n_neigh, n_rows);
+    registry->addArray(this, m_last_pos, n_rows);
+    registry->addArray(this, m_head_list, n_rows);
+    registry->addArray(this, m_n_ex_idx, n_rows);
+    registry->addArray(this,
+                       m_ex_list_idx,
+                       [this]() { return size_t(m_pdata->getN()) * m_ex_list_indexer.getH(); });
+    registry->addArray(this, m_ex_list_tag);
+    registry->addVector(this, m_n_ex_tag);
+    registry->addArray(this, m_r_cut);
+    registry->addArray(this, m_r_listsq);
+    registry->addArray(this, m_rcut_max);
+    registry->addArray(this, m_rcut_base);
+    registry->addArray(this, m_Nmax);
+    registry->addArray(this, m_conditions);
+    }
+
+/*! The neighbor list grows again by amortized resizing when a later build needs more elements.
+ */
+void NeighborList::trimMemory()
+    {
+    size_t size = m_nlist_size > 4 ? (m_nlist_size + 3) & ~size_t(3) : 4;
+    if (size < m_nlist.getNumElements())
+        {
+        m_exec_conf->msg->notice(6) << "nlist: Trimming neighbor list to " << size << " uints"
+                                    << endl;
+        m_nlist.resize(size);
+#ifdef ENABLE_HIP
+        updateMemoryMapping();
+#endif
+        }
     }
 
 void NeighborList::reallocate()
@@ -312,6 +357,7 @@ void NeighborList::reallocate()
 NeighborList::~NeighborList()
     {
     m_exec_conf->msg->notice(5) << "Destroying Neighborlist" << endl;
+    m_exec_conf->getMemoryRegistry()->removeObject(this);
 
     m_pdata->getParticleSortSignal().disconnect<NeighborList, &NeighborList::forceUpdate>(this);
     m_pdata->getMaxParticleNumberChangeSignal().disconnect<NeighborList, &NeighborList::reallocate>(
@@ -379,6 +425,8 @@ void NeighborList::compute(uint64_t timestep)
     if (!shouldCompute(timestep) && !m_force_update)
         return;
 
+    ScopedProfile profile(m_exec_conf->getProfiler(), *this);
+
     // when the number of particles or bonds in the system changes, rebuild the exclusion list
     if (m_n_particles_changed || m_topology_changed)
         {
@@ -1572,6 +1620,8 @@ void NeighborList::buildHeadList()
  */
 void NeighborList::resizeNlist(size_t size)
     {
+    m_nlist_size = size;
+
     if (size > m_nlist.getNumElements())
         {
         m_exec_conf->msg->notice(6)
@@ -441,6 +441,14 @@ class PYBIND11_EXPORT NeighborList : public Compute
         return m_typpair_idx;
         }
 
+    /// Get the cutoff of each type pair (index with getTypePairIndexer())
+    const GlobalArray<Scalar>& getRCutMatrix()
+        {
+        if (m_rcut_changed)
+            updateRList();
+        return m_r_cut;
+        }
+
     unsigned int getN() const
         {
         return m_pdata->getN();
@@ -486,6 +494,7 @@ class PYBIND11_EXPORT NeighborList : public Compute
     storageMode m_storage_mode; //!< The storage mode
 
     GlobalArray<unsigned int> m_nlist;   //!< Neighbor list data
+    size_t m_nlist_size = 0;             //!< Number of elements requested by the last build
     GlobalArray<unsigned int> m_n_neigh; //!< Number of neighbors for each particle
     GlobalArray<Scalar4> m_last_pos;     //!< coordinates of last updated particle positions
     Scalar3 m_last_L;                    //!< Box lengths at last update
@@ -548,6 +557,12 @@ class PYBIND11_EXPORT NeighborList : public Compute
     //! Amortized resizing of the neighborlist
     void resizeNlist(size_t size);
 
+    /// Register the neighbor list arrays with the memory registry
+    void registerMemory();
+
+    /// Shrink the neighbor list to the elements requested by the last build
+    void trimMemory();
+
 #ifdef ENABLE_MPI
     CommFlags getRequestedCommFlags(uint64_t timestep)
         {
@@ -1,6 +1,7 @@
 // Copyright (c) 2009-2024 The Regents of the University of Michigan.
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
+#include "BondedGroupGather.h"
 #include "hoomd/ForceCompute.h"
 #include "hoomd/GPUArray.h"
 #include "hoomd/MeshDefinition.h"
@@ -162,6 +163,9 @@ pybind11::dict PotentialBond<evaluator, Bonds>::getParams(std::string type)
 
 /*! Actually perform the force computation
     \param timestep Current time step
+
+    Each local particle gathers the forces of the bonds it belongs to from the particle-centric
+    bond table, so the particles are processed in parallel without write conflicts.
  */
 template<class evaluator, class Bonds>
 void PotentialBond<evaluator, Bonds>::computeForces(uint64_t timestep)
@@ -170,7 +174,6 @@ void PotentialBond<evaluator, Bonds>::computeForces(uint64_t timestep)
 
     // access the particle data arrays
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
-    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
     ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
 
     ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::readwrite);
@@ -197,121 +200,81 @@ void PotentialBond<evaluator, Bonds>::computeForces(uint64_t timestep)
     PDataFlags flags = this->m_pdata->getFlags();
     bool compute_virial = flags[pdata_flag::pressure_tensor];
 
-    Scalar bond_virial[6];
-    for (unsigned int i = 0; i < 6; i++)
-        bond_virial[i] = Scalar(0.0);
-
-    ArrayHandle<typename Bonds::members_t> h_bonds(m_bond_data->getMembersArray(),
-                                                   access_location::host,
-                                                   access_mode::read);
-    ArrayHandle<typeval_t> h_typeval(m_bond_data->getTypeValArray(),
-                                     access_location::host,
-                                     access_mode::read);
-
-    unsigned int max_local = m_pdata->getN() + m_pdata->getNGhosts();
+    const size_t virial_pitch = m_virial_pitch;
 
-    // for each of the bonds
-    const unsigned int size = (unsigned int)m_bond_data->getN();
-
-    for (unsigned int i = 0; i < size; i++)
+    detail::gatherBondedGroups(
+        *m_exec_conf,
+        *m_bond_data,
+        m_pdata->getN(),
+        [&](unsigned int idx, const unsigned int* members, unsigned int pos, unsigned int type)
         {
-        // lookup the tag of each of the particles participating in the bond
-        const typename Bonds::members_t& bond = h_bonds.data[i];
-        assert(bond.tag[0] < m_pdata->getMaximumTag() + 1);
-        assert(bond.tag[1] < m_pdata->getMaximumTag() + 1);
-
-        // transform a and b into indices into the particle data arrays
-        // (MEM TRANSFER: 4 integers)
-        unsigned int idx_a = h_rtag.data[bond.tag[0]];
-        unsigned int idx_b = h_rtag.data[bond.tag[1]];
-
-        // throw an error if this bond is incomplete
-        if (idx_a >= max_local || idx_b >= max_local)
-            {
-            std::ostringstream stream;
-            stream << "Error: bond " << bond.tag[0] << " " << bond.tag[1] << " is incomplete.";
-            throw std::runtime_error(stream.str());
-            }
-
-        // calculate d\vec{r}
-        // (MEM TRANSFER: 6 Scalars / FLOPS: 3)
-        Scalar3 posa = make_scalar3(h_pos.data[idx_a].x, h_pos.data[idx_a].y, h_pos.data[idx_a].z);
-        Scalar3 posb = make_scalar3(h_pos.data[idx_b].x, h_pos.data[idx_b].y, h_pos.data[idx_b].z);
-
-        Scalar3 dx = posb - posa;
-
-        // access charge (if needed)
-        Scalar charge_a = Scalar(0.0);
-        Scalar charge_b = Scalar(0.0);
-        if (evaluator::needsCharge())
-            {
-            charge_a = h_charge.data[idx_a];
-            charge_b = h_charge.data[idx_b];
-            }
-
-        // if the vector crosses the box, pull it back
-        dx = box.minImage(dx);
-
-        // calculate r_ab squared
-        Scalar rsq = dot(dx, dx);
-
-        // compute the force and potential energy
-        Scalar force_divr = Scalar(0.0);
-        Scalar bond_eng = Scalar(0.0);
-        evaluator eval(rsq, h_params.data[h_typeval.data[i].type]);
-        if (evaluator::needsCharge())
-            eval.setCharge(charge_a, charge_b);
-
-        bool evaluated = eval.evalForceAndEnergy(force_divr, bond_eng);
-
-        // Bond energy must be halved
-        bond_eng *= Scalar(0.5);
-
-        if (evaluated)
-            {
-            // calculate virial
-            if (compute_virial)
+            // mesh bonds also list the particles of the adjacent triangles
+            if (pos > 1)
+                return;
+
+            unsigned int idx_a = members[0];
+            unsigned int idx_b = members[1];
+
+            // calculate d\vec{r}
+            // (MEM TRANSFER: 6 Scalars / FLOPS: 3)
+            Scalar3 posa
+                = make_scalar3(h_pos.data[idx_a].x, h_pos.data[idx_a].y, h_pos.data[idx_a].z);
+            Scalar3 posb
+                = make_scalar3(h_pos.data[idx_b].x, h_pos.data[idx_b].y, h_pos.data[idx_b].z);
+
+            Scalar3 dx = posb - posa;
+
+            // access charge (if needed)
+            Scalar charge_a = Scalar(0.0);
+            Scalar charge_b = Scalar(0.0);
+            if (evaluator::needsCharge())
                 {
-                Scalar force_div2r = Scalar(1.0 / 2.0) * force_divr;
-                bond_virial[0] = dx.x * dx.x * force_div2r; // xx
-                bond_virial[1] = dx.x * dx.y * force_div2r; // xy
-                bond_virial[2] = dx.x * dx.z * force_div2r; // xz
-                bond_virial[3] = dx.y * dx.y * force_div2r; // yy
-                bond_virial[4] = dx.y * dx.z * force_div2r; // yz
-                bond_virial[5] = dx.z * dx.z * force_div2r; // zz
+                charge_a = h_charge.data[idx_a];
+                charge_b = h_charge.data[idx_b];
                 }
 
-            // add the force to the particles (only for non-ghost particles)
-            if (idx_b < m_pdata->getN())
+            // if the vector crosses the box, pull it back
+            dx = box.minImage(dx);
+
+            // calculate r_ab squared
+            Scalar rsq = dot(dx, dx);
+
+            // compute the force and potential energy
+            Scalar force_divr = Scalar(0.0);
+            Scalar bond_eng = Scalar(0.0);
+            evaluator eval(rsq, h_params.data[type]);
+            if (evaluator::needsCharge())
+                eval.setCharge(charge_a, charge_b);
+
+            bool evaluated = eval.evalForceAndEnergy(force_divr, bond_eng);
+
+            if (!evaluated)
                 {
-                h_force.data[idx_b].x += force_divr * dx.x;
-                h_force.data[idx_b].y += force_divr * dx.y;
-                h_force.data[idx_b].z += force_divr * dx.z;
-                h_force.data[idx_b].w += bond_eng;
-                if (compute_virial)
-                    for (unsigned int i = 0; i < 6; i++)
-                        h_virial.data[i * m_virial_pitch + idx_b] += bond_virial[i];
+                throw std::runtime_error(std::string("bond.") + evaluator::getName()
+                                         + ": bond out of bounds");
                 }
 
-            if (idx_a < m_pdata->getN())
+            // the force on b is along dx, the force on a is opposite
+            Scalar sign = (pos == 1) ? Scalar(1.0) : Scalar(-1.0);
+
+            // add the force on this particle, the bond energy is split between both particles
+            h_force.data[idx].x += sign * force_divr * dx.x;
+            h_force.data[idx].y += sign * force_divr * dx.y;
+            h_force.data[idx].z += sign * force_divr * dx.z;
+            h_force.data[idx].w += bond_eng * Scalar(0.5);
+
+            // calculate virial
+            if (compute_virial)
                 {
-                h_force.data[idx_a].x -= force_divr * dx.x;
-                h_force.data[idx_a].y -= force_divr * dx.y;
-                h_force.data[idx_a].z -= force_divr * dx.z;
-                h_force.data[idx_a].w += bond_eng;
-                if (compute_virial)
-                    for (unsigned int i = 0; i < 6; i++)
-                        h_virial.data[i * m_virial_pitch + idx_a] += bond_virial[i];
+                Scalar force_div2r = Scalar(1.0 / 2.0) * force_divr;
+                h_virial.data[0 * virial_pitch + idx] += dx.x * dx.x * force_div2r; // xx
+                h_virial.data[1 * virial_pitch + idx] += dx.x * dx.y * force_div2r; // xy
+                h_virial.data[2 * virial_pitch + idx] += dx.x * dx.z * force_div2r; // xz
+                h_virial.data[3 * virial_pitch + idx] += dx.y * dx.y * force_div2r; // yy
+                h_virial.data[4 * virial_pitch + idx] += dx.y * dx.z * force_div2r; // yz
+                h_virial.data[5 * virial_pitch + idx] += dx.z * dx.z * force_div2r; // zz
                 }
-            }
-        else
-            {
-            this->m_exec_conf->msg->error()
-                << "bond." << evaluator::getName() << ": bond out of bounds" << std::endl
-                << std::endl;
-            throw std::runtime_error("Error in bond calculation");
-            }
-        }
+        });
     }
 
 #ifdef ENABLE_MPI
@@ -0,0 +1,399 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file TimeCorrelationAnalyzer.cc
+    \brief Defines the TimeCorrelationAnalyzer class
+*/
+
+#include "TimeCorrelationAnalyzer.h"
+
+#ifdef ENABLE_MPI
+#include "hoomd/HOOMDMPI.h"
+#endif
+
+#include <pybind11/numpy.h>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System definition
+    \param trigger Select the timesteps to sample
+    \param group Particles to correlate
+    \param thermo Pressure tensor source for the stress autocorrelation (may be null)
+    \param levels Number of correlator levels
+    \param p Number of samples kept in each level
+    \param m Number of samples of one level per sample of the next
+*/
+TimeCorrelationAnalyzer::TimeCorrelationAnalyzer(std::shared_ptr<SystemDefinition> sysdef,
+                                                 std::shared_ptr<Trigger> trigger,
+                                                 std::shared_ptr<ParticleGroup> group,
+                                                 std::shared_ptr<ComputeThermo> thermo,
+                                                 unsigned int levels,
+                                                 unsigned int p,
+                                                 unsigned int m)
+    : Analyzer(sysdef, trigger), m_group(group), m_thermo(thermo)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing TimeCorrelationAnalyzer" << endl;
+
+    unsigned int n_ranks = 1;
+    unsigned int rank = 0;
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        n_ranks = m_exec_conf->getNRanks();
+        rank = m_exec_conf->getRank();
+        }
+#endif
+
+    // the member tags are sorted, so m_tags is too
+    m_group->gatherMemberTags();
+    for (unsigned int i = 0; i < m_group->getNumMembersGlobal(); i++)
+        {
+        const unsigned int tag = m_group->getMemberTag(i);
+        if (tag % n_ranks == rank)
+            {
+            m_tags.push_back(tag);
+            }
+        }
+
+    const unsigned int n = 3 * (unsigned int)m_tags.size();
+    m_position = std::make_unique<MultiTauCorrelator>(n,
+                                                      levels,
+                                                      p,
+                                                      m,
+                                                      MultiTauCorrelator::Mode::squared_difference,
+                                                      MultiTauCorrelator::Compression::subsample);
+    m_velocity = std::make_unique<MultiTauCorrelator>(n,
+                                                      levels,
+                                                      p,
+                                                      m,
+                                                      MultiTauCorrelator::Mode::product,
+                                                      MultiTauCorrelator::Compression::subsample);
+#ifdef ENABLE_TBB
+    m_position->setTaskArena(m_exec_conf->getTaskArena());
+    m_velocity->setTaskArena(m_exec_conf->getTaskArena());
+#endif
+
+    if (m_thermo)
+        {
+        // only xy is an independent shear stress in 2D
+        const unsigned int n_stress = m_sysdef->getNDimensions() == 2 ? 1 : 3;
+        m_stress = std::make_unique<MultiTauCorrelator>(n_stress,
+                                                        levels,
+                                                        p,
+                                                        m,
+                                                        MultiTauCorrelator::Mode::product,
+                                                        MultiTauCorrelator::Compression::average);
+        }
+    }
+
+TimeCorrelationAnalyzer::~TimeCorrelationAnalyzer()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying TimeCorrelationAnalyzer" << endl;
+    }
+
+void TimeCorrelationAnalyzer::reset()
+    {
+    m_position->reset();
+    m_velocity->reset();
+    if (m_stress)
+        {
+        m_stress->reset();
+        }
+    m_n_samples = 0;
+    m_last_timestep = 0;
+    m_period = 0;
+    }
+
+/*! \param timestep Current time step of the simulation
+ */
+void TimeCorrelationAnalyzer::analyze(uint64_t timestep)
+    {
+    Analyzer::analyze(timestep);
+
+    if (m_n_samples == 1)
+        {
+        m_period = timestep - m_last_timestep;
+        }
+    else if (m_n_samples > 1 && timestep - m_last_timestep != m_period)
+        {
+        throw std::runtime_error("TimeCorrelation requires evenly spaced samples.");
+        }
+
+    std::vector<double> position, velocity;
+    collectSamples(position, velocity);
+    m_position->add(position.data());
+    m_velocity->add(velocity.data());
+
+    if (m_stress)
+        {
+        m_thermo->compute(timestep);
+        PressureTensor pressure = m_thermo->getPressureTensor();
+        double stress[3] = {pressure.xy, pressure.xz, pressure.yz};
+        m_stress->add(stress);
+        }
+
+    m_last_timestep = timestep;
+    m_n_samples++;
+    }
+
+/*! \param position Unwrapped positions of the particles in m_tags (output)
+    \param velocity Velocities of the particles in m_tags (output)
+*/
+void TimeCorrelationAnalyzer::collectSamples(std::vector<double>& position,
+                                             std::vector<double>& velocity)
+    {
+    // each record holds the tag, the unwrapped position, and the velocity of one particle
+    const unsigned int record_size = 7;
+    const unsigned int n_local = m_group->getNumMembers();
+
+    unsigned int n_ranks = 1;
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        n_ranks = m_exec_conf->getNRanks();
+        }
+#endif
+
+    std::vector<double> records(size_t(n_local) * record_size);
+    std::vector<int> send_counts(n_ranks, 0);
+    std::vector<int> send_displs(n_ranks, 0);
+
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+        ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
+                                   access_location::host,
+                                   access_mode::read);
+        ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_tag(m_pdata->getTags(),
+                                        access_location::host,
+                                        access_mode::read);
+        const BoxDim& global_box = m_pdata->getGlobalBox();
+
+        // group the records by the rank that correlates the particle
+        for (unsigned int i = 0; i < n_local; i++)
+            {
+            send_counts[h_tag.data[m_group->getMemberIndex(i)] % n_ranks] += record_size;
+            }
+        for (unsigned int r = 1; r < n_ranks; r++)
+            {
+            send_displs[r] = send_displs[r - 1] + send_counts[r - 1];
+            }
+
+        std::vector<int> offset(send_displs);
+        for (unsigned int i = 0; i < n_local; i++)
+            {
+            const unsigned int idx = m_group->getMemberIndex(i);
+            const unsigned int tag = h_tag.data[idx];
+            Scalar3 pos = global_box.shift(
+                make_scalar3(h_pos.data[idx].x, h_pos.data[idx].y, h_pos.data[idx].z),
+                h_image.data[idx]);
+
+            double* record = records.data() + offset[tag % n_ranks];
+            record[0] = tag;
+            record[1] = pos.x;
+            record[2] = pos.y;
+            record[3] = pos.z;
+            record[4] = h_vel.data[idx].x;
+            record[5] = h_vel.data[idx].y;
+            record[6] = h_vel.data[idx].z;
+            offset[tag % n_ranks] += record_size;
+            }
+        }
+
+#ifdef ENABLE_MPI
+    if (n_ranks > 1)
+        {
+        std::vector<int> recv_counts(n_ranks);
+        std::vector<int> recv_displs(n_ranks, 0);
+        MPI_Alltoall(send_counts.data(),
+                     1,
+                     MPI_INT,
+                     recv_counts.data(),
+                     1,
+                     MPI_INT,
+                     m_exec_conf->getMPICommunicator());
+        for (unsigned int r = 1; r < n_ranks; r++)
+            {
+            recv_displs[r] = recv_displs[r - 1] + recv_counts[r - 1];
+            }
+
+        std::vector<double> received(size_t(recv_displs[n_ranks - 1])
+                                     + recv_counts[n_ranks - 1]);
+        MPI_Alltoallv(records.data(),
+                      send_counts.data(),
+                      send_displs.data(),
+                      MPI_DOUBLE,
+                      received.data(),
+                      recv_counts.data(),
+                      recv_displs.data(),
+                      MPI_DOUBLE,
+                      m_exec_conf->getMPICommunicator());
+        records.swap(received);
+        }
+#endif
+
+    const size_t n_records = records.size() / record_size;
+    if (n_records != m_tags.size())
+        {
+        throw std::runtime_error("The TimeCorrelation group changed during the run.");
+        }
+
+    position.resize(3 * m_tags.size());
+    velocity.resize(3 * m_tags.size());
+    for (size_t i = 0; i < n_records; i++)
+        {
+        const double* record = records.data() + i * record_size;
+        const unsigned int tag = (unsigned int)record[0];
+        auto it = std::lower_bound(m_tags.begin(), m_tags.end(), tag);
+        if (it == m_tags.end() || *it != tag)
+            {
+            throw std::runtime_error("The TimeCorrelation group changed during the run.");
+            }
+
+        const size_t slot = it - m_tags.begin();
+        std::copy(record + 1, record + 4, position.data() + 3 * slot);
+        std::copy(record + 4, record + 7, velocity.data() + 3 * slot);
+        }
+    }
+
+/*! \param correlator Correlator to normalize
+    \param n_values Number of values summed in each correlation over all ranks
+    \param reduce Set to true to sum the correlations over the MPI ranks
+    \returns The average correlation at each lag, NaN at lags without samples
+*/
+std::vector<double> TimeCorrelationAnalyzer::normalize(const MultiTauCorrelator& correlator,
+                                                       double n_values,
+                                                       bool reduce)
+    {
+    std::vector<double> result(correlator.getSum());
+
+#ifdef ENABLE_MPI
+    if (reduce && m_sysdef->isDomainDecomposed())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      result.data(),
+                      (int)result.size(),
+                      MPI_DOUBLE,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    // every rank adds every sample, so the counts agree on all ranks
+    const std::vector<uint64_t>& count = correlator.getCount();
+    for (size_t i = 0; i < result.size(); i++)
+        {
+        if (count[i] > 0 && n_values > 0)
+            {
+            result[i] /= double(count[i]) * n_values;
+            }
+        else
+            {
+            result[i] = std::numeric_limits<double>::quiet_NaN();
+            }
+        }
+    return result;
+    }
+
+/*! \returns The lags in timesteps. The lags are 0 before the second sample.
+ */
+std::vector<double> TimeCorrelationAnalyzer::getLagTimes()
+    {
+    const std::vector<uint64_t>& lags = m_position->getLags();
+    std::vector<double> result(lags.size());
+    for (size_t i = 0; i < lags.size(); i++)
+        {
+        result[i] = double(lags[i] * m_period);
+        }
+    return result;
+    }
+
+/*! \returns <|r(t + tau) - r(t)|^2> averaged over the particles and time origins
+ */
+std::vector<double> TimeCorrelationAnalyzer::getMSD()
+    {
+    return normalize(*m_position, m_group->getNumMembersGlobal(), true);
+    }
+
+/*! \returns <v(t) . v(t + tau)> averaged over the particles and time origins
+ */
+std::vector<double> TimeCorrelationAnalyzer::getVACF()
+    {
+    return normalize(*m_velocity, m_group->getNumMembersGlobal(), true);
+    }
+
+/*! \returns <P_ab(t) P_ab(t + tau)> averaged over the off-diagonal elements and time origins, NaN
+    without a ComputeThermo
+*/
+std::vector<double> TimeCorrelationAnalyzer::getStressACF()
+    {
+    if (!m_stress)
+        {
+        return std::vector<double>(m_position->getNumLags(),
+                                   std::numeric_limits<double>::quiet_NaN());
+        }
+
+    // all ranks correlate the same global pressure tensor
+    return normalize(*m_stress, m_stress->getN(), false);
+    }
+
+pybind11::object TimeCorrelationAnalyzer::getLagTimesPython()
+    {
+    std::vector<double> result = getLagTimes();
+    return pybind11::array_t<double>(result.size(), result.data());
+    }
+
+pybind11::object TimeCorrelationAnalyzer::getMSDPython()
+    {
+    std::vector<double> result = getMSD();
+    return pybind11::array_t<double>(result.size(), result.data());
+    }
+
+pybind11::object TimeCorrelationAnalyzer::getVACFPython()
+    {
+    std::vector<double> result = getVACF();
+    return pybind11::array_t<double>(result.size(), result.data());
+    }
+
+pybind11::object TimeCorrelationAnalyzer::getStressACFPython()
+    {
+    std::vector<double> result = getStressACF();
+    return pybind11::array_t<double>(result.size(), result.data());
+    }
+
+namespace detail
+    {
+void export_TimeCorrelationAnalyzer(pybind11::module& m)
+    {
+    pybind11::class_<TimeCorrelationAnalyzer, Analyzer, std::shared_ptr<TimeCorrelationAnalyzer>>(
+        m,
+        "TimeCorrelationAnalyzer")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            std::shared_ptr<ParticleGroup>,
+                            std::shared_ptr<ComputeThermo>,
+                            unsigned int,
+                            unsigned int,
+                            unsigned int>())
+        .def("reset", &TimeCorrelationAnalyzer::reset)
+        .def_property_readonly("num_samples", &TimeCorrelationAnalyzer::getNumSamples)
+        .def_property_readonly("lag_times", &TimeCorrelationAnalyzer::getLagTimesPython)
+        .def_property_readonly("msd", &TimeCorrelationAnalyzer::getMSDPython)
+        .def_property_readonly("vacf", &TimeCorrelationAnalyzer::getVACFPython)
+        .def_property_readonly("stress_acf", &TimeCorrelationAnalyzer::getStressACFPython);
+    }
+
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,139 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file TimeCorrelationAnalyzer.h
+    \brief Declares the TimeCorrelationAnalyzer class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#pragma once
+
+#include "ComputeThermo.h"
+#include "MultiTauCorrelator.h"
+
+#include "hoomd/Analyzer.h"
+#include "hoomd/ParticleGroup.h"
+
+#include <memory>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+namespace md
+    {
+/// Accumulate the mean squared displacement and time correlation functions in situ
+/** TimeCorrelationAnalyzer samples the unwrapped positions and the velocities of the particles in
+    a group and, when given a ComputeThermo, the off-diagonal elements of the pressure tensor. It
+    feeds the samples to multiple tau correlators (see MultiTauCorrelator) that accumulate the mean
+    squared displacement, the velocity autocorrelation function, and the stress autocorrelation
+    function at logarithmically spaced lags over the whole run.
+
+    Positions and velocities pass to the higher levels by subsampling, so the mean squared
+    displacement and the velocity autocorrelation are exact at every lag. The stress passes to
+    the higher levels by block averaging.
+
+    In MPI simulations, the samples of each particle must stay in the same correlator while the
+    particles migrate. Each rank therefore correlates the particles with tag % N_ranks equal to its
+    rank, and every sample sends the positions and velocities to those ranks. The group must not
+    change during the run.
+
+    The trigger must select evenly spaced timesteps.
+
+    \ingroup analyzers
+*/
+class PYBIND11_EXPORT TimeCorrelationAnalyzer : public Analyzer
+    {
+    public:
+    /// Constructor
+    TimeCorrelationAnalyzer(std::shared_ptr<SystemDefinition> sysdef,
+                            std::shared_ptr<Trigger> trigger,
+                            std::shared_ptr<ParticleGroup> group,
+                            std::shared_ptr<ComputeThermo> thermo,
+                            unsigned int levels,
+                            unsigned int p,
+                            unsigned int m);
+
+    /// Destructor
+    virtual ~TimeCorrelationAnalyzer();
+
+    /// Add the current configuration to the correlators
+    virtual void analyze(uint64_t timestep);
+
+    /// Discard all samples
+    void reset();
+
+    /// Request the pressure tensor for the stress autocorrelation
+    virtual PDataFlags getRequestedPDataFlags()
+        {
+        PDataFlags flags;
+        if (m_thermo)
+            {
+            flags[pdata_flag::pressure_tensor] = 1;
+            }
+        return flags;
+        }
+
+    /// Get the number of samples
+    uint64_t getNumSamples()
+        {
+        return m_n_samples;
+        }
+
+    /// Get the lag times in units of timesteps
+    std::vector<double> getLagTimes();
+
+    /// Get the mean squared displacement at each lag
+    std::vector<double> getMSD();
+
+    /// Get the velocity autocorrelation function at each lag
+    std::vector<double> getVACF();
+
+    /// Get the stress autocorrelation function at each lag
+    std::vector<double> getStressACF();
+
+    /// Get the lag times for Python
+    pybind11::object getLagTimesPython();
+
+    /// Get the mean squared displacement for Python
+    pybind11::object getMSDPython();
+
+    /// Get the velocity autocorrelation function for Python
+    pybind11::object getVACFPython();
+
+    /// Get the stress autocorrelation function for Python
+    pybind11::object getStressACFPython();
+
+    protected:
+    /// Collect the unwrapped positions and velocities of the particles this rank correlates
+    void collectSamples(std::vector<double>& position, std::vector<double>& velocity);
+
+    /// Normalize the summed correlations
+    std::vector<double>
+    normalize(const MultiTauCorrelator& correlator, double n_values, bool reduce);
+
+    std::shared_ptr<ParticleGroup> m_group;         //!< Particles to correlate
+    std::shared_ptr<ComputeThermo> m_thermo;        //!< Pressure tensor source (may be null)
+    std::unique_ptr<MultiTauCorrelator> m_position; //!< Mean squared displacement correlator
+    std::unique_ptr<MultiTauCorrelator> m_velocity; //!< Velocity autocorrelation correlator
+    std::unique_ptr<MultiTauCorrelator> m_stress;   //!< Stress correlator (null without thermo)
+
+    std::vector<unsigned int> m_tags; //!< Tags of the particles this rank correlates
+    uint64_t m_n_samples = 0;         //!< Number of samples
+    uint64_t m_last_timestep = 0;     //!< Timestep of the last sample
+    uint64_t m_period = 0;            //!< Timesteps between samples
+    };
+
+namespace detail
+    {
+/// Export TimeCorrelationAnalyzer to Python
+void export_TimeCorrelationAnalyzer(pybind11::module& m);
+
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,130 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file bench_pair.cc
+    \brief Benchmarks neighbor list builds, pair forces, and bond forces
+*/
+
+#include "hoomd/md/EvaluatorBondHarmonic.h"
+#include "hoomd/md/EvaluatorPairLJ.h"
+#include "hoomd/md/NeighborListBinned.h"
+#include "hoomd/md/NeighborListTree.h"
+#include "hoomd/md/PotentialBond.h"
+#include "hoomd/md/PotentialPair.h"
+
+#include "hoomd/benchmarks/benchmark_harness.h"
+
+using namespace hoomd;
+using namespace hoomd::md;
+
+//! Lennard-Jones parameters for sigma = epsilon = 1
+static EvaluatorPairLJ::param_type lj_params()
+    {
+    EvaluatorPairLJ::param_type params;
+    params.sigma_6 = Scalar(1.0);
+    params.epsilon_x_4 = Scalar(4.0);
+    return params;
+    }
+
+//! Neighbor list builds and LJ forces in a fluid
+/*! The "nlist_*" cases rebuild the neighbor list every step. The "pair_lj" case evaluates the
+    forces on a static configuration, so the neighbor list only performs its distance check.
+*/
+void bench_lj_fluid(benchmark::Harness& harness)
+    {
+    std::vector<unsigned int> sizes = {4096, 32768, 262144};
+    if (harness.quick())
+        sizes.resize(1);
+
+    const Scalar r_cut = Scalar(2.5);
+    const Scalar r_buff = Scalar(0.4);
+
+    for (unsigned int N : sizes)
+        {
+        for (Scalar density : {Scalar(0.5), Scalar(0.85)})
+            {
+            auto sysdef = std::make_shared<SystemDefinition>(benchmark::makeFluidSnapshot(N, density),
+                                                             harness.getExecConf());
+            std::map<std::string, double> params = {{"N", N}, {"density", density}};
+
+            std::vector<std::pair<std::string, std::shared_ptr<NeighborList>>> nlists
+                = {{"binned", std::make_shared<NeighborListBinned>(sysdef, r_buff)},
+                   {"tree", std::make_shared<NeighborListTree>(sysdef, r_buff)}};
+
+            for (auto& [name, nlist] : nlists)
+                {
+                auto lj = std::make_shared<PotentialPair<EvaluatorPairLJ>>(sysdef, nlist);
+                lj->setParams(0, 0, lj_params());
+                lj->setRcut(0, 0, r_cut);
+
+                harness.run("nlist_" + name,
+                            params,
+                            N,
+                            [&](uint64_t timestep)
+                            {
+                                nlist->forceUpdate();
+                                nlist->compute(timestep);
+                            });
+
+                if (name == "binned")
+                    {
+                    harness.run("pair_lj",
+                                params,
+                                N,
+                                [&](uint64_t timestep) { lj->compute(timestep); });
+                    }
+                }
+            }
+        }
+    }
+
+//! Bond and pair forces in a melt of linear chains
+void bench_polymer_melt(benchmark::Harness& harness)
+    {
+    std::vector<unsigned int> n_chains = {128, 1024, 8192};
+    if (harness.quick())
+        n_chains.resize(1);
+
+    const unsigned int chain_length = 32;
+    const Scalar density = Scalar(0.85);
+
+    for (unsigned int n : n_chains)
+        {
+        const unsigned int N = n * chain_length;
+        auto sysdef = std::make_shared<SystemDefinition>(
+            benchmark::makePolymerMeltSnapshot(n, chain_length, density),
+            harness.getExecConf());
+        std::map<std::string, double> params
+            = {{"N", N}, {"density", density}, {"chain_length", chain_length}};
+
+        auto bond = std::make_shared<PotentialBond<EvaluatorBondHarmonic, BondData>>(sysdef);
+        bond->setParams(0, harmonic_params(Scalar(300.0), Scalar(1.0)));
+        harness.run("bond_harmonic",
+                    params,
+                    N,
+                    [&](uint64_t timestep) { bond->compute(timestep); });
+
+        auto nlist = std::make_shared<NeighborListBinned>(sysdef, Scalar(0.4));
+        nlist->setSingleExclusion("bond");
+        auto lj = std::make_shared<PotentialPair<EvaluatorPairLJ>>(sysdef, nlist);
+        lj->setParams(0, 0, lj_params());
+        lj->setRcut(0, 0, Scalar(1.122462));
+        harness.run("nlist_binned_excluded",
+                    params,
+                    N,
+                    [&](uint64_t timestep)
+                    {
+                        nlist->forceUpdate();
+                        nlist->compute(timestep);
+                    });
+        }
+    }
+
+//! Run all benchmarks in this file
+void bench_pair(benchmark::Harness& harness)
+    {
+    bench_lj_fluid(harness);
+    bench_polymer_melt(harness);
+    }
+
+HOOMD_BENCHMARK_MAIN("bench_pair", bench_pair)
@@ -9,8 +9,9 @@ or by direct access via the Python API.
 """
 
 from hoomd.md import _md
-from hoomd.operation import Compute
+from hoomd.operation import Compute, Writer
 from hoomd.data.parameterdicts import ParameterDict
+from hoomd.filter import ParticleFilter
 from hoomd.logging import log
 import hoomd
 
@@ -381,3 +382,365 @@ class HarmonicAveragedThermodynamicQuantities(Compute):
         """Average pressure :math:`[\\mathrm{pressure}]`."""
         self._cpp_obj.compute(self._simulation.timestep)
         return self._cpp_obj.pressure
+
+
+class RDF(Compute):
+    """Accumulate partial radial distribution functions.
+
+    Args:
+        r_max (float): Largest pair distance to histogram
+            :math:`[\\mathrm{length}]`.
+        bins (int): Number of histogram bins.
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list to reuse when its
+            cutoff is at least *r_max* for every type pair. Defaults to
+            `None`.
+
+    `RDF` histograms the distances between all pairs of particles closer than
+    *r_max* separately for each pair of particle types :math:`(a, b)` and
+    normalizes the histogram by the ideal gas count:
+
+    .. math::
+
+        g_{ab}(r) = \\frac{V \\, n_{ab}(r)}
+        {N_a (N_b - \\delta_{ab}) \\, \\Delta V(r)},
+
+    where :math:`n_{ab}(r)` counts the ordered pairs of particles of types
+    :math:`a` and :math:`b` in the bin at :math:`r`, :math:`N_a` is the
+    number of particles of type :math:`a`, :math:`V` is the volume of the box
+    (area in 2D), and :math:`\\Delta V(r)` is the volume (area) of the
+    spherical shell of the bin.
+
+    Each time step that `RDF` computes adds one histogram to the running
+    average in `rdf`. `RDF` computes when a logger or writer reads one of its
+    loggable quantities, so the trigger of the writer sets the sampling
+    period.
+
+    When *nlist* includes all pairs within *r_max*, `RDF` reuses the pairs in
+    the neighbor list that a pair force already built. In this case, `RDF`
+    does not count pairs excluded from the neighbor list (see
+    `hoomd.md.nlist.NeighborList.exclusions`). Otherwise, `RDF` finds pairs
+    with its own cell list.
+
+    Examples::
+
+        rdf = hoomd.md.compute.RDF(r_max=4.0, bins=200, nlist=nl)
+        sim.operations.computes.append(rdf)
+        logger.add(rdf, quantities=['rdf'])
+
+    Attributes:
+        r_max (float): Largest pair distance to histogram
+            :math:`[\\mathrm{length}]` (*read only*).
+
+        bins (int): Number of histogram bins (*read only*).
+
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list to reuse
+            (*read only*).
+    """
+
+    def __init__(self, r_max, bins, nlist=None):
+        super().__init__()
+        self._param_dict.update(
+            ParameterDict(r_max=float(r_max), bins=int(bins)))
+        self._nlist = nlist
+
+    @property
+    def nlist(self):
+        return self._nlist
+
+    def _attach_hook(self):
+        if self._nlist is not None:
+            self._nlist._attach(self._simulation)
+            nlist_cpp = self._nlist._cpp_obj
+        else:
+            nlist_cpp = None
+        self._cpp_obj = _md.ComputeRDF(self._simulation.state._cpp_sys_def,
+                                       nlist_cpp, self.r_max, self.bins)
+
+    def _detach_hook(self):
+        if self._nlist is not None:
+            self._nlist._detach()
+
+    def reset(self):
+        """Discard the accumulated histograms."""
+        if self._attached:
+            self._cpp_obj.reset()
+
+    @log(category='sequence', requires_run=True)
+    def rdf(self):
+        """(*N_pairs*, *bins*) `numpy.ndarray` of `float`: Average \
+        :math:`g_{ab}(r)` of each type pair :math:`[\\mathrm{dimensionless}]`.
+
+        See Also:
+            `type_pairs` lists the type pair of each row and `bin_centers`
+            the distance of each column.
+        """
+        self._cpp_obj.compute(self._simulation.timestep)
+        return self._cpp_obj.rdf
+
+    @log(category='sequence', requires_run=True)
+    def bin_centers(self):
+        """(*bins*,) `numpy.ndarray` of `float`: Distance at the center of \
+        each bin :math:`[\\mathrm{length}]`."""
+        return self._cpp_obj.bin_centers
+
+    @property
+    def type_pairs(self):
+        """list[tuple[str, str]]: Type pair of each row of `rdf`.
+
+        The rows list the pairs :math:`(a, b)` with :math:`a \\le b` in the
+        order of `hoomd.State.particle_types`.
+        """
+        types = self._simulation.state.particle_types
+        return [(types[a], types[b])
+                for a in range(len(types))
+                for b in range(a, len(types))]
+
+    @log(requires_run=True)
+    def num_frames(self):
+        """int: Number of time steps in the running average."""
+        return self._cpp_obj.num_frames
+
+
+class StructureFactor(Compute):
+    """Accumulate the static structure factor.
+
+    Args:
+        mesh (int): Number of mesh points along each box vector.
+        q_max (float): Largest wave vector magnitude
+            :math:`[\\mathrm{length}^{-1}]`.
+        bins (int): Number of bins in :math:`|\\vec{q}|`.
+
+    `StructureFactor` computes
+
+    .. math::
+
+        S(\\vec{q}) = \\frac{1}{N} \\left| \\sum_{j=1}^{N}
+        e^{-i \\vec{q} \\cdot \\vec{r}_j} \\right|^2
+
+    for the wave vectors of the reciprocal lattice of the box with
+    :math:`0 < |\\vec{q}| < q_\\mathrm{max}` and averages the values in
+    spherical shells of :math:`|\\vec{q}|`. Like `hoomd.md.long_range.pppm`,
+    `StructureFactor` assigns the particles to a *mesh* with the
+    cloud-in-cell scheme and evaluates the sum with a fast Fourier transform.
+    It divides out the smoothing of the assignment.
+
+    Each time step that `StructureFactor` computes adds to the running
+    average in `structure_factor`. `StructureFactor` computes when a logger
+    or writer reads one of its loggable quantities.
+
+    Note:
+        Choose *q_max* well below the Nyquist wave vector
+        :math:`\\pi \\cdot \\mathrm{mesh} / L` of the shortest box length
+        :math:`L`. Modes near the Nyquist wave vector are aliased.
+
+    Examples::
+
+        sq = hoomd.md.compute.StructureFactor(mesh=64, q_max=10.0, bins=100)
+        sim.operations.computes.append(sq)
+        logger.add(sq, quantities=['structure_factor'])
+
+    Attributes:
+        mesh (int): Number of mesh points along each box vector
+            (*read only*).
+
+        q_max (float): Largest wave vector magnitude
+            :math:`[\\mathrm{length}^{-1}]` (*read only*).
+
+        bins (int): Number of bins in :math:`|\\vec{q}|` (*read only*).
+    """
+
+    def __init__(self, mesh, q_max, bins):
+        super().__init__()
+        self._param_dict.update(
+            ParameterDict(mesh=int(mesh), q_max=float(q_max), bins=int(bins)))
+
+    def _attach_hook(self):
+        self._cpp_obj = _md.ComputeStructureFactor(
+            self._simulation.state._cpp_sys_def, self.mesh, self.q_max,
+            self.bins)
+
+    def reset(self):
+        """Discard the accumulated averages."""
+        if self._attached:
+            self._cpp_obj.reset()
+
+    @log(category='sequence', requires_run=True)
+    def structure_factor(self):
+        """(*bins*,) `numpy.ndarray` of `float`: Average :math:`S(q)` in \
+        each bin :math:`[\\mathrm{dimensionless}]`.
+
+        Bins that contain no wave vectors of the reciprocal lattice are 0.
+        """
+        self._cpp_obj.compute(self._simulation.timestep)
+        return self._cpp_obj.structure_factor
+
+    @log(category='sequence', requires_run=True)
+    def bin_centers(self):
+        """(*bins*,) `numpy.ndarray` of `float`: Wave vector magnitude at \
+        the center of each bin :math:`[\\mathrm{length}^{-1}]`."""
+        return self._cpp_obj.bin_centers
+
+    @log(requires_run=True)
+    def num_frames(self):
+        """int: Number of time steps in the running average."""
+        return self._cpp_obj.num_frames
+
+
+class TimeCorrelation(Writer):
+    """Accumulate the mean squared displacement and time correlation functions.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): Select the timesteps to sample.
+        filter (hoomd.filter.filter_like): Particles to correlate.
+        thermo (ThermodynamicQuantities): Provide the pressure tensor for
+            `stress_acf`. Defaults to `None`.
+        levels (int): Number of correlator levels. Defaults to 16.
+        p (int): Number of samples kept in each level. Defaults to 16.
+        m (int): Number of samples of one level that combine into one sample
+            of the next. Defaults to 2.
+
+    `TimeCorrelation` evaluates
+
+    .. math::
+
+        \\mathrm{MSD}(\\tau) &= \\frac{1}{N} \\sum_{i=1}^{N}
+        \\left\\langle |\\vec{r}_i(t + \\tau) - \\vec{r}_i(t)|^2
+        \\right\\rangle_t \\\\
+        \\mathrm{VACF}(\\tau) &= \\frac{1}{N} \\sum_{i=1}^{N}
+        \\left\\langle \\vec{v}_i(t) \\cdot \\vec{v}_i(t + \\tau)
+        \\right\\rangle_t
+
+    for the :math:`N` particles selected by *filter*, where
+    :math:`\\vec{r}_i` is the position of particle :math:`i` unwrapped with
+    its image, and the average runs over all sampled time origins :math:`t`.
+    When given *thermo*, `TimeCorrelation` also evaluates the stress
+    autocorrelation function
+
+    .. math::
+
+        \\mathrm{SACF}(\\tau) = \\frac{1}{3} \\sum_{\\alpha < \\beta}
+        \\left\\langle P_{\\alpha\\beta}(t) P_{\\alpha\\beta}(t + \\tau)
+        \\right\\rangle_t
+
+    from the off-diagonal elements of the pressure tensor (:math:`P_{xy}`
+    only in 2D). Multiply it by :math:`V / kT` and integrate over
+    :math:`\\tau` to obtain the shear viscosity.
+
+    `TimeCorrelation` uses multiple tau correlators: Level 0 correlates each
+    sample with the last *p* samples. Every *m* samples, level :math:`k`
+    passes a sample to level :math:`k + 1`, so the lags grow geometrically
+    up to :math:`p \\, m^{\\mathrm{levels} - 1}` samples while the memory and
+    the work per sample grow only linearly with *levels*. Positions and
+    velocities pass to the next level by subsampling, which keeps `msd` and
+    `vacf` exact. The pressure tensor passes to the next level by block
+    averaging. `lag_times` lists the lags.
+
+    `TimeCorrelation` samples in C++ on the timesteps selected by *trigger*,
+    so it is a `hoomd.operation.Writer`: Add it to
+    `hoomd.Operations.writers`. *trigger* must select evenly spaced
+    timesteps, such as `hoomd.trigger.Periodic`.
+
+    Note:
+        `TimeCorrelation` stores :math:`3 \\, p \\cdot \\mathrm{levels}`
+        values for the positions and the velocities of each particle. The
+        particles selected by *filter* must not change during the run.
+
+    Examples::
+
+        time_correlation = hoomd.md.compute.TimeCorrelation(
+            trigger=hoomd.trigger.Periodic(10),
+            filter=hoomd.filter.All(),
+            thermo=thermo)
+        sim.operations.writers.append(time_correlation)
+        logger.add(time_correlation,
+                   quantities=['lag_times', 'msd', 'stress_acf'])
+
+    Attributes:
+        filter (hoomd.filter.filter_like): Particles to correlate
+            (*read only*).
+
+        thermo (ThermodynamicQuantities): Provide the pressure tensor
+            (*read only*).
+
+        levels (int): Number of correlator levels (*read only*).
+
+        p (int): Number of samples kept in each level (*read only*).
+
+        m (int): Number of samples of one level that combine into one sample
+            of the next (*read only*).
+    """
+
+    def __init__(self, trigger, filter, thermo=None, levels=16, p=16, m=2):
+        super().__init__(trigger)
+        self._param_dict.update(
+            ParameterDict(filter=ParticleFilter,
+                          levels=int(levels),
+                          p=int(p),
+                          m=int(m)))
+        self.filter = filter
+        self._thermo = thermo
+
+    @property
+    def thermo(self):
+        return self._thermo
+
+    def _attach_hook(self):
+        if self._thermo is not None:
+            self._thermo._attach(self._simulation)
+            thermo_cpp = self._thermo._cpp_obj
+        else:
+            thermo_cpp = None
+        group = self._simulation.state._get_group(self.filter)
+        self._cpp_obj = _md.TimeCorrelationAnalyzer(
+            self._simulation.state._cpp_sys_def, self.trigger, group,
+            thermo_cpp, self.levels, self.p, self.m)
+
+    def _detach_hook(self):
+        if self._thermo is not None:
+            self._thermo._detach()
+
+    def reset(self):
+        """Discard all samples."""
+        if self._attached:
+            self._cpp_obj.reset()
+
+    @log(category='sequence', requires_run=True)
+    def lag_times(self):
+        """(*N_lags*,) `numpy.ndarray` of `float`: Lag of each correlation \
+        :math:`[\\mathrm{time\\ steps}]`.
+
+        The lags are 0 until `TimeCorrelation` has taken two samples.
+        """
+        return self._cpp_obj.lag_times
+
+    @log(category='sequence', requires_run=True)
+    def msd(self):
+        """(*N_lags*,) `numpy.ndarray` of `float`: Mean squared \
+        displacement :math:`[\\mathrm{length}^2]`.
+
+        Lags without samples are NaN.
+        """
+        return self._cpp_obj.msd
+
+    @log(category='sequence', requires_run=True)
+    def vacf(self):
+        """(*N_lags*,) `numpy.ndarray` of `float`: Velocity autocorrelation \
+        function :math:`[\\mathrm{velocity}^2]`.
+
+        Lags without samples are NaN.
+        """
+        return self._cpp_obj.vacf
+
+    @log(category='sequence', requires_run=True)
+    def stress_acf(self):
+        """(*N_lags*,) `numpy.ndarray` of `float`: Stress autocorrelation \
+        function :math:`[\\mathrm{pressure}^2]`.
+
+        Lags without samples and all lags without *thermo* are NaN.
+        """
+        return self._cpp_obj.stress_acf
+
+    @log(requires_run=True)
+    def num_samples(self):
+        """int: Number of samples."""
+        return self._cpp_obj.num_samples
@@ -461,6 +461,7 @@ class ConstantPressure(Thermostatted):
 
                 npt.barostat_dof = numpy.load(file=path / 'barostat_dof.npy')
     """
+    _checkpoint_params = ('barostat_dof',)
 
     def __init__(self,
                  filter,
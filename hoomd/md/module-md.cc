@@ -19,8 +19,11 @@ void export_ActiveForceConstraintComputePlane(pybind11::module& m);
 void export_ActiveForceConstraintComputePrimitive(pybind11::module& m);
 void export_ActiveForceConstraintComputeSphere(pybind11::module& m);
 void export_ActiveRotationalDiffusionUpdater(pybind11::module& m);
+void export_ComputeRDF(pybind11::module& m);
+void export_ComputeStructureFactor(pybind11::module& m);
 void export_ComputeThermo(pybind11::module& m);
 void export_ComputeThermoHMA(pybind11::module& m);
+void export_TimeCorrelationAnalyzer(pybind11::module& m);
 void export_ConstantForceCompute(pybind11::module& m);
 void export_HarmonicAngleForceCompute(pybind11::module& m);
 void export_CosineSqAngleForceCompute(pybind11::module& m);
@@ -329,8 +332,11 @@ PYBIND11_MODULE(_md, m)
     export_ActiveForceConstraintComputePrimitive(m);
     export_ActiveForceConstraintComputeSphere(m);
     export_ActiveRotationalDiffusionUpdater(m);
+    export_ComputeRDF(m);
+    export_ComputeStructureFactor(m);
     export_ComputeThermo(m);
     export_ComputeThermoHMA(m);
+    export_TimeCorrelationAnalyzer(m);
     export_ConstantForceCompute(m);
     export_HarmonicAngleForceCompute(m);
     export_CosineSqAngleForceCompute(m);
@@ -113,6 +113,8 @@ class NeighborList(Compute):
         Type: `TypeParameter` [`tuple` [``particle_type``, ``particle_type``],
         `float`])
     """
+    _checkpoint_params = ('buffer',)
+    _tuning_cache_params = ('buffer',)
 
     def __init__(self, buffer, exclusions, rebuild_check_delay, check_dist,
                  mesh, default_r_cut):
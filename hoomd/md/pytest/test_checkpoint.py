@@ -0,0 +1,101 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import os
+
+import hoomd
+import numpy as np
+import pytest
+
+
+def make_integrator():
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    lj = hoomd.md.pair.LJ(nlist=nlist, default_r_cut=2.5)
+    lj.params.default = {'sigma': 1, 'epsilon': 1}
+    npt = hoomd.md.methods.ConstantPressure(
+        filter=hoomd.filter.All(),
+        S=1.0,
+        tauS=1.0,
+        couple='xyz',
+        thermostat=hoomd.md.methods.thermostats.MTTK(kT=1.0, tau=0.5))
+    return hoomd.md.Integrator(dt=0.005, methods=[npt], forces=[lj])
+
+
+@pytest.fixture
+def checkpointed_simulation(simulation_factory, lattice_snapshot_factory,
+                            tmp_path):
+    """Run a simulation that writes a checkpoint at step 20."""
+    sim = simulation_factory(lattice_snapshot_factory(n=5, a=1.5, r=0.05))
+    sim.seed = 12
+    sim.operations.integrator = make_integrator()
+    sim.operations.integrator.forces[0].nlist.buffer = 0.3
+
+    checkpoint = hoomd.write.Checkpoint(trigger=hoomd.trigger.Periodic(20),
+                                        filename=tmp_path / 'checkpoint.gsd')
+    sim.operations.writers.append(checkpoint)
+    sim.run(20)
+    return sim, checkpoint
+
+
+def test_restart(checkpointed_simulation, device):
+    sim, checkpoint = checkpointed_simulation
+    npt = sim.operations.integrator.methods[0]
+    barostat_dof = npt.barostat_dof
+    translational_dof = npt.thermostat.translational_dof
+    assert np.any(np.array(barostat_dof) != 0)
+    assert np.any(np.array(translational_dof) != 0)
+
+    restart = hoomd.Simulation(device=device)
+    restart.create_state_from_checkpoint(checkpoint.filename)
+    assert restart.timestep == 20
+    assert restart.seed == 12
+    assert restart.state.N_particles == sim.state.N_particles
+
+    restart.operations.integrator = make_integrator()
+    restart.operations.writers.append(
+        hoomd.write.Checkpoint(trigger=hoomd.trigger.Periodic(20),
+                               filename=checkpoint.filename))
+    restart.run(0)
+
+    restart_npt = restart.operations.integrator.methods[0]
+    np.testing.assert_allclose(restart_npt.barostat_dof, barostat_dof)
+    np.testing.assert_allclose(restart_npt.thermostat.translational_dof,
+                               translational_dof)
+    assert restart.operations.integrator.forces[0].nlist.buffer == 0.3
+
+    restart.run(10)
+
+
+def test_mismatched_operations(checkpointed_simulation, device):
+    sim, checkpoint = checkpointed_simulation
+
+    restart = hoomd.Simulation(device=device)
+    restart.create_state_from_checkpoint(checkpoint.filename)
+    with pytest.raises(RuntimeError):
+        restart.run(0)
+
+
+def test_not_a_checkpoint(simulation_factory, lattice_snapshot_factory,
+                          device, tmp_path):
+    filename = tmp_path / 'trajectory.gsd'
+    sim = simulation_factory(lattice_snapshot_factory())
+    hoomd.write.GSD.write(state=sim.state, mode='wb', filename=str(filename))
+
+    restart = hoomd.Simulation(device=device)
+    with pytest.raises(RuntimeError):
+        restart.create_state_from_checkpoint(filename)
+
+
+def test_asynchronous(checkpointed_simulation, device):
+    sim, checkpoint = checkpointed_simulation
+    checkpoint.asynchronous = True
+    sim.run(20)
+    checkpoint.wait()
+
+    filename = str(checkpoint.filename)
+    if sim.device.communicator.rank == 0:
+        assert not os.path.exists(filename + '.tmp')
+
+    restart = hoomd.Simulation(device=device)
+    restart.create_state_from_checkpoint(filename)
+    assert restart.timestep == 40
@@ -541,3 +541,108 @@ def test_write_gsd_no_dynamic(simulation_factory, hoomd_snapshot, tmp_path):
             assert not f.chunk_exists(frame=1, name='configuration/box')
             assert not f.chunk_exists(frame=1, name='particles/N')
             assert not f.chunk_exists(frame=1, name='particles/position')
+
+
+def test_write_gsd_parallel(simulation_factory, hoomd_snapshot, tmp_path):
+    """Ensure that parallel writes produce the same frames as gathered writes.
+    """
+    filename = tmp_path / "test_gathered.gsd"
+    filename_parallel = tmp_path / "test_parallel.gsd"
+
+    sim = simulation_factory(hoomd_snapshot)
+    sim.operations.integrator = hoomd.md.Integrator(
+        dt=0.001,
+        methods=[hoomd.md.methods.ConstantVolume(filter=hoomd.filter.All())])
+
+    gsd_writer = hoomd.write.GSD(filename=filename,
+                                 trigger=hoomd.trigger.Periodic(1),
+                                 mode='wb',
+                                 dynamic=['property', 'momentum'])
+    gsd_writer_parallel = hoomd.write.GSD(filename=filename_parallel,
+                                          trigger=hoomd.trigger.Periodic(1),
+                                          mode='wb',
+                                          dynamic=['property', 'momentum'])
+    gsd_writer_parallel.parallel_write = True
+    sim.operations.writers.extend([gsd_writer, gsd_writer_parallel])
+
+    sim.run(3)
+
+    assert gsd_writer_parallel.parallel_write
+
+    gsd_writer.flush()
+    gsd_writer_parallel.flush()
+
+    if sim.device.communicator.rank == 0:
+        with gsd.hoomd.open(name=filename, mode='r') as traj, \
+                gsd.hoomd.open(name=filename_parallel, mode='r') as traj_parallel:
+            assert len(traj) == len(traj_parallel) == 3
+            for frame, frame_parallel in zip(traj, traj_parallel):
+                assert frame.configuration.step \
+                    == frame_parallel.configuration.step
+                np.testing.assert_array_equal(frame.particles.position,
+                                              frame_parallel.particles.position)
+                np.testing.assert_array_equal(frame.particles.velocity,
+                                              frame_parallel.particles.velocity)
+                np.testing.assert_array_equal(frame.particles.image,
+                                              frame_parallel.particles.image)
+                np.testing.assert_array_equal(frame.particles.typeid,
+                                              frame_parallel.particles.typeid)
+                assert frame.particles.types == frame_parallel.particles.types
+
+
+def test_write_gsd_streams(create_md_sim, tmp_path):
+    filename = tmp_path / "temporary_test_file.gsd"
+
+    sim = create_md_sim
+    probe = hoomd.write.GSDStream(trigger=hoomd.trigger.Periodic(2),
+                                  filter=hoomd.filter.Tags([0, 1, 2, 3]),
+                                  dynamic=['property', 'momentum'])
+    momentum = hoomd.write.GSDStream(trigger=hoomd.trigger.Periodic(5),
+                                     dynamic=['momentum'])
+    gsd_writer = hoomd.write.GSD(filename=filename,
+                                 trigger=hoomd.trigger.Periodic(10),
+                                 mode='wb',
+                                 dynamic=['property', 'topology'],
+                                 streams=[probe, momentum])
+    sim.operations.writers.append(gsd_writer)
+    assert gsd_writer.streams == (probe, momentum)
+
+    sim.run(11)
+    gsd_writer.flush()
+    n_particles = sim.state.N_particles
+
+    if sim.device.communicator.rank == 0:
+        with gsd.hoomd.open(name=filename, mode='r') as traj:
+            steps = [frame.configuration.step for frame in traj]
+            streams = [
+                frame.log['hoomd/write/GSD/stream'][0] for frame in traj
+            ]
+            assert steps == [0, 0, 0, 2, 4, 5, 6, 8, 10, 10, 10]
+            assert streams == [0, 1, 2, 1, 1, 2, 1, 1, 0, 1, 2]
+
+            # frames of the probe hold only the selected particles
+            for frame, stream in zip(traj, streams):
+                if stream == 1:
+                    assert frame.particles.N == 4
+                    assert frame.particles.position.shape == (4, 3)
+                    assert frame.particles.velocity.shape == (4, 3)
+                    assert frame.particles.typeid.shape == (4,)
+                else:
+                    assert frame.particles.N == n_particles
+
+            np.testing.assert_array_equal(traj[9].particles.position,
+                                          traj[8].particles.position[0:4])
+            np.testing.assert_array_equal(traj[9].particles.velocity,
+                                          traj[10].particles.velocity[0:4])
+
+        # frames of the whole system write only their dynamic fields
+        with gsd.fl.open(name=filename, mode='r') as f:
+            assert f.chunk_exists(frame=5, name='particles/velocity')
+            assert not f.chunk_exists(frame=5, name='particles/position')
+            assert f.chunk_exists(frame=8, name='particles/position')
+            assert not f.chunk_exists(frame=8, name='particles/velocity')
+
+            # only frames of the main stream write topology
+            for frame, stream in enumerate(streams):
+                assert f.chunk_exists(frame=frame,
+                                      name='bonds/N') == (stream == 0)
@@ -0,0 +1,121 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import hoomd
+from hoomd.conftest import logging_check
+from hoomd.logging import LoggerCategories
+import numpy as np
+import pytest
+
+
+def test_logging():
+    logging_check(
+        hoomd.md.compute.RDF, ('md', 'compute'), {
+            'rdf': {
+                'category': LoggerCategories.sequence,
+                'default': True
+            },
+            'bin_centers': {
+                'category': LoggerCategories.sequence,
+                'default': True
+            },
+            'num_frames': {
+                'category': LoggerCategories.scalar,
+                'default': True
+            }
+        })
+    logging_check(
+        hoomd.md.compute.StructureFactor, ('md', 'compute'), {
+            'structure_factor': {
+                'category': LoggerCategories.sequence,
+                'default': True
+            },
+            'bin_centers': {
+                'category': LoggerCategories.sequence,
+                'default': True
+            },
+            'num_frames': {
+                'category': LoggerCategories.scalar,
+                'default': True
+            }
+        })
+
+
+def coordination(rdf, r_max, bins, n, volume):
+    """Integrate g(r) to the mean number of neighbors within r_max."""
+    edges = np.linspace(0, r_max, bins + 1)
+    shells = 4 / 3 * np.pi * (edges[1:]**3 - edges[:-1]**3)
+    return np.sum(rdf * shells) * (n - 1) / volume
+
+
+@pytest.mark.parametrize('use_nlist', [False, True])
+def test_lattice(simulation_factory, lattice_snapshot_factory, use_nlist):
+    sim = simulation_factory(lattice_snapshot_factory(a=1.0, n=8))
+
+    nlist = hoomd.md.nlist.Cell(buffer=0.4, exclusions=())
+    lj = hoomd.md.pair.LJ(nlist=nlist, default_r_cut=2.0)
+    lj.params[('A', 'A')] = dict(epsilon=1.0, sigma=1.0)
+    sim.operations.integrator = hoomd.md.Integrator(dt=0.005, forces=[lj])
+
+    rdf = hoomd.md.compute.RDF(r_max=1.5,
+                               bins=10,
+                               nlist=nlist if use_nlist else None)
+    sim.operations.computes.append(rdf)
+    sim.run(0)
+
+    g = rdf.rdf
+    assert g.shape == (1, 10)
+    assert rdf.num_frames == 1
+    assert rdf._cpp_obj.used_neighbor_list == use_nlist
+    assert rdf.type_pairs == [('A', 'A')]
+
+    # 6 neighbors at r=1 and 12 at r=sqrt(2)
+    np.testing.assert_allclose(coordination(g[0], 1.5, 10, 512, 512), 18)
+    np.testing.assert_allclose(g[0][:6], 0)
+    assert g[0][6] > 0
+    assert g[0][9] > 0
+    np.testing.assert_allclose(rdf.bin_centers[6], 0.975)
+
+    # reading again on the same step does not add a frame
+    g = rdf.rdf
+    assert rdf.num_frames == 1
+
+    rdf.reset()
+    assert rdf.num_frames == 0
+
+
+def test_nlist_too_short(simulation_factory, lattice_snapshot_factory):
+    sim = simulation_factory(lattice_snapshot_factory(a=1.0, n=8))
+
+    nlist = hoomd.md.nlist.Cell(buffer=0.4, exclusions=())
+    lj = hoomd.md.pair.LJ(nlist=nlist, default_r_cut=1.2)
+    lj.params[('A', 'A')] = dict(epsilon=1.0, sigma=1.0)
+    sim.operations.integrator = hoomd.md.Integrator(dt=0.005, forces=[lj])
+
+    rdf = hoomd.md.compute.RDF(r_max=1.5, bins=10, nlist=nlist)
+    sim.operations.computes.append(rdf)
+    sim.run(0)
+
+    np.testing.assert_allclose(coordination(rdf.rdf[0], 1.5, 10, 512, 512),
+                               18)
+    assert not rdf._cpp_obj.used_neighbor_list
+
+
+def test_structure_factor_lattice(simulation_factory,
+                                  lattice_snapshot_factory):
+    sim = simulation_factory(lattice_snapshot_factory(a=1.0, n=8))
+    sq = hoomd.md.compute.StructureFactor(mesh=32, q_max=7.0, bins=14)
+    sim.operations.computes.append(sq)
+    sim.run(0)
+
+    s = sq.structure_factor
+    centers = sq.bin_centers
+
+    # the first Bragg peak of the simple cubic lattice is at |q| = 2 pi
+    peak = np.argmax(s)
+    assert abs(centers[peak] - 2 * np.pi) < 0.5
+    assert s[peak] > 1
+
+    # other modes within the first Bragg peak vanish
+    np.testing.assert_allclose(s[centers < 5.5], 0, atol=1e-3)
+    assert sq.num_frames == 1
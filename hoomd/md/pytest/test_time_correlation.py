@@ -0,0 +1,112 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import hoomd
+from hoomd.conftest import logging_check
+from hoomd.logging import LoggerCategories
+import numpy as np
+import pytest
+
+
+def test_logging():
+    logging_check(
+        hoomd.md.compute.TimeCorrelation, ('md', 'compute'), {
+            'lag_times': {
+                'category': LoggerCategories.sequence,
+                'default': True
+            },
+            'msd': {
+                'category': LoggerCategories.sequence,
+                'default': True
+            },
+            'vacf': {
+                'category': LoggerCategories.sequence,
+                'default': True
+            },
+            'stress_acf': {
+                'category': LoggerCategories.sequence,
+                'default': True
+            },
+            'num_samples': {
+                'category': LoggerCategories.scalar,
+                'default': True
+            }
+        })
+
+
+@pytest.fixture
+def ballistic_simulation(simulation_factory, lattice_snapshot_factory):
+    """Particles that move with constant random velocities.
+
+    Returns the simulation and the mean squared velocity.
+    """
+    snapshot = lattice_snapshot_factory(a=2.0, n=4)
+    rng = np.random.default_rng(7)
+    velocity = rng.normal(size=(4**3, 3))
+    if snapshot.communicator.rank == 0:
+        snapshot.particles.velocity[:] = velocity
+    sim = simulation_factory(snapshot)
+
+    method = hoomd.md.methods.ConstantVolume(filter=hoomd.filter.All())
+    sim.operations.integrator = hoomd.md.Integrator(dt=0.1, methods=[method])
+    return sim, np.mean(np.sum(velocity**2, axis=1))
+
+
+@pytest.mark.parametrize('use_thermo', [False, True])
+def test_ballistic(ballistic_simulation, use_thermo):
+    sim, v2 = ballistic_simulation
+    thermo = hoomd.md.compute.ThermodynamicQuantities(
+        filter=hoomd.filter.All())
+    sim.operations.computes.append(thermo)
+
+    time_correlation = hoomd.md.compute.TimeCorrelation(
+        trigger=hoomd.trigger.Periodic(2),
+        filter=hoomd.filter.All(),
+        thermo=thermo if use_thermo else None,
+        levels=3,
+        p=4,
+        m=2)
+    sim.operations.writers.append(time_correlation)
+    sim.run(40)
+
+    assert time_correlation.num_samples == 20
+    lag_times = time_correlation.lag_times
+    np.testing.assert_allclose(lag_times, [0, 2, 4, 6, 8, 12, 16, 24])
+
+    # the displacement grows linearly with the lag, also across the periodic
+    # boundaries
+    np.testing.assert_allclose(time_correlation.msd,
+                               v2 * (lag_times * 0.1)**2,
+                               rtol=1e-4)
+    np.testing.assert_allclose(time_correlation.vacf, v2, rtol=1e-4)
+
+    stress_acf = time_correlation.stress_acf
+    if use_thermo:
+        # without forces, the pressure tensor is constant
+        sim.always_compute_pressure = True
+        sim.run(0)
+        p = thermo.pressure_tensor
+        expected = (p[1]**2 + p[2]**2 + p[4]**2) / 3
+        np.testing.assert_allclose(stress_acf, expected, rtol=1e-4)
+    else:
+        assert np.all(np.isnan(stress_acf))
+
+    time_correlation.reset()
+    assert time_correlation.num_samples == 0
+    assert np.all(np.isnan(time_correlation.msd))
+
+
+def test_lags_without_samples(ballistic_simulation):
+    sim, _ = ballistic_simulation
+    time_correlation = hoomd.md.compute.TimeCorrelation(
+        trigger=hoomd.trigger.Periodic(1),
+        filter=hoomd.filter.All(),
+        levels=2,
+        p=4,
+        m=2)
+    sim.operations.writers.append(time_correlation)
+    sim.run(3)
+
+    msd = time_correlation.msd
+    assert np.all(np.isfinite(msd[:3]))
+    assert np.all(np.isnan(msd[3:]))
@@ -0,0 +1,190 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+// this include is necessary to get MPI included before anything else to support intel MPI
+#include "hoomd/ExecutionConfiguration.h"
+
+#include "hoomd/md/MultiTauCorrelator.h"
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace hoomd;
+using namespace hoomd::md;
+
+#include "hoomd/test/upp11_config.h"
+HOOMD_UP_MAIN();
+
+/*! \file test_multi_tau_correlator.cc
+    \brief Unit tests for the MultiTauCorrelator class
+    \ingroup unit_tests
+*/
+
+//! Generate a random walk of n values for each of n_samples samples
+static vector<vector<double>> make_samples(unsigned int n, unsigned int n_samples)
+    {
+    std::mt19937 rng(42);
+    std::normal_distribution<double> normal;
+
+    vector<vector<double>> samples(n_samples, vector<double>(n, 0.0));
+    for (unsigned int t = 1; t < n_samples; t++)
+        {
+        for (unsigned int i = 0; i < n; i++)
+            {
+            samples[t][i] = samples[t - 1][i] + normal(rng);
+            }
+        }
+    return samples;
+    }
+
+//! Correlate all pairs of samples at the given lag
+static void brute_force(const vector<vector<double>>& samples,
+                        unsigned int lag,
+                        MultiTauCorrelator::Mode mode,
+                        double& sum,
+                        uint64_t& count)
+    {
+    sum = 0.0;
+    count = 0;
+    for (size_t t = 0; t + lag < samples.size(); t++)
+        {
+        for (size_t i = 0; i < samples[t].size(); i++)
+            {
+            const double a = samples[t][i];
+            const double b = samples[t + lag][i];
+            sum += mode == MultiTauCorrelator::Mode::product ? a * b : (b - a) * (b - a);
+            }
+        count++;
+        }
+    }
+
+//! Check the lags of the correlator
+UP_TEST(multi_tau_lags)
+    {
+    MultiTauCorrelator correlator(1,
+                                  3,
+                                  8,
+                                  2,
+                                  MultiTauCorrelator::Mode::product,
+                                  MultiTauCorrelator::Compression::subsample);
+
+    vector<uint64_t> expected = {0, 1, 2, 3, 4, 5, 6, 7, 8, 10, 12, 14, 16, 20, 24, 28};
+    UP_ASSERT_EQUAL(correlator.getNumLags(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++)
+        {
+        UP_ASSERT_EQUAL(correlator.getLags()[i], expected[i]);
+        }
+    }
+
+//! Subsampled levels reproduce the direct correlation over their time origins
+UP_TEST(multi_tau_subsample)
+    {
+    const unsigned int n = 4, levels = 4, p = 8, m = 2, n_samples = 300;
+    vector<vector<double>> samples = make_samples(n, n_samples);
+
+    MultiTauCorrelator correlator(n,
+                                  levels,
+                                  p,
+                                  m,
+                                  MultiTauCorrelator::Mode::squared_difference,
+                                  MultiTauCorrelator::Compression::subsample);
+    for (const vector<double>& sample : samples)
+        {
+        correlator.add(sample.data());
+        }
+
+    // level k holds the samples with index divisible by m^k
+    size_t lag_index = 0;
+    unsigned int spacing = 1;
+    for (unsigned int k = 0; k < levels; k++)
+        {
+        vector<vector<double>> level_samples;
+        for (unsigned int t = 0; t < n_samples; t += spacing)
+            {
+            level_samples.push_back(samples[t]);
+            }
+
+        for (unsigned int j = (k == 0 ? 0 : p / m); j < p; j++, lag_index++)
+            {
+            double sum;
+            uint64_t count;
+            brute_force(level_samples,
+                        j,
+                        MultiTauCorrelator::Mode::squared_difference,
+                        sum,
+                        count);
+
+            UP_ASSERT_EQUAL(correlator.getLags()[lag_index], uint64_t(j) * spacing);
+            UP_ASSERT_EQUAL(correlator.getCount()[lag_index], count);
+            if (sum == 0.0)
+                {
+                UP_ASSERT_SMALL(correlator.getSum()[lag_index], tol_small);
+                }
+            else
+                {
+                MY_CHECK_CLOSE(correlator.getSum()[lag_index], sum, tol_small);
+                }
+            }
+        spacing *= m;
+        }
+    }
+
+//! Averaged levels correlate the block averages of the samples
+UP_TEST(multi_tau_average)
+    {
+    const unsigned int n = 3, levels = 3, p = 4, m = 2, n_samples = 100;
+    vector<vector<double>> samples = make_samples(n, n_samples);
+
+    MultiTauCorrelator correlator(n,
+                                  levels,
+                                  p,
+                                  m,
+                                  MultiTauCorrelator::Mode::product,
+                                  MultiTauCorrelator::Compression::average);
+    for (const vector<double>& sample : samples)
+        {
+        correlator.add(sample.data());
+        }
+
+    size_t lag_index = 0;
+    vector<vector<double>> level_samples = samples;
+    for (unsigned int k = 0; k < levels; k++)
+        {
+        for (unsigned int j = (k == 0 ? 0 : p / m); j < p; j++, lag_index++)
+            {
+            double sum;
+            uint64_t count;
+            brute_force(level_samples, j, MultiTauCorrelator::Mode::product, sum, count);
+
+            UP_ASSERT_EQUAL(correlator.getCount()[lag_index], count);
+            MY_CHECK_CLOSE(correlator.getSum()[lag_index], sum, tol_small);
+            }
+
+        // the next level holds the averages of m consecutive samples
+        vector<vector<double>> next;
+        for (size_t t = 0; t + m <= level_samples.size(); t += m)
+            {
+            vector<double> average(n, 0.0);
+            for (unsigned int s = 0; s < m; s++)
+                {
+                for (unsigned int i = 0; i < n; i++)
+                    {
+                    average[i] += level_samples[t + s][i] / m;
+                    }
+                }
+            next.push_back(average);
+            }
+        level_samples = next;
+        }
+
+    // reset discards all sums
+    correlator.reset();
+    for (size_t i = 0; i < correlator.getNumLags(); i++)
+        {
+        UP_ASSERT_EQUAL(correlator.getCount()[i], uint64_t(0));
+        UP_ASSERT_EQUAL(correlator.getSum()[i], 0.0);
+        }
+    }
@@ -5,6 +5,7 @@
 #include "Analyzer.h"
 #include "BondedGroupData.h"
 #include "BoxResizeUpdater.h"
+#include "BufferedLogWriter.h"
 #include "CellList.h"
 #include "CellListStencil.h"
 #include "ClockSource.h"
@@ -20,10 +21,12 @@
 #include "Initializers.h"
 #include "Integrator.h"
 #include "LoadBalancer.h"
+#include "MemoryRegistry.h"
 #include "MeshDefinition.h"
 #include "MeshGroupData.h"
 #include "Messenger.h"
 #include "ParticleData.h"
+#include "Profiler.h"
 #include "ParticleFilterUpdater.h"
 #include "PythonAnalyzer.h"
 #include "PythonLocalDataAccess.h"
@@ -37,6 +40,7 @@
 #include "Tuner.h"
 #include "Updater.h"
 #include "UpdaterRemoveDrift.h"
+#include "UpdaterReplicaExchange.h"
 #include "Variant.h"
 #include "VectorVariant.h"
 
@@ -320,6 +324,7 @@ PYBIND11_MODULE(_hoomd, m)
     export_DCDDumpWriter(m);
     export_GSDDumpWriter(m);
     export_GSDDequeWriter(m);
+    export_BufferedLogWriter(m);
 
     // updaters
     export_Updater(m);
@@ -327,6 +332,7 @@ PYBIND11_MODULE(_hoomd, m)
     export_Integrator(m);
     export_BoxResizeUpdater(m);
     export_UpdaterRemoveDrift(m);
+    export_UpdaterReplicaExchange(m);
 #ifdef ENABLE_HIP
     export_BoxResizeUpdaterGPU(m);
 #endif
@@ -368,4 +374,10 @@ PYBIND11_MODULE(_hoomd, m)
 
     // messenger
     export_Messenger(m);
+
+    // profiler
+    export_Profiler(m);
+
+    // memory accounting
+    export_MemoryRegistry(m);
     }
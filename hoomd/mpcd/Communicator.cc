@@ -38,6 +38,11 @@ mpcd::Communicator::Communicator(std::shared_ptr<SystemDefinition> sysdef)
 
     m_exec_conf->msg->notice(5) << "Constructing MPCD Communicator" << endl;
 
+    if (m_decomposition->isRecursiveBisection())
+        {
+        throw std::runtime_error("MPCD does not support recursive bisection domains.");
+        }
+
     // allocate memory
     GPUArray<unsigned int> neighbors(neigh_max, m_exec_conf);
     m_neighbors.swap(neighbors);
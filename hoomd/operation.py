@@ -228,6 +228,14 @@ class _HOOMDBaseObject(_HOOMDGetSetAttrBase,
     # expected as _use_count may not equal 0.
     _remove_for_pickling = ('_simulation_', '_cpp_obj', "_use_count")
 
+    # Parameters and type parameters that change as the simulation runs and
+    # that hoomd.write.Checkpoint saves.
+    _checkpoint_params = ()
+    _checkpoint_typeparams = ()
+
+    # Tuned parameters that the tuning cache of hoomd.Simulation saves.
+    _tuning_cache_params = ()
+
     def _detach(self, force=False):
         """Decrement attach count and destroy C++ object if count == 0.
 
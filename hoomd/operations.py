@@ -19,15 +19,37 @@ added and removed from a `Simulation`.
 # destroying C++ objects) for all hoomd operations.
 
 import weakref
-from collections.abc import Collection
+from collections.abc import Collection, Sequence
 from copy import copy
 from itertools import chain
 from hoomd.data import syncedlist
-from hoomd.operation import Writer, Updater, Tuner, Compute, Integrator
+from hoomd.operation import (Writer, Updater, Tuner, Compute, Integrator,
+                             _HOOMDBaseObject)
 from hoomd.tune import ParticleSorter
 from hoomd.error import DataAccessError
 from hoomd import _hoomd
 
+# Attributes of operations that hold lists of child objects.
+_CHILD_LISTS = ('methods', 'forces', 'constraints')
+
+# Attributes of operations that hold a single child object.
+_CHILD_OBJECTS = ('thermostat', 'nlist')
+
+
+def _walk(path, obj):
+    """Yield the path and object of obj and all of its children."""
+    yield path, obj
+    for name in _CHILD_LISTS:
+        children = getattr(obj, name, None)
+        if isinstance(children, Sequence) and not isinstance(children, str):
+            for i, child in enumerate(children):
+                if isinstance(child, _HOOMDBaseObject):
+                    yield from _walk(f'{path}/{name}/{i}', child)
+    for name in _CHILD_OBJECTS:
+        child = getattr(obj, name, None)
+        if isinstance(child, _HOOMDBaseObject):
+            yield from _walk(f'{path}/{name}', child)
+
 
 class Operations(Collection):
     """A mutable collection of operations which act on a `Simulation`.
@@ -217,6 +239,10 @@ class Operations(Collection):
             self.computes._sync(sim, sim._cpp_sys.computes)
         if not self.writers._synced:
             self.writers._sync(sim, sim._cpp_sys.analyzers)
+        if sim._checkpoint_state is not None:
+            # restore the operations after all have attached
+            sim._checkpoint_state.restore(self)
+            sim._checkpoint_state = None
         self._scheduled = True
 
     def _unschedule(self):
@@ -392,6 +418,21 @@ class Operations(Collection):
         for op in self:
             op.tune_kernel_parameters()
 
+    def _objects(self):
+        """Map paths to all operations and their children.
+
+        Paths name the position of the object, such as ``'tuners/0'`` or
+        ``'integrator/methods/1/thermostat'``. Simulations with the same
+        operations added in the same order have the same paths.
+        """
+        objects = {}
+        if self._integrator is not None:
+            objects.update(_walk('integrator', self._integrator))
+        for name in ('tuners', 'updaters', 'computes', 'writers'):
+            for i, operation in enumerate(getattr(self, name)):
+                objects.update(_walk(f'{name}/{i}', operation))
+        return objects
+
     def __getstate__(self):
         """Get the current state of the operations container for pickling."""
         # ensure that top level changes to self.__dict__ are not propagated
@@ -37,6 +37,13 @@ def test_balance_properties():
     balance.max_iterations = 5
     assert balance.max_iterations == 5
 
+    assert balance.metric == 'particles'
+    balance.metric = 'time'
+    assert balance.metric == 'time'
+
+    with pytest.raises(ValueError):
+        balance.metric = 'energy'
+
 
 def test_attach_detach(simulation_factory, lattice_snapshot_factory):
     snapshot = lattice_snapshot_factory()
@@ -75,6 +82,12 @@ def test_attach_detach(simulation_factory, lattice_snapshot_factory):
     balance.max_iterations = 5
     assert balance.max_iterations == 5
 
+    assert balance.metric == 'particles'
+    balance.metric = 'time'
+    assert balance.metric == 'time'
+    sim.run(3)
+    assert balance.imbalance >= 1.0
+
     sim.operations.tuners.remove(balance)
 
 
@@ -114,3 +127,34 @@ def test_balance_action(device, simulation_factory, lattice_snapshot_factory):
 
     # the load balance should move the split place down toward the particles
     assert sim.state.domain_decomposition_split_fractions[2][0] < 0.5
+
+
+def test_balance_action_time(device, simulation_factory,
+                             lattice_snapshot_factory):
+    """Test that the time metric balances the measured pair force cost."""
+    if device.communicator.num_ranks != 2:
+        pytest.skip("Test supports only 2 ranks")
+
+    snapshot = lattice_snapshot_factory()
+
+    box = list(snapshot.configuration.box)
+    if snapshot.communicator.rank == 0:
+        snapshot.particles.position[:, 2] -= box[2] / 2
+    box[2] *= 2
+    snapshot.configuration.box = box
+    sim = simulation_factory(snapshot, domain_decomposition=(1, 1, 2))
+
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    lj = hoomd.md.pair.LJ(nlist=nlist)
+    lj.params[('A', 'A')] = dict(epsilon=1.0, sigma=1.0)
+    lj.r_cut[('A', 'A')] = 2.5
+    sim.operations.integrator = hoomd.md.Integrator(dt=0.005, forces=[lj])
+
+    balance = hoomd.tune.LoadBalancer(trigger=hoomd.trigger.Periodic(5),
+                                      metric='time')
+    sim.operations.tuners.append(balance)
+    sim.run(11)
+
+    # all of the compute time is spent on the lower domain
+    assert balance.imbalance > 1.0
+    assert sim.state.domain_decomposition_split_fractions[2][0] < 0.5
@@ -0,0 +1,84 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import hoomd
+import numpy as np
+import pytest
+
+
+@pytest.fixture
+def thermo_logger():
+    thermo = hoomd.md.compute.ThermodynamicQuantities(
+        filter=hoomd.filter.All())
+    logger = hoomd.logging.Logger(
+        categories=hoomd.write.BufferedLog.accepted_categories)
+    logger.add(
+        thermo,
+        quantities=['kinetic_energy', 'num_particles', 'pressure_tensor'])
+    return thermo, logger
+
+
+def test_invalid_categories(tmp_path):
+    logger = hoomd.logging.Logger(categories=['scalar', 'string'])
+    with pytest.raises(ValueError):
+        hoomd.write.BufferedLog(trigger=1,
+                                filename=tmp_path / 'log.gsd',
+                                logger=logger)
+
+
+def test_unattached_operation(simulation_factory,
+                              two_particle_snapshot_factory, tmp_path,
+                              thermo_logger):
+    thermo, logger = thermo_logger
+    sim = simulation_factory(two_particle_snapshot_factory())
+    buffered_log = hoomd.write.BufferedLog(trigger=1,
+                                           filename=tmp_path / 'log.gsd',
+                                           logger=logger)
+    sim.operations.writers.append(buffered_log)
+    with pytest.raises(RuntimeError):
+        sim.run(0)
+
+
+@pytest.mark.parametrize('buffer_size', [1, 3, 100])
+def test_write(simulation_factory, two_particle_snapshot_factory, tmp_path,
+               thermo_logger, buffer_size):
+    gsd_hoomd = pytest.importorskip('gsd.hoomd')
+    filename = tmp_path / 'log.gsd'
+
+    thermo, logger = thermo_logger
+    sim = simulation_factory(two_particle_snapshot_factory())
+    sim.operations.integrator = hoomd.md.Integrator(
+        dt=0.005,
+        methods=[hoomd.md.methods.ConstantVolume(filter=hoomd.filter.All())])
+    sim.operations.computes.append(thermo)
+    buffered_log = hoomd.write.BufferedLog(trigger=2,
+                                           filename=filename,
+                                           logger=logger,
+                                           mode='wb',
+                                           buffer_size=buffer_size)
+    sim.operations.writers.append(buffered_log)
+
+    sim.run(10)
+    kinetic_energy = thermo.kinetic_energy
+    buffered_log.flush()
+
+    if sim.device.communicator.rank == 0:
+        log = gsd_hoomd.read_log(filename)
+        np.testing.assert_array_equal(log['configuration/step'],
+                                      [0, 2, 4, 6, 8])
+        np.testing.assert_array_equal(
+            log['log/md/compute/ThermodynamicQuantities/num_particles'],
+            [2, 2, 2, 2, 2])
+        assert log['log/md/compute/ThermodynamicQuantities/pressure_tensor'] \
+            .shape == (5, 6)
+
+    sim.run(1)
+    buffered_log.flush()
+
+    if sim.device.communicator.rank == 0:
+        log = gsd_hoomd.read_log(filename)
+        np.testing.assert_array_equal(log['configuration/step'],
+                                      [0, 2, 4, 6, 8, 10])
+        np.testing.assert_allclose(
+            log['log/md/compute/ThermodynamicQuantities/kinetic_energy'][-1],
+            kinetic_energy)
@@ -2,6 +2,7 @@
 # Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 import hoomd
+import numpy
 import pytest
 import time
 try:
@@ -77,3 +78,48 @@ def test_communicator_mpi4py():
     communicator = hoomd.communicator.Communicator(mpi_comm=MPI.COMM_WORLD)
     assert world_communicator.num_ranks == communicator.num_ranks
     assert world_communicator.rank == communicator.rank
+
+
+def test_communicator_exchange(simulation_factory, lattice_snapshot_factory):
+    """Check that all ghost communication modes produce the same trajectory."""
+    communicator = hoomd.communicator.Communicator()
+    assert communicator.exchange == 'staged'
+    with pytest.raises(ValueError):
+        communicator.exchange = 'direct'
+
+    positions = {}
+    for exchange, shared_memory_ghosts in (('staged', False),
+                                           ('neighbor', False),
+                                           ('staged', True)):
+        sim = simulation_factory(
+            lattice_snapshot_factory(n=10, a=1.5, r=0.1))
+        sim.device.communicator.exchange = exchange
+        sim.device.communicator.shared_memory_ghosts = shared_memory_ghosts
+
+        nlist = hoomd.md.nlist.Cell(buffer=0.4)
+        lj = hoomd.md.pair.LJ(nlist=nlist, default_r_cut=2.5)
+        lj.params[('A', 'A')] = dict(epsilon=1, sigma=1)
+        nve = hoomd.md.methods.ConstantVolume(filter=hoomd.filter.All())
+        sim.operations.integrator = hoomd.md.Integrator(dt=0.005,
+                                                        methods=[nve],
+                                                        forces=[lj])
+        sim.state.thermalize_particle_momenta(filter=hoomd.filter.All(),
+                                              kT=1.0)
+        sim.run(100)
+
+        snapshot = sim.state.get_snapshot()
+        if snapshot.communicator.rank == 0:
+            positions[(exchange, shared_memory_ghosts)] = \
+                snapshot.particles.position.copy()
+
+    sim.device.communicator.exchange = 'staged'
+    sim.device.communicator.shared_memory_ghosts = False
+
+    if sim.device.communicator.rank == 0:
+        reference = positions[('staged', False)]
+        numpy.testing.assert_allclose(positions[('neighbor', False)],
+                                      reference,
+                                      atol=1e-4)
+        numpy.testing.assert_allclose(positions[('staged', True)],
+                                      reference,
+                                      atol=1e-4)
@@ -2,6 +2,9 @@
 # Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 import hoomd
+from hoomd.conftest import logging_check
+from hoomd.logging import LoggerCategories
+import json
 import pytest
 
 
@@ -162,3 +165,114 @@ def test_noticefile(device, tmp_path):
     if device.communicator.rank == 0:
         with open(device.message_filename) as fh:
             assert fh.read() == ""
+
+
+def test_profiler(simulation_factory, lattice_snapshot_factory, tmp_path):
+    sim = simulation_factory(lattice_snapshot_factory())
+    filter_updater = hoomd.update.FilterUpdater(
+        trigger=hoomd.trigger.Periodic(1), filters=[hoomd.filter.All()])
+    sim.operations.updaters.append(filter_updater)
+
+    profiler = sim.device.profiler
+    assert sim.device.profiler is profiler
+    assert not profiler.enabled
+
+    # nothing is recorded when disabled
+    profiler.reset()
+    sim.run(5)
+    assert profiler.totals == {}
+
+    profiler.enabled = True
+    try:
+        sim.run(10)
+
+        name = 'hoomd::ParticleFilterUpdater'
+        assert profiler.counts[name] == 10
+        assert profiler.totals[name] >= 0
+        assert profiler.min_totals[name] <= profiler.totals[name]
+        assert profiler.max_totals[name] >= profiler.totals[name]
+
+        profiler.trace_capacity = 4
+        assert profiler.trace_capacity == 4
+        assert profiler.totals == {}
+        sim.run(10)
+
+        # the threads record into new buffers after a reset
+        assert profiler.counts[name] == 10
+
+        filename = tmp_path / 'trace.json'
+        profiler.write_trace(filename)
+
+        if sim.device.communicator.rank == 0:
+            with open(filename) as f:
+                trace = json.load(f)
+            events = trace['traceEvents']
+            assert 0 < len(events) <= 4 * sim.device.communicator.num_ranks
+            assert all(event['ph'] == 'X' for event in events)
+    finally:
+        profiler.enabled = False
+        profiler.reset()
+
+
+def test_memory_registry_logging():
+    logging_check(
+        hoomd.device.MemoryRegistry, ('device',), {
+            'allocated': {
+                'category': LoggerCategories.object,
+                'default': True
+            },
+            'used': {
+                'category': LoggerCategories.object,
+                'default': True
+            },
+            'peak': {
+                'category': LoggerCategories.object,
+                'default': True
+            },
+            'total_allocated': {
+                'category': LoggerCategories.scalar,
+                'default': True
+            },
+            'total_used': {
+                'category': LoggerCategories.scalar,
+                'default': True
+            }
+        })
+
+
+def test_memory_registry(simulation_factory, lattice_snapshot_factory):
+    sim = simulation_factory(lattice_snapshot_factory(n=6, a=1.5))
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    lj = hoomd.md.pair.LJ(nlist=nlist, default_r_cut=2.5)
+    lj.params[('A', 'A')] = dict(epsilon=1, sigma=1)
+    method = hoomd.md.methods.ConstantVolume(filter=hoomd.filter.All())
+    sim.operations.integrator = hoomd.md.Integrator(dt=0.001,
+                                                    methods=[method],
+                                                    forces=[lj])
+    sim.run(5)
+
+    memory = sim.device.memory
+    assert sim.device.memory is memory
+
+    allocated = memory.allocated
+    used = memory.used
+    peak = memory.peak
+    assert 'hoomd::ParticleData' in allocated
+    nlist_name = [name for name in allocated if 'NeighborList' in name][0]
+    assert any('PotentialPair' in name for name in allocated)
+    for name in allocated:
+        assert used[name] <= allocated[name] <= peak[name]
+    assert allocated[nlist_name] > 0
+    assert memory.total_allocated == sum(allocated.values())
+    assert memory.total_used == sum(used.values())
+
+    memory.trim()
+    trimmed = memory.allocated
+    for name in allocated:
+        assert trimmed[name] <= allocated[name]
+        assert memory.peak[name] == peak[name]
+    assert trimmed[nlist_name] >= memory.used[nlist_name]
+
+    # the arrays grow again as needed
+    sim.run(5)
+    assert memory.used[nlist_name] <= memory.allocated[nlist_name]
@@ -116,3 +116,74 @@ def test_pickling(simulation):
     ]
     hoomd.conftest.operation_pickling_check(
         hoomd.update.FilterUpdater(1, filters), simulation)
+
+
+def test_member_count(simulation, filter_updater):
+    simulation.operations += filter_updater
+    simulation.run(0)
+    type_filter = hoomd.filter.Type(["A"])
+    group = simulation.state._get_group(type_filter)
+
+    with simulation.state.cpu_local_snapshot as snapshot:
+        snapshot.particles.typeid[::2] = 1
+    simulation.run(1)
+
+    member_tags = group.member_tags
+    assert group.getNumMembersGlobal() == len(member_tags)
+
+    snapshot = simulation.state.get_snapshot()
+    if snapshot.communicator.rank == 0:
+        n_type_a = np.count_nonzero(snapshot.particles.typeid == 0)
+        assert group.getNumMembersGlobal() == n_type_a
+        assert set(member_tags) == set(
+            np.flatnonzero(snapshot.particles.typeid == 0))
+
+
+class _EvenTags(hoomd.filter.CustomFilter):
+    """Select the even tags, returning the global list on every rank."""
+
+    def __init__(self, N):
+        self._N = N
+
+    def __call__(self, state):
+        return np.arange(0, self._N, 2, dtype=np.uint32)
+
+    def __hash__(self):
+        return hash((self.__class__.__name__, self._N))
+
+    def __eq__(self, other):
+        return isinstance(other, _EvenTags) and self._N == other._N
+
+
+def test_member_count_global_tags(simulation):
+    """Filters may return tags owned by other ranks."""
+    n_particles = simulation.state.N_particles
+    tags = list(range(0, n_particles, 3))
+    filters = [hoomd.filter.Tags(tags), _EvenTags(n_particles)]
+    expected = [set(tags), set(range(0, n_particles, 2))]
+    groups = [simulation.state._get_group(f) for f in filters]
+
+    simulation.operations += hoomd.update.FilterUpdater(1, filters)
+    for _ in range(2):
+        simulation.run(1)
+        for group, expected_tags in zip(groups, expected):
+            assert group.getNumMembersGlobal() == len(expected_tags)
+            assert set(group.member_tags) == expected_tags
+
+
+def test_static_group_set_snapshot(simulation):
+    snapshot = simulation.state.get_snapshot()
+    if snapshot.communicator.rank == 0:
+        snapshot.particles.velocity[:] = [1, 0, 0]
+    simulation.state.set_snapshot(snapshot)
+
+    # the group does not update, so it keeps its members across snapshots
+    thermo = hoomd.md.compute.ThermodynamicQuantities(hoomd.filter.Type(["A"]))
+    simulation.operations.computes.append(thermo)
+    simulation.run(1)
+    n_particles = simulation.state.N_particles
+    assert thermo.kinetic_energy == pytest.approx(0.5 * n_particles)
+
+    simulation.state.set_snapshot(simulation.state.get_snapshot())
+    simulation.run(1)
+    assert thermo.kinetic_energy == pytest.approx(0.5 * n_particles)
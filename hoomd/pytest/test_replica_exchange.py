@@ -0,0 +1,92 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Test hoomd.update.ReplicaExchange."""
+
+import hoomd
+import pytest
+
+
+def test_construction():
+    """Test that ReplicaExchange stores the constructor arguments."""
+    kT = hoomd.variant.Constant(1.0)
+    replica_exchange = hoomd.update.ReplicaExchange(trigger=10,
+                                                    parameter=kT,
+                                                    ladder=[1.0, 1.5])
+
+    assert replica_exchange.parameter is kT
+    assert replica_exchange.ladder == (1.0, 1.5)
+    assert replica_exchange.observable == 'potential_energy'
+    assert replica_exchange.rescale_velocities
+
+    replica_exchange.rescale_velocities = False
+    assert not replica_exchange.rescale_velocities
+
+    with pytest.raises(TypeError):
+        hoomd.update.ReplicaExchange(trigger=10,
+                                     parameter=hoomd.variant.Ramp(0, 1, 0, 10),
+                                     ladder=[1.0, 1.5])
+
+    with pytest.raises(ValueError):
+        hoomd.update.ReplicaExchange(trigger=10,
+                                     parameter=kT,
+                                     ladder=[1.0, 1.5],
+                                     observable='pressure')
+
+
+def test_single_partition(simulation_factory, two_particle_snapshot_factory):
+    """Test that ReplicaExchange requires more than one partition."""
+    sim = simulation_factory(two_particle_snapshot_factory())
+    if sim.device.communicator.num_partitions > 1:
+        pytest.skip("Test requires a single partition.")
+
+    replica_exchange = hoomd.update.ReplicaExchange(
+        trigger=1,
+        parameter=hoomd.variant.Constant(1.0),
+        ladder=[1.0],
+        observable='volume')
+    sim.operations.updaters.append(replica_exchange)
+
+    with pytest.raises(RuntimeError):
+        sim.run(0)
+
+
+@pytest.mark.skipif(not hoomd.version.mpi_enabled,
+                    reason='This test requires MPI')
+def test_exchange_volume(two_particle_snapshot_factory):
+    """Test that replicas with equal volumes always exchange."""
+    world_communicator = hoomd.communicator.Communicator()
+    if world_communicator.num_ranks != 2:
+        pytest.skip("Test requires 2 MPI ranks.")
+
+    communicator = hoomd.communicator.Communicator(ranks_per_partition=1)
+    device = hoomd.device.CPU(communicator=communicator)
+    sim = hoomd.Simulation(device=device, seed=communicator.partition)
+
+    snapshot = hoomd.Snapshot(communicator)
+    if snapshot.communicator.rank == 0:
+        snapshot.configuration.box = [10, 10, 10, 0, 0, 0]
+        snapshot.particles.N = 1
+        snapshot.particles.types = ['A']
+    sim.create_state_from_snapshot(snapshot)
+
+    betaP = hoomd.variant.Constant(0)
+    ladder = [1.0, 2.0]
+    replica_exchange = hoomd.update.ReplicaExchange(trigger=1,
+                                                    parameter=betaP,
+                                                    ladder=ladder,
+                                                    observable='volume')
+    sim.operations.updaters.append(replica_exchange)
+    sim.run(0)
+
+    assert betaP.value == ladder[communicator.partition]
+    assert replica_exchange.replica_index == communicator.partition
+
+    # the first attempt swaps the pair (0, 1), the second attempts no pairs
+    sim.run(2)
+    assert replica_exchange.replica_index == 1 - communicator.partition
+    assert betaP.value == ladder[1 - communicator.partition]
+    assert replica_exchange.permutation == (1, 0)
+    assert replica_exchange.attempted == (1,)
+    assert replica_exchange.accepted == (1,)
+    assert replica_exchange.acceptance == (1.0,)
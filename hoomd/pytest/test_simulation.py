@@ -280,6 +280,56 @@ def test_state_from_gsd_box_dims(device, simulation_factory,
         assert sim.state.box.yz == 0.0
 
 
+@skip_gsd
+def test_state_from_gsd_particle_properties(device, simulation_factory,
+                                            lattice_snapshot_factory,
+                                            tmp_path):
+    """Check that every rank reads its block of particles correctly."""
+    snap = lattice_snapshot_factory(n=7, particle_types=['A', 'B', 'C'])
+    if snap.communicator.rank == 0:
+        N = snap.particles.N
+        rng = np.random.default_rng(1)
+        snap.particles.typeid[:] = rng.integers(0, 3, size=N)
+        snap.particles.mass[:] = rng.uniform(1, 2, size=N)
+        snap.particles.charge[:] = rng.uniform(-1, 1, size=N)
+        snap.particles.diameter[:] = rng.uniform(0.5, 1, size=N)
+        snap.particles.velocity[:] = rng.normal(size=(N, 3))
+        snap.particles.image[:] = rng.integers(-3, 3, size=(N, 3))
+        snap.bonds.N = N - 1
+        snap.bonds.types = ['bond']
+        snap.bonds.group[:] = [[i, i + 1] for i in range(N - 1)]
+
+    filename = tmp_path / "particle_properties.gsd"
+    if device.communicator.rank == 0:
+        with gsd.hoomd.open(name=filename, mode='w') as f:
+            f.append(make_gsd_frame(snap))
+
+    sim = simulation_factory()
+    sim.create_state_from_gsd(filename)
+    assert sim.state.N_particles == 7**3
+    assert_equivalent_snapshots(snap, sim.state.get_snapshot())
+
+
+@skip_gsd
+def test_state_from_gsd_large_chunks(device, simulation_factory,
+                                     lattice_snapshot_factory, tmp_path):
+    """Check reading chunks large enough to be memory mapped in blocks."""
+    snap = lattice_snapshot_factory(n=76)
+    if snap.communicator.rank == 0:
+        rng = np.random.default_rng(2)
+        snap.particles.velocity[:] = rng.normal(size=(snap.particles.N, 3))
+
+    filename = tmp_path / "large_chunks.gsd"
+    if device.communicator.rank == 0:
+        with gsd.hoomd.open(name=filename, mode='w') as f:
+            f.append(make_gsd_frame(snap))
+
+    sim = simulation_factory()
+    sim.create_state_from_gsd(filename)
+    assert sim.state.N_particles == 76**3
+    assert_equivalent_snapshots(snap, sim.state.get_snapshot())
+
+
 @skip_gsd
 def test_state_from_gsd_frame(simulation_factory, lattice_snapshot_factory,
                               device, state_args, tmp_path):
@@ -438,6 +488,88 @@ def test_seed_constructor_out_of_range(device, lattice_snapshot_factory):
     assert sim.seed == 0xcdef
 
 
+def test_tuning_cache(device, lattice_snapshot_factory, tmp_path):
+    filename = tmp_path / 'tuning.json'
+    sim = hoomd.Simulation(device, tuning_cache=filename)
+    assert sim.tuning_cache == str(filename)
+    sim.create_state_from_snapshot(lattice_snapshot_factory(n=5))
+    sorter = sim.operations.tuners[0]
+    sorter.grid = 32
+    sim.run(1)
+    sorter.grid = 64
+    sim.run(1)
+    if device.communicator.rank == 0:
+        assert filename.exists()
+
+    # a new simulation of the same size applies the cached values
+    sim = hoomd.Simulation(device, tuning_cache=filename)
+    sim.create_state_from_snapshot(lattice_snapshot_factory(n=5))
+    sim.run(0)
+    assert sim.operations.tuners[0].grid == 64
+
+    # values set after the first run are kept
+    sim.operations.tuners[0].grid = 128
+    sim.run(0)
+    assert sim.operations.tuners[0].grid == 128
+
+    # a system of a different size does not
+    sim = hoomd.Simulation(device, tuning_cache=filename)
+    sim.create_state_from_snapshot(lattice_snapshot_factory(n=10))
+    sim.run(0)
+    assert sim.operations.tuners[0].grid != 64
+
+    assert hoomd.Simulation(device).tuning_cache is None
+
+
+def test_tuning_cache_damaged(device, lattice_snapshot_factory, tmp_path):
+    filename = tmp_path / 'tuning.json'
+    if device.communicator.rank == 0:
+        filename.write_text('{"not json')
+
+    with pytest.warns(RuntimeWarning):
+        sim = hoomd.Simulation(device, tuning_cache=filename)
+    sim.create_state_from_snapshot(lattice_snapshot_factory(n=5))
+    sim.operations.tuners[0].grid = 64
+    sim.run(1)
+
+    # the damaged file is replaced
+    sim = hoomd.Simulation(device, tuning_cache=filename)
+    sim.create_state_from_snapshot(lattice_snapshot_factory(n=5))
+    sim.run(0)
+    assert sim.operations.tuners[0].grid == 64
+
+
+@pytest.mark.gpu
+def test_tuning_cache_kernel_parameters(device, lattice_snapshot_factory,
+                                        tmp_path):
+    filename = tmp_path / 'tuning.json'
+
+    def make_simulation():
+        sim = hoomd.Simulation(device, tuning_cache=filename)
+        sim.create_state_from_snapshot(
+            lattice_snapshot_factory(n=7, a=1.7, r=0.01))
+        nlist = hoomd.md.nlist.Cell(buffer=0.4)
+        lj = hoomd.md.pair.LJ(nlist=nlist, default_r_cut=2.5)
+        lj.params[('A', 'A')] = dict(epsilon=1.0, sigma=1.0)
+        method = hoomd.md.methods.ConstantVolume(filter=hoomd.filter.All())
+        sim.operations.integrator = hoomd.md.Integrator(dt=0.005,
+                                                        methods=[method],
+                                                        forces=[lj])
+        return sim
+
+    sim = make_simulation()
+    sim.run(0)
+    while not sim.operations.is_tuning_complete:
+        sim.run(1000)
+        if sim.timestep > 100_000:
+            raise RuntimeError("Tuning is not completing as expected.")
+
+    # a second simulation starts with the tuned kernel parameters
+    sim = make_simulation()
+    sim.run(0)
+    assert sim.operations.is_tuning_complete
+
+
 def test_operations_setting(tmp_path, simulation_factory,
                             lattice_snapshot_factory):
     sim = simulation_factory()
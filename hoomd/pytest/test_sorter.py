@@ -5,6 +5,7 @@
 
 from hoomd.conftest import operation_pickling_check
 import hoomd
+import numpy
 
 
 def test_attributes():
@@ -44,3 +45,45 @@ def test_pickling(simulation_factory, two_particle_snapshot_factory):
     # simulation
     sorter = sim.operations.tuners.pop()
     operation_pickling_check(sorter, sim)
+
+
+def test_incremental(simulation_factory, lattice_snapshot_factory, device):
+    """Test that incremental sorting matches the full sort."""
+    snapshot = lattice_snapshot_factory(n=8, a=1.2, r=0.1)
+    if snapshot.communicator.rank == 0:
+        rng = numpy.random.default_rng(4)
+        snapshot.particles.velocity[:] = rng.normal(
+            size=(snapshot.particles.N, 3))
+
+    results = []
+    for incremental in (False, True):
+        sim = simulation_factory(snapshot)
+        sorter = sim.operations.tuners[0]
+        sorter.trigger = hoomd.trigger.Periodic(1)
+        sorter.incremental = incremental
+
+        group = hoomd.filter.Tags(list(range(0, 512, 3)))
+        thermo = hoomd.md.compute.ThermodynamicQuantities(filter=group)
+        sim.operations.computes.append(thermo)
+        sim.operations.integrator = hoomd.md.Integrator(
+            dt=0.005, methods=[hoomd.md.methods.ConstantVolume(group)])
+        sim.run(50)
+
+        assert sorter.incremental == incremental
+        tags = None
+        if isinstance(device, hoomd.device.CPU):
+            with sim.state.cpu_local_snapshot as data:
+                tags = numpy.array(data.particles.tag, copy=True)
+        results.append((sim.state.get_snapshot(), thermo.kinetic_energy, tags))
+
+    (snap_full, ke_full, tags_full) = results[0]
+    (snap_incremental, ke_incremental, tags_incremental) = results[1]
+    numpy.testing.assert_allclose(ke_incremental, ke_full)
+    # particles in the same bin must be stored in the same order
+    if tags_full is not None:
+        numpy.testing.assert_array_equal(tags_incremental, tags_full)
+    if snap_full.communicator.rank == 0:
+        numpy.testing.assert_allclose(snap_incremental.particles.position,
+                                      snap_full.particles.position)
+        numpy.testing.assert_allclose(snap_incremental.particles.velocity,
+                                      snap_full.particles.velocity)
@@ -320,3 +320,44 @@ def test_domain_decomposition(device, simulation_factory,
                                                                   [0.25])
     else:
         raise RuntimeError("Test only supports 1 and 2 ranks")
+
+
+def test_domain_decomposition_bisection(device, simulation_factory,
+                                        lattice_snapshot_factory):
+    if isinstance(device, hoomd.device.GPU):
+        pytest.skip("Recursive bisection runs only on the CPU")
+
+    snapshot = lattice_snapshot_factory(n=10, a=1.5)
+
+    # place all particles in the lower half of the box along z
+    box = list(snapshot.configuration.box)
+    if snapshot.communicator.rank == 0:
+        snapshot.particles.position[:, 2] -= box[2] / 2
+    box[2] *= 2
+    snapshot.configuration.box = box
+
+    sim = simulation_factory(snapshot, domain_decomposition='bisection')
+    if device.communicator.num_ranks == 1:
+        assert sim.state.domain_decomposition == (1, 1, 1)
+    else:
+        assert sim.state.domain_decomposition == 'bisection'
+        assert sim.state.domain_decomposition_split_fractions == ([], [], [])
+
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    lj = hoomd.md.pair.LJ(nlist=nlist)
+    lj.params[('A', 'A')] = dict(epsilon=1.0, sigma=1.0)
+    lj.r_cut[('A', 'A')] = 2.5
+    sim.operations.integrator = hoomd.md.Integrator(
+        dt=0.005,
+        methods=[hoomd.md.methods.ConstantVolume(filter=hoomd.filter.All())],
+        forces=[lj])
+    sim.run(10)
+
+    # every rank owns a share of the slab
+    with sim.state.cpu_local_snapshot as data:
+        assert len(data.particles.tag) > 0
+
+    assert sim.state.N_particles == 10**3
+
+    with pytest.raises(ValueError):
+        simulation_factory(snapshot, domain_decomposition='grid')
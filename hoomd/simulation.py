@@ -24,6 +24,7 @@ from hoomd.logging import log, Loggable
 from hoomd.state import State
 from hoomd.snapshot import Snapshot
 from hoomd.operations import Operations
+from hoomd.tune.cache import _TuningCache
 import hoomd
 
 TIMESTEP_MAX = 2**64 - 1
@@ -36,6 +37,8 @@ class Simulation(metaclass=Loggable):
     Args:
         device (hoomd.device.Device): Device to execute the simulation.
         seed (int): Random number seed.
+        tuning_cache (str): File that stores tuning results across runs.
+            Defaults to `None`, which disables the cache.
 
     `Simulation` is the central class that defines a simulation, including the
     `state` of the system, the `operations` that apply to the state during a
@@ -48,20 +51,52 @@ class Simulation(metaclass=Loggable):
     `create_state_from_gsd` or `create_state_from_snapshot` to initialize the
     simulation's `state`.
 
+    .. rubric:: Tuning cache
+
+    At the start of every run, autotuned operations scan the GPU kernel
+    parameters (see `hoomd.operation.AutotunedObject`) to find the fastest.
+    Set `tuning_cache` to skip the scan in jobs that repeat a system that was
+    already tuned. `Simulation` reads the file on construction. At the start
+    of each `run`, it sets the cached kernel parameters on each operation. It
+    also sets the cached values of `hoomd.tune.ParticleSorter.grid` and
+    `hoomd.md.nlist.NeighborList.buffer`, which tuners such as
+    `hoomd.md.tune.NeighborListBuffer` may change. At the end of each `run`,
+    it stores the results of completed scans and the current values of these
+    parameters in the file.
+
+    Entries in the file are keyed by the HOOMD-blue version and build
+    configuration, the device, the number of MPI ranks and CPU threads, and
+    the number of particles rounded down to a power of two. Within an entry,
+    each operation is keyed by its position in `operations` and its type. Add
+    the same operations in the same order to reuse the cached values.
+
+    Many jobs may share one `tuning_cache` file. The root rank reads the file
+    and replaces it atomically when writing.
+
     .. rubric:: Example:
 
     .. code-block:: python
 
         simulation = hoomd.Simulation(device=hoomd.device.CPU(), seed=1)
+
+    .. code-block:: python
+
+        simulation = hoomd.Simulation(device=hoomd.device.CPU(),
+                                      seed=1,
+                                      tuning_cache=tmp_path / 'tuning.json')
     """
 
-    def __init__(self, device, seed=None):
+    def __init__(self, device, seed=None, tuning_cache=None):
         self._device = device
         self._state = None
         self._operations = Operations()
         self._operations._simulation = self
         self._timestep = None
         self._seed = None
+        self._checkpoint_state = None
+        self._tuning_cache = None
+        if tuning_cache is not None:
+            self._tuning_cache = _TuningCache(tuning_cache, device)
         if seed is not None:
             self.seed = seed
 
@@ -75,6 +110,22 @@ class Simulation(metaclass=Loggable):
         raise ValueError("Device cannot be removed or replaced once in "
                          "Simulation object.")
 
+    @property
+    def tuning_cache(self):
+        """str: File that stores tuning results across runs (*read-only*).
+
+        `None` when the cache is disabled.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            tuning_cache = simulation.tuning_cache
+        """
+        if self._tuning_cache is None:
+            return None
+        return self._tuning_cache.filename
+
     @log
     def timestep(self):
         """int: The current simulation time step.
@@ -203,11 +254,19 @@ class Simulation(metaclass=Loggable):
                 the x, y, and z directions (e.g. ``(8,4,2)``). Provide a tuple
                 of 3 lists of floats to set the fraction of the simulation box
                 to include in each domain. The sum of each list of floats must
-                be 1.0 (e.g. ``([0.25, 0.75], [0.2, 0.8], [1.0])``).
+                be 1.0 (e.g. ``([0.25, 0.75], [0.2, 0.8], [1.0])``). Provide
+                ``'bisection'`` to split the box into domains of equal particle
+                count by recursive bisection (see `State`).
 
         When `timestep` is `None` before calling, `create_state_from_gsd`
         sets `timestep` to the value in the selected GSD frame in the file.
 
+        In MPI simulations, every rank reads a contiguous block of the
+        particles from the file and sends each particle to the rank that owns
+        its domain. No rank holds the whole particle data in memory, but all
+        ranks must be able to read the file. The root rank reads the bonds,
+        angles, dihedrals, impropers, constraints, and pairs.
+
         Note:
             Set any or all of the ``domain_decomposition`` tuple elements to
             `None` and `create_state_from_gsd` will select a value that
@@ -225,20 +284,92 @@ class Simulation(metaclass=Loggable):
         """
         if self._state is not None:
             raise RuntimeError("Cannot initialize more than once\n")
-        filename = _hoomd.mpi_bcast_str(filename, self.device._cpp_exec_conf)
+        reader = self._open_gsd(filename, frame)
+        self._create_state_from_gsd_reader(reader, domain_decomposition)
+
+    def _open_gsd(self, filename, frame):
+        """Open a GSD file and read the particles in the given frame."""
+        filename = _hoomd.mpi_bcast_str(str(filename),
+                                        self.device._cpp_exec_conf)
+        # With more than one rank, every rank reads a block of the particles
+        distributed = (hoomd.version.mpi_enabled
+                       and self.device.communicator.num_ranks > 1)
+        return _hoomd.GSDReader(self.device._cpp_exec_conf, filename,
+                                abs(frame), frame < 0, distributed)
+
+    def _create_state_from_gsd_reader(self, reader, domain_decomposition):
+        """Create the simulation state from an open GSD reader."""
         # Grab snapshot and timestep
-        reader = _hoomd.GSDReader(self.device._cpp_exec_conf, filename,
-                                  abs(frame), frame < 0)
         snapshot = Snapshot._from_cpp_snapshot(reader.getSnapshot(),
                                                self.device.communicator)
 
         step = reader.getTimeStep() if self.timestep is None else self.timestep
-        self._state = State(self, snapshot, domain_decomposition)
+        self._state = State(self,
+                            snapshot,
+                            domain_decomposition,
+                            _gsd_reader=reader)
 
         reader.clearSnapshot()
 
         self._init_system(step)
 
+    def create_state_from_checkpoint(self,
+                                     filename,
+                                     domain_decomposition=(None, None, None)):
+        """Create the simulation state from a checkpoint file.
+
+        Args:
+            filename (str): Checkpoint file written by
+                `hoomd.write.Checkpoint`.
+
+            domain_decomposition (tuple): Choose how to distribute the state
+                across MPI ranks with domain decomposition (see
+                `create_state_from_gsd`).
+
+        `create_state_from_checkpoint` reads the particle data like
+        `create_state_from_gsd` and sets `seed` to the value in the
+        checkpoint. When `timestep` is `None` before calling,
+        `create_state_from_checkpoint` sets `timestep` to the value in the
+        checkpoint.
+
+        After calling `create_state_from_checkpoint`, add the same operations
+        in the same order as the simulation that wrote the checkpoint. The
+        first call to `run` restores the state of the operations, such as the
+        thermostat degrees of freedom and the tuned HPMC move sizes, and
+        raises `RuntimeError` when the operations do not match the
+        checkpoint.
+
+        .. rubric:: Example:
+
+        .. invisible-code-block: python
+
+            simulation = hoomd.util.make_example_simulation()
+            checkpoint_filename = tmp_path / 'checkpoint.gsd'
+            checkpoint = hoomd.write.Checkpoint(
+                trigger=hoomd.trigger.Periodic(1),
+                filename=checkpoint_filename)
+            simulation.operations.writers.append(checkpoint)
+            simulation.run(1)
+            simulation = hoomd.Simulation(device=hoomd.device.CPU())
+
+        .. code-block:: python
+
+            simulation.create_state_from_checkpoint(
+                filename=checkpoint_filename)
+        """
+        if self._state is not None:
+            raise RuntimeError("Cannot initialize more than once\n")
+        reader = self._open_gsd(filename, 0)
+        checkpoint_state = hoomd.write.checkpoint._read_state(
+            reader, self.device._cpp_exec_conf)
+        if checkpoint_state is None:
+            raise RuntimeError(f"{filename} is not a checkpoint file.")
+
+        self._create_state_from_gsd_reader(reader, domain_decomposition)
+        if checkpoint_state.seed is not None:
+            self.seed = checkpoint_state.seed
+        self._checkpoint_state = checkpoint_state
+
     def create_state_from_snapshot(self,
                                    snapshot,
                                    domain_decomposition=(None, None, None)):
@@ -255,7 +386,9 @@ class Simulation(metaclass=Loggable):
                 the x, y, and z directions (e.g. ``(8,4,2)``). Provide a tuple
                 of 3 lists of floats to set the fraction of the simulation box
                 to include in each domain. The sum of each list of floats must
-                be 1.0 (e.g. ``([0.25, 0.75], [0.2, 0.8], [1.0])``).
+                be 1.0 (e.g. ``([0.25, 0.75], [0.2, 0.8], [1.0])``). Provide
+                ``'bisection'`` to split the box into domains of equal particle
+                count by recursive bisection (see `State`).
 
         When `timestep` is `None` before calling, `create_state_from_snapshot`
         sets `timestep` to 0.
@@ -559,8 +692,14 @@ class Simulation(metaclass=Loggable):
             raise ValueError(f"steps must be in the range [0, "
                              f"{TIMESTEP_MAX - 1}]")
 
+        if self._tuning_cache is not None:
+            self._tuning_cache.apply(self)
+
         self._cpp_sys.run(steps_int, write_at_start)
 
+        if self._tuning_cache is not None:
+            self._tuning_cache.update(self)
+
     def __del__(self):
         """Clean up dangling references to simulation."""
         # _operations may not be set, check before unscheduling
@@ -31,6 +31,18 @@ def _create_domain_decomposition(device, box, domain_decomposition):
         domain_decomposition: See Simulation.create_state_from_* for a
           description.
     """
+    if isinstance(domain_decomposition, str):
+        if domain_decomposition != 'bisection':
+            raise ValueError("domain_decomposition must be 'bisection' when "
+                             "given as a string.")
+
+        if (not hoomd.version.mpi_enabled
+                or device.communicator.num_ranks == 1):
+            return None
+
+        return _hoomd.DomainDecomposition(device._cpp_exec_conf, box.getL(),
+                                          'bisection')
+
     if (not isinstance(domain_decomposition, collections.abc.Sequence)
             or len(domain_decomposition) != 3):
         raise TypeError("domain_decomposition must be a length 3 sequence")
@@ -233,6 +245,18 @@ class State:
     between ranks (ghost particles) so that it can compute interactions across
     the boundary.
 
+    Grids of domains leave many ranks nearly empty when the particles fill only
+    part of the box, as in slab and droplet geometries. Create the state with
+    ``domain_decomposition='bisection'`` to split the box by recursive
+    bisection instead: each cut divides a region normal to its longest axis so
+    that both halves hold the same number of particles per rank. The domains
+    are boxes of different sizes that do not form a grid, and each rank
+    communicates with every domain within the ghost layer width. Recursive
+    bisection runs on the CPU and does not support bonded groups, PPPM, MPCD,
+    `hoomd.hpmc.update.MuVT`, or `hoomd.md.update.ReversePerturbationFlow`.
+    `hoomd.tune.LoadBalancer` recomputes the bisection from the current
+    particle positions.
+
     .. rubric:: Accessing Data
 
     Two complementary APIs provide access to the state data: *local* snapshots
@@ -248,14 +272,25 @@ class State:
     .. _Kamberaj 2005: https://dx.doi.org/10.1063/1.1906216
     """
 
-    def __init__(self, simulation, snapshot, domain_decomposition):
+    def __init__(self,
+                 simulation,
+                 snapshot,
+                 domain_decomposition,
+                 _gsd_reader=None):
         self._simulation = simulation
         snapshot._broadcast_box()
         decomposition = _create_domain_decomposition(
             simulation.device, snapshot._cpp_obj._global_box,
             domain_decomposition)
 
-        if decomposition is not None:
+        if (decomposition is not None and _gsd_reader is not None
+                and _gsd_reader.isDistributed()):
+            # every rank holds a block of the particles read from the file
+            self._cpp_sys_def = _hoomd.SystemDefinition(
+                snapshot._cpp_obj, _gsd_reader.getLocalParticles(),
+                _gsd_reader.getFirstTag(), simulation.device._cpp_exec_conf,
+                decomposition)
+        elif decomposition is not None:
             self._cpp_sys_def = _hoomd.SystemDefinition(
                 snapshot._cpp_obj, simulation.device._cpp_exec_conf,
                 decomposition)
@@ -809,6 +844,10 @@ class State:
                 or particle_data.getDomainDecomposition() is None):
             return ([], [], [])
 
+        decomposition = particle_data.getDomainDecomposition()
+        if decomposition.isRecursiveBisection():
+            return ([], [], [])
+
         return tuple([
             list(particle_data.getDomainDecomposition().getCumulativeFractions(
                 dir))[1:-1] for dir in range(3)
@@ -816,14 +855,17 @@ class State:
 
     @property
     def domain_decomposition(self):
-        """tuple(int, int, int): Number of domains in the x, y, and z \
-        directions."""
+        """tuple(int, int, int) | str: Number of domains in the x, y, and z \
+        directions, or ``'bisection'`` for recursive bisection domains."""
         particle_data = self._cpp_sys_def.getParticleData()
 
         if (not hoomd.version.mpi_enabled
                 or particle_data.getDomainDecomposition() is None):
             return (1, 1, 1)
 
+        if particle_data.getDomainDecomposition().isRecursiveBisection():
+            return 'bisection'
+
         return tuple([
             len(particle_data.getDomainDecomposition().getCumulativeFractions(
                 dir)) - 1 for dir in range(3)
@@ -4,6 +4,8 @@
 """Define LoadBalancer."""
 
 from hoomd.data.parameterdicts import ParameterDict
+from hoomd.data.typeconverter import OnlyFrom
+from hoomd.logging import log
 from hoomd.operation import Tuner
 from hoomd import _hoomd
 import hoomd
@@ -21,6 +23,9 @@ class LoadBalancer(Tuner):
         tolerance (float): Load imbalance tolerance.
         max_iterations (int): Maximum number of iterations to
             attempt in a single step.
+        metric (str): The load of a rank. Set to ``'particles'`` to balance
+            the number of particles or ``'time'`` to balance the measured
+            compute time.
 
     `LoadBalancer` adjusts the boundaries of the MPI domains to distribute
     the particle load close to evenly between them. The load imbalance is
@@ -49,6 +54,29 @@ class LoadBalancer(Tuner):
     significantly more pair force neighbors than others, this estimate of the
     load imbalance may not produce the optimal results.
 
+    Set `metric` to ``'time'`` to balance such simulations by cost instead.
+    With the time metric, each rank measures the wall clock time spent in
+    the force computes and HPMC integrators (the work that scales with the
+    particles in the domain) between load balancing steps. `LoadBalancer`
+    assigns each particle owned by rank :math:`i` the weight
+    :math:`w_i = t_i / N_i` and replaces :math:`N_i` by the total weight
+    :math:`W_i` of the particles in the domain:
+
+    .. math::
+
+        I = \frac{W_i}{W / P}
+
+    When moving a domain boundary, `LoadBalancer` accounts for the weights of
+    the particles that cross it. The time metric falls back to the particle
+    metric until every rank has measured a compute time, which is the case
+    after the first load balancing step of a run.
+
+    Note:
+        On the GPU, the measured time includes only the host side of the
+        kernel launches that synchronize with the device. Prefer the
+        ``'particles'`` metric for GPU simulations unless profiling shows
+        that the timings reflect the device work.
+
     A load balancing adjustment is only performed when the maximum load
     imbalance exceeds a *tolerance*. The ideal load balance is 1.0, so setting
     *tolerance* less than 1.0 will force an adjustment every update. The load
@@ -71,6 +99,12 @@ class LoadBalancer(Tuner):
     or to balance once in a short test run and then set the decomposition
     statically in a separate initialization.
 
+    With recursive bisection domains (``domain_decomposition='bisection'``),
+    `LoadBalancer` recomputes all cuts from the weighted particle positions
+    when the imbalance exceeds *tolerance* and migrates the particles to their
+    new domains in one step. `x`, `y`, `z`, and `max_iterations` have no
+    effect in this mode.
+
     Balancing is ignored if there is no domain decomposition available (MPI is
     not built or is running on a single rank).
 
@@ -83,6 +117,7 @@ class LoadBalancer(Tuner):
         tolerance (float): Load imbalance tolerance.
         max_iterations (int): Maximum number of iterations to
             attempt in a single step.
+        metric (str): The load of a rank: ``'particles'`` or ``'time'``.
     """
 
     def __init__(self,
@@ -91,19 +126,23 @@ class LoadBalancer(Tuner):
                  y=True,
                  z=True,
                  tolerance=1.02,
-                 max_iterations=1):
+                 max_iterations=1,
+                 metric='particles'):
         super().__init__(trigger)
 
         defaults = dict(x=x,
                         y=y,
                         z=z,
                         tolerance=tolerance,
-                        max_iterations=max_iterations)
-        load_balancer_params = ParameterDict(x=bool,
-                                             y=bool,
-                                             z=bool,
-                                             max_iterations=int,
-                                             tolerance=float)
+                        max_iterations=max_iterations,
+                        metric=metric)
+        load_balancer_params = ParameterDict(
+            x=bool,
+            y=bool,
+            z=bool,
+            max_iterations=int,
+            tolerance=float,
+            metric=OnlyFrom(['particles', 'time']))
         self._param_dict.update(load_balancer_params)
         self._param_dict.update(defaults)
 
@@ -115,3 +154,12 @@ class LoadBalancer(Tuner):
 
         self._cpp_obj = cpp_cls(self._simulation.state._cpp_sys_def,
                                 self.trigger)
+
+    @log(requires_run=True)
+    def imbalance(self):
+        """float: Maximum load imbalance over all ranks.
+
+        The imbalance :math:`I` of the most loaded rank computed with `metric`
+        in the last load balancing step.
+        """
+        return self._cpp_obj.imbalance
@@ -0,0 +1,176 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Implement the tuning cache used by `hoomd.Simulation`."""
+
+import json
+import os
+import tempfile
+import warnings
+import weakref
+
+import hoomd
+from hoomd import _hoomd
+from hoomd.operation import AutotunedObject
+
+
+def _signature(simulation):
+    """Describe the build, device, and system size that tuning depends on.
+
+    Systems with particle counts in the same power of two range share
+    entries.
+    """
+    device = simulation.device
+    n_particles = simulation.state.N_particles
+    bits = max(n_particles.bit_length(), 1)
+    signature = dict(
+        version=hoomd.version.version,
+        compile_flags=hoomd.version.compile_flags,
+        gpu_platform=hoomd.version.gpu_platform,
+        gpu_api_version=hoomd.version.gpu_api_version,
+        floating_point_precision=hoomd.version.floating_point_precision,
+        device=device.device,
+        num_ranks=device.communicator.num_ranks,
+        num_cpu_threads=device.num_cpu_threads,
+        n_particles=[2**(bits - 1), 2**bits - 1],
+    )
+    return json.dumps(signature, sort_keys=True)
+
+
+def _normalize(value):
+    """Convert value to the form it has after a round trip through JSON."""
+    return json.loads(json.dumps(value))
+
+
+class _TuningCache:
+    """Tuning results stored in a JSON file.
+
+    The file maps a signature (see `_signature`) to the tuned values of each
+    operation. Operations are keyed by their path in `hoomd.Operations` and
+    their type. Each entry stores the kernel parameters of tuners that
+    completed their scan and the parameters listed in the
+    ``_tuning_cache_params`` class attribute of the operation.
+
+    The root rank reads the file once and broadcasts it. A damaged file is
+    treated as empty. Only the root rank writes the file. Many jobs may share
+    one file: each write merges the current contents of the file and then
+    atomically replaces it. Writes that fail leave the file unchanged.
+    """
+
+    def __init__(self, filename, device):
+        self._filename = str(filename)
+        self._device = device
+        text = ''
+        if device.communicator.rank == 0 and os.path.exists(self._filename):
+            with open(self._filename) as f:
+                text = f.read()
+        text = _hoomd.mpi_bcast_str(text, device._cpp_exec_conf)
+        self._entries = {}
+        if text:
+            try:
+                self._entries = json.loads(text)
+            except ValueError:
+                # every rank sees the same text, so all take this branch
+                warnings.warn(
+                    f"Ignoring damaged tuning cache {self._filename}.",
+                    RuntimeWarning)
+        self._applied = weakref.WeakSet()
+
+    @property
+    def filename(self):
+        return self._filename
+
+    @staticmethod
+    def _key(path, obj):
+        return f'{path}:{type(obj).__name__}'
+
+    def apply(self, simulation):
+        """Set cached values on operations that have not seen the cache."""
+        entries = self._entries.get(_signature(simulation), {})
+        for path, obj in simulation.operations._objects().items():
+            if obj in self._applied:
+                continue
+            self._applied.add(obj)
+
+            entry = entries.get(self._key(path, obj), None)
+            if entry is None:
+                continue
+
+            for name in obj._tuning_cache_params:
+                if name in entry:
+                    setattr(obj, name, entry[name])
+
+            # Set only the kernels that this object still uses.
+            if 'kernel_parameters' in entry and isinstance(
+                    obj, AutotunedObject) and obj._attached:
+                current = obj.kernel_parameters
+                obj.kernel_parameters = {
+                    name: tuple(value)
+                    for name, value in entry['kernel_parameters'].items()
+                    if name in current
+                }
+
+    def update(self, simulation):
+        """Record the current tuned values and write the file on changes."""
+        signature = _signature(simulation)
+        entries = self._entries.setdefault(signature, {})
+        changed = False
+        for path, obj in simulation.operations._objects().items():
+            entry = {}
+            for name in obj._tuning_cache_params:
+                entry[name] = getattr(obj, name)
+
+            # Keep only complete scans, the kernel parameters are
+            # meaningless in the middle of one.
+            if (isinstance(obj, AutotunedObject) and obj._attached
+                    and obj.is_tuning_complete):
+                kernel_parameters = obj.kernel_parameters
+                if kernel_parameters:
+                    entry['kernel_parameters'] = kernel_parameters
+
+            if not entry:
+                continue
+
+            key = self._key(path, obj)
+            entry = _normalize(entry)
+            if entries.get(key, None) != entry:
+                entries[key] = entry
+                changed = True
+
+        if changed and self._device.communicator.rank == 0:
+            self._write(signature)
+
+    def _write(self, signature):
+        """Merge this simulation's entries into the file."""
+        entries = {}
+        if os.path.exists(self._filename):
+            try:
+                with open(self._filename) as f:
+                    entries = json.load(f)
+            except (OSError, ValueError):
+                # replace a damaged file
+                entries = {}
+
+        entries[signature] = self._entries[signature]
+
+        # Writers on different nodes may share a PID, give each its own
+        # temporary file in the target directory.
+        directory = os.path.dirname(os.path.abspath(self._filename))
+        try:
+            fd, temporary_filename = tempfile.mkstemp(
+                dir=directory,
+                prefix=os.path.basename(self._filename) + '.',
+                suffix='.tmp')
+        except OSError:
+            return
+
+        # A failed write leaves the cache as it was, it must not fail a run.
+        try:
+            with os.fdopen(fd, 'w') as f:
+                json.dump(entries, f, indent=1, sort_keys=True)
+            os.replace(temporary_filename, self._filename)
+        except OSError:
+            try:
+                os.remove(temporary_filename)
+            except OSError:
+                pass
@@ -22,11 +22,25 @@ class ParticleSorter(Tuner):
             value of `None` sets ``grid=4096`` in 2D simulations and
             ``grid=256`` in 3D simulations.
 
+        incremental (bool): When `True`, sort only the particles that moved
+            out of order since the last sort. Defaults to `False`.
+
     `ParticleSorter` improves simulation performance by sorting the particles in
     memory along a space-filling curve. This takes particles that are close in
     space and places them close in memory, leading to a higher rate of
     cache hits when computing pair potentials.
 
+    Particles move little between sorts, so most remain in order along the
+    curve. With ``incremental=True``, `ParticleSorter` keeps the particles
+    that are still in order in place, sorts only those that moved out of
+    order, and merges the two sequences. Particles in the same bin of the curve
+    keep their relative order in both modes, so the result is the same order
+    that a full sort produces, but the sort costs less and moves only the
+    particles whose index changes. Groups of particles remap their member
+    lists instead of rebuilding them. Incremental sorting allows shorter sort
+    periods with little overhead. The GPU implementation always performs full
+    sorts.
+
     Note:
         New `hoomd.Operations` instances include a `ParticleSorter`
         constructed with default parameters.
@@ -39,15 +53,20 @@ class ParticleSorter(Tuner):
             of `grid` provide more accurate space-filling curves, but consume
             more memory (``grid**D * 4`` bytes, where *D* is the dimensionality
             of the system).
+
+        incremental (bool): When `True`, sort only the particles that moved
+            out of order since the last sort.
     """
+    _tuning_cache_params = ('grid',)
 
-    def __init__(self, trigger=200, grid=None):
+    def __init__(self, trigger=200, grid=None, incremental=False):
         super().__init__(trigger)
         sorter_params = ParameterDict(
             grid=OnlyTypes(int,
                            postprocess=ParticleSorter._to_power_of_two,
                            preprocess=ParticleSorter._natural_number,
-                           allow_none=True))
+                           allow_none=True),
+            incremental=bool(incremental))
         self._param_dict.update(sorter_params)
         self.grid = grid
 
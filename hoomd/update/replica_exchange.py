@@ -0,0 +1,166 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Implement ReplicaExchange.
+
+.. invisible-code-block: python
+
+    simulation = hoomd.util.make_example_simulation()
+    kT = hoomd.variant.Constant(1.0)
+"""
+
+import hoomd
+from hoomd.operation import Updater
+from hoomd.data.parameterdicts import ParameterDict
+from hoomd.data.typeconverter import OnlyFrom
+from hoomd.logging import log
+from hoomd import _hoomd
+
+
+class ReplicaExchange(Updater):
+    r"""Exchange thermodynamic parameters between MPI partitions.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): Select the timesteps on which to
+            attempt exchanges.
+        parameter (hoomd.variant.Constant): The variant that sets the
+            exchanged parameter. Pass the same object to the operation that
+            uses the parameter (for example, as ``kT`` to a thermostat or as
+            ``betaP`` to `hoomd.hpmc.update.BoxMC`).
+        ladder (list[float]): The parameter value of each replica. Provide one
+            value per partition.
+        observable (str): The observable conjugate to the parameter. Set to
+            ``'potential_energy'`` to exchange kT or ``'volume'`` to exchange
+            betaP.
+        rescale_velocities (bool): When `True`, rescale the particle velocities
+            and angular momenta after a temperature exchange.
+
+    `ReplicaExchange` implements parallel tempering across the partitions of a
+    `hoomd.communicator.Communicator` created with ``ranks_per_partition``.
+    Each partition simulates one replica and holds one value :math:`\lambda_k`
+    of the `ladder`. `ReplicaExchange` never moves particle data between
+    partitions. Instead, it swaps the parameter values held by the partitions
+    that are adjacent on the ladder. The partitions exchange only the scalar
+    observable :math:`O`. A swap between ladder indices :math:`a` and
+    :math:`b` is accepted with probability
+
+    .. math::
+
+        p = \min \left(1, e^{(x_a - x_b)(O_a - O_b)} \right)
+
+    where :math:`x = 1/kT` when `observable` is ``'potential_energy'`` and
+    :math:`x = \beta P` when `observable` is ``'volume'``. Even ladder pairs
+    :math:`(k, k+1)` attempt exchanges on even attempts, odd pairs on odd
+    attempts.
+
+    When exchanging kT, `ReplicaExchange` evaluates the potential energy with
+    the forces in the simulation's integrator. Internal thermostat variables
+    are not rescaled.
+
+    Note:
+        The partitions may use different values of `Simulation.seed`.
+        `ReplicaExchange` makes the acceptance decision with the seed of the
+        partition that holds the lower ladder index.
+
+    .. rubric:: Example:
+
+    .. code-block:: python
+
+        replica_exchange = hoomd.update.ReplicaExchange(
+            trigger=hoomd.trigger.Periodic(1000),
+            parameter=kT,
+            ladder=[1.0, 1.2, 1.44, 1.73])
+        simulation.operations.updaters.append(replica_exchange)
+
+    Attributes:
+        parameter (hoomd.variant.Constant): The variant that sets the
+            exchanged parameter (*read only*).
+
+        rescale_velocities (bool): When `True`, rescale the particle velocities
+            and angular momenta after a temperature exchange.
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                replica_exchange.rescale_velocities = False
+    """
+
+    def __init__(self,
+                 trigger,
+                 parameter,
+                 ladder,
+                 observable='potential_energy',
+                 rescale_velocities=True):
+        super().__init__(trigger)
+        params = ParameterDict(
+            observable=OnlyFrom(['potential_energy', 'volume']),
+            rescale_velocities=bool)
+        params.update(
+            dict(observable=observable, rescale_velocities=rescale_velocities))
+        self._param_dict.update(params)
+
+        if not isinstance(parameter, hoomd.variant.Constant):
+            raise TypeError("parameter must be a hoomd.variant.Constant.")
+
+        self._parameter = parameter
+        self._ladder = tuple(float(v) for v in ladder)
+
+    def _attach_hook(self):
+        integrator = self._simulation.operations.integrator
+        if self.observable == 'potential_energy' and integrator is None:
+            raise RuntimeError("ReplicaExchange of kT requires an integrator.")
+
+        if isinstance(self._simulation.device, hoomd.device.GPU):
+            self._simulation.device._cpp_msg.warning(
+                "Falling back on CPU. No GPU implementation available.\n")
+
+        cpp_integrator = None if integrator is None else integrator._cpp_obj
+        self._cpp_obj = _hoomd.UpdaterReplicaExchange(
+            self._simulation.state._cpp_sys_def, self.trigger, cpp_integrator,
+            self._parameter, self._ladder, self.observable)
+
+    def _setattr_param(self, attr, value):
+        if attr == 'observable' and self._attached:
+            raise AttributeError("observable is read only after attaching.")
+        super()._setattr_param(attr, value)
+
+    @property
+    def parameter(self):
+        """hoomd.variant.Constant: The variant holding the parameter."""
+        return self._parameter
+
+    @property
+    def ladder(self):
+        """tuple[float]: The parameter value of each replica (*read only*)."""
+        return self._ladder
+
+    @log(requires_run=True)
+    def replica_index(self):
+        """int: The ladder index held by this partition."""
+        return self._cpp_obj.replica_index
+
+    @log(category='sequence', requires_run=True)
+    def permutation(self):
+        """tuple[int]: The ladder index held by each partition."""
+        return self._cpp_obj.permutation
+
+    @log(category='sequence', requires_run=True)
+    def accepted(self):
+        """tuple[int]: Number of accepted swaps of each ladder pair.
+
+        Element :math:`k` counts the accepted swaps between ladder indices
+        :math:`k` and :math:`k+1`.
+        """
+        return self._cpp_obj.accepted
+
+    @log(category='sequence', requires_run=True)
+    def attempted(self):
+        """tuple[int]: Number of attempted swaps of each ladder pair."""
+        return self._cpp_obj.attempted
+
+    @log(category='sequence', requires_run=True)
+    def acceptance(self):
+        """tuple[float]: Fraction of accepted swaps of each ladder pair."""
+        return tuple(a / t if t > 0 else 0.0
+                     for a, t in zip(self.accepted, self.attempted))
@@ -7,11 +7,17 @@ Writers write the state of the simulation, logger quantities, or calculated
 results to output files or streams:
 
 * `GSD` and `DCD` save the simulation trajectory to a file.
+* Add `GSDStream` objects to `GSD` to write selected particles at a higher
+  rate or with other fields to the same file.
 * `Burst` provides a sliding window of a simulation trajectory wrote out at
   `Burst.dump` for use in selective high frequency trajectory data.
 * Combine `GSD` with a `hoomd.logging.Logger` to save system properties or
   per-particle calculated results.
 * Use `HDF5Log` to store logged data in HDF5 resizable datasets.
+* Use `BufferedLog` to sample logged quantities in C++ and write them to a GSD
+  file in blocks.
+* Use `Checkpoint` to save the particle data together with the state of the
+  operations so that a restarted simulation continues where it left off.
 * Use `Table` to display the status of the simulation periodically to standard
   out.
 * Implement custom output formats with `CustomWriter`.
@@ -29,8 +35,10 @@ See Also:
 """
 
 from hoomd.write.custom_writer import CustomWriter
-from hoomd.write.gsd import GSD
+from hoomd.write.gsd import GSD, GSDStream
 from hoomd.write.gsd_burst import Burst
 from hoomd.write.dcd import DCD
 from hoomd.write.table import Table
 from hoomd.write.hdf5 import HDF5Log
+from hoomd.write.buffered_log import BufferedLog
+from hoomd.write.checkpoint import Checkpoint
@@ -0,0 +1,169 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Implement BufferedLog.
+
+.. invisible-code-block: python
+
+    simulation = hoomd.util.make_example_simulation()
+    thermo = hoomd.md.compute.ThermodynamicQuantities(
+        filter=hoomd.filter.All())
+    simulation.operations.computes.append(thermo)
+    log_filename = tmp_path / 'log.gsd'
+"""
+
+from pathlib import PurePath
+
+from hoomd import _hoomd
+from hoomd.data.parameterdicts import ParameterDict
+from hoomd.data.typeconverter import OnlyTypes, OnlyFrom
+from hoomd.logging import Logger, LoggerCategories
+from hoomd.operation import Writer
+
+
+class BufferedLog(Writer):
+    """Sample logged quantities in C++ and write them to a GSD file in blocks.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): Select the timesteps to sample.
+        filename (str): File name to write.
+        logger (hoomd.logging.Logger): Provide the quantities to log.
+        mode (str): The file open mode. Defaults to ``'ab'``.
+        buffer_size (int): Number of samples to buffer before writing them to
+            the file. Defaults to 1000.
+
+    `BufferedLog` evaluates the quantities in `logger` without calling into
+    Python. On each triggered timestep, it appends the values of all
+    quantities to an in-memory buffer. When the buffer is full, `BufferedLog`
+    writes it to the file on a background thread while the simulation
+    continues. Each sample is one frame of the GSD file with the chunks
+    ``configuration/step`` and ``log/<namespace>``, so `gsd.hoomd.read_log`
+    reads the output.
+
+    `BufferedLog` accepts only the ``scalar`` and ``sequence`` categories and
+    only quantities of operations that implement them in C++, such as the
+    properties of `hoomd.md.compute.ThermodynamicQuantities` and the energy of
+    `hoomd.md.force.Force`. It raises an error when `logger` contains any other
+    quantity. Add the logged operations to the simulation before
+    `BufferedLog`.
+
+    The mode may be:
+
+    1. ``'ab'``: Append to an existing file or create a new file.
+    2. ``'wb'``: Create a new file or overwrite an existing one.
+    3. ``'xb'``: Create a new file, fail if the file exists.
+
+    Note:
+        Samples remain in memory until the buffer is full, `flush` is called,
+        or `BufferedLog` is removed from the simulation.
+
+    .. rubric:: Example:
+
+    .. code-block:: python
+
+        logger = hoomd.logging.Logger(
+            categories=hoomd.write.BufferedLog.accepted_categories)
+        logger.add(thermo, quantities=['kinetic_temperature', 'pressure'])
+        buffered_log = hoomd.write.BufferedLog(
+            trigger=hoomd.trigger.Periodic(100),
+            filename=log_filename,
+            logger=logger)
+        simulation.operations.writers.append(buffered_log)
+
+    Attributes:
+        accepted_categories (hoomd.logging.LoggerCategories): The categories
+            that `BufferedLog` accepts: ``scalar`` and ``sequence``.
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                accepted_categories = (
+                    hoomd.write.BufferedLog.accepted_categories)
+
+        filename (str): File name to write (*read only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                filename = buffered_log.filename
+
+        logger (hoomd.logging.Logger): Provide the quantities to log
+            (*read only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                logger = buffered_log.logger
+
+        mode (str): The file open mode (*read only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                mode = buffered_log.mode
+
+        buffer_size (int): Number of samples to buffer before writing them to
+            the file (*read only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                buffer_size = buffered_log.buffer_size
+    """
+
+    accepted_categories = LoggerCategories.any(['scalar', 'sequence'])
+
+    def __init__(self,
+                 trigger,
+                 filename,
+                 logger,
+                 mode='ab',
+                 buffer_size=1000):
+        super().__init__(trigger)
+
+        if (rejects := logger.categories
+                & ~self.accepted_categories) != LoggerCategories['NONE']:
+            reject_str = LoggerCategories._get_string_list(rejects)
+            raise ValueError(f"Cannot have {reject_str} in logger categories.")
+
+        self._param_dict.update(
+            ParameterDict(filename=OnlyTypes((str, PurePath)),
+                          logger=Logger,
+                          mode=OnlyFrom(['ab', 'wb', 'xb']),
+                          buffer_size=int))
+        self._param_dict.update(
+            dict(filename=filename,
+                 logger=logger,
+                 mode=mode,
+                 buffer_size=buffer_size))
+
+    def _attach_hook(self):
+        self._cpp_obj = _hoomd.BufferedLogWriter(
+            self._simulation.state._cpp_sys_def, self.trigger,
+            str(self.filename), self.mode, self.buffer_size)
+
+        for key, entry in self.logger.items():
+            name = '/'.join(key)
+            cpp_obj = getattr(entry.obj, '_cpp_obj', None)
+            if cpp_obj is None:
+                raise RuntimeError(
+                    f"{name} cannot be logged natively. Add the operation "
+                    "to the simulation before BufferedLog.")
+            self._cpp_obj.addQuantity(name, cpp_obj, entry.attr)
+
+    def flush(self):
+        """Write the buffered samples to the file.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            buffered_log.flush()
+        """
+        if self._attached:
+            self._cpp_obj.flush()
@@ -0,0 +1,350 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Implement Checkpoint.
+
+.. invisible-code-block: python
+
+    simulation = hoomd.util.make_example_simulation()
+    checkpoint_filename = tmp_path / 'checkpoint.gsd'
+    checkpoint = hoomd.write.Checkpoint(
+        trigger=hoomd.trigger.Periodic(100_000),
+        filename=checkpoint_filename)
+"""
+
+from concurrent.futures import ThreadPoolExecutor
+import copy
+import json
+import os
+from pathlib import PurePath
+
+import numpy as np
+
+from hoomd import _hoomd
+from hoomd.custom import _InternalAction
+from hoomd.data.collections import _to_base
+from hoomd.data.parameterdicts import ParameterDict
+from hoomd.data.typeconverter import OnlyTypes
+from hoomd.filter import All
+from hoomd.operation import AutotunedObject
+from hoomd.trigger import Periodic
+from hoomd.write.custom_writer import _InternalCustomWriter
+
+# Name of the GSD chunk that stores the operation state.
+_STATE_CHUNK = 'log/hoomd/write/Checkpoint/state'
+
+
+def _to_json(value):
+    """Convert value to a type that `json` can encode."""
+    value = _to_base(value)
+    if isinstance(value, (np.ndarray, np.generic)):
+        return value.tolist()
+    if isinstance(value, dict):
+        return {key: _to_json(v) for key, v in value.items()}
+    if isinstance(value, (list, tuple)):
+        return [_to_json(v) for v in value]
+    return value
+
+
+def _object_state(obj):
+    """Get the state of obj that a restart needs."""
+    state = {}
+    for name in obj._checkpoint_params:
+        state[name] = _to_json(getattr(obj, name))
+
+    for name in obj._checkpoint_typeparams:
+        # store type parameters as key, value pairs so that tuple keys
+        # survive the round trip through JSON
+        state[name] = [[_to_json(key), _to_json(value)]
+                       for key, value in getattr(obj, name).to_base().items()]
+
+    # keep tuned kernel parameters, but do not stop a scan in progress
+    if (isinstance(obj, AutotunedObject) and obj._attached
+            and obj.is_tuning_complete):
+        state['kernel_parameters'] = _to_json(obj.kernel_parameters)
+
+    return state
+
+
+def _collect_state(simulation):
+    """Get the state of all operations in the simulation."""
+    objects = {}
+    for path, obj in simulation.operations._objects().items():
+        object_state = _object_state(obj)
+        if object_state:
+            objects[path] = dict(type=type(obj).__name__, state=object_state)
+
+    return dict(seed=simulation.seed, objects=objects)
+
+
+class _CheckpointState:
+    """Operation state read from a checkpoint file.
+
+    `hoomd.Simulation.create_state_from_checkpoint` holds the state until
+    `hoomd.Operations` attaches the operations, then calls `restore`.
+    """
+
+    def __init__(self, text):
+        self._state = json.loads(text)
+
+    @property
+    def seed(self):
+        return self._state['seed']
+
+    def restore(self, operations):
+        """Set the saved state on the attached operations."""
+        objects = operations._objects()
+        for path, entry in self._state['objects'].items():
+            obj = objects.get(path, None)
+            if obj is None or type(obj).__name__ != entry['type']:
+                raise RuntimeError(
+                    f"The checkpoint has state for a {entry['type']} at "
+                    f"{path}, but the simulation does not. Add the same "
+                    f"operations in the same order before running.")
+
+            state = entry['state']
+            for name in obj._checkpoint_params:
+                if name in state:
+                    setattr(obj, name, state[name])
+
+            for name in obj._checkpoint_typeparams:
+                param = getattr(obj, name)
+                for key, value in state.get(name, []):
+                    if isinstance(key, list):
+                        key = tuple(key)
+                    param[key] = value
+
+            # Kernel names depend on the device. Set only those that the
+            # current device also uses.
+            if 'kernel_parameters' in state:
+                current = obj.kernel_parameters
+                obj.kernel_parameters = {
+                    name: tuple(value)
+                    for name, value in state['kernel_parameters'].items()
+                    if name in current
+                }
+
+
+def _read_state(reader, exec_conf):
+    """Read the operation state from an open `_hoomd.GSDReader`.
+
+    Returns `None` when the file is not a checkpoint.
+    """
+    text = _hoomd.mpi_bcast_str(reader.readString(_STATE_CHUNK), exec_conf)
+    if not text:
+        return None
+    return _CheckpointState(text)
+
+
+class _StateLogWriter:
+    """Provide the operation state to `_hoomd.GSDDumpWriter` as a log chunk."""
+
+    def __init__(self, text):
+        self._text = text
+
+    def log(self):
+        value = bytes(self._text, 'UTF-8')
+        value = np.array([value], dtype=np.dtype((bytes, len(value) + 1)))
+        return {_STATE_CHUNK: value.view(dtype=np.int8)}
+
+
+class _CheckpointInternal(_InternalAction):
+    """Write a checkpoint file."""
+
+    _skip_for_equality = {'_simulation', '_executor', '_pending'}
+
+    def __init__(self, filename, parallel_write=False, asynchronous=False):
+        param_dict = ParameterDict(filename=OnlyTypes((str, PurePath)),
+                                   parallel_write=bool,
+                                   asynchronous=bool)
+        param_dict.update(
+            dict(filename=filename,
+                 parallel_write=parallel_write,
+                 asynchronous=asynchronous))
+        self._param_dict = param_dict
+        self._simulation = None
+        self._executor = None
+        self._pending = None
+
+    def attach(self, simulation):
+        self._simulation = simulation
+
+    def detach(self):
+        self.wait()
+        if self._executor is not None:
+            self._executor.shutdown()
+            self._executor = None
+        self._simulation = None
+
+    def act(self, timestep):
+        """Write a checkpoint of the current state."""
+        simulation = self._simulation
+        state = simulation.state
+        communicator = simulation.device.communicator
+        filename = str(self.filename)
+        temporary_filename = filename + '.tmp'
+
+        # The previous checkpoint must be in place before writing the next.
+        self.wait()
+
+        text = json.dumps(_collect_state(simulation))
+        writer = _hoomd.GSDDumpWriter(state._cpp_sys_def, Periodic(1),
+                                      temporary_filename,
+                                      state._get_group(All()), 'wb', False)
+        writer.parallel_write = self.parallel_write
+        writer.log_writer = _StateLogWriter(text)
+        writer.analyze(timestep)
+        writer.flush()
+        # close the file
+        del writer
+
+        if communicator.rank == 0:
+            if self.asynchronous:
+                if self._executor is None:
+                    self._executor = ThreadPoolExecutor(max_workers=1)
+                self._pending = self._executor.submit(_commit,
+                                                      temporary_filename,
+                                                      filename)
+            else:
+                _commit(temporary_filename, filename)
+
+        communicator.barrier()
+
+    def wait(self):
+        """Wait for the last checkpoint to reach the file system.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            checkpoint.wait()
+        """
+        if self._pending is not None:
+            pending = self._pending
+            self._pending = None
+            # raise any error from the background thread
+            pending.result()
+
+    def __getstate__(self):
+        self.wait()
+        state = copy.copy(self.__dict__)
+        state['_simulation'] = None
+        state['_executor'] = None
+        state['_pending'] = None
+        return state
+
+    def __setstate__(self, state):
+        self.__dict__ = state
+
+
+def _commit(temporary_filename, filename):
+    """Make the temporary file durable, then move it over filename."""
+    with open(temporary_filename, 'rb') as f:
+        os.fsync(f.fileno())
+    os.replace(temporary_filename, filename)
+
+    # make the rename durable
+    if hasattr(os, 'O_DIRECTORY'):
+        directory = os.open(os.path.dirname(os.path.abspath(filename)),
+                            os.O_RDONLY | os.O_DIRECTORY)
+        try:
+            os.fsync(directory)
+        finally:
+            os.close(directory)
+
+
+class Checkpoint(_InternalCustomWriter):
+    """Write checkpoints that restart the simulation where it left off.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): Select the timesteps to write.
+        filename (str): File name to write.
+        parallel_write (bool): When `True` in MPI simulations with domain
+            decomposition, each rank writes the particles it owns to the
+            file with collective MPI-IO (see `GSD.parallel_write`). Defaults
+            to `False`.
+        asynchronous (bool): When `True`, the simulation continues while the
+            checkpoint is flushed to disk and moved into place. Defaults to
+            `False`.
+
+    A GSD file holds the particle data, but restarting from a `GSD` frame
+    loses state that the operations accumulate as the simulation runs, such
+    as the thermostat and barostat degrees of freedom of
+    `hoomd.md.methods.thermostats.MTTK` and
+    `hoomd.md.methods.ConstantPressure`, the HPMC move sizes set by
+    `hoomd.hpmc.tune.MoveSize`, the neighbor list buffer set by
+    `hoomd.md.tune.NeighborListBuffer`, and the tuned kernel parameters of
+    `hoomd.operation.AutotunedObject`. `Checkpoint` writes all of these to a
+    single GSD file along with the complete particle data and the simulation
+    seed. The random number streams in HOOMD-blue are functions of the seed
+    and timestep, so a restarted simulation continues the same streams.
+
+    Each checkpoint replaces the previous one. `Checkpoint` writes the new
+    checkpoint to a temporary file ``filename + '.tmp'``, syncs it to the
+    storage device, and then renames it to ``filename``. The rename is
+    atomic: when the simulation ends during a write, ``filename`` still
+    holds the previous complete checkpoint.
+
+    When `asynchronous` is `True`, a background thread on the root rank syncs
+    and renames the file. `Checkpoint` waits for the thread before it writes
+    the next checkpoint and when it is removed from the simulation. Call
+    `wait` to wait for the last checkpoint explicitly.
+
+    Use `hoomd.Simulation.create_state_from_checkpoint` to restart. Then add
+    the same operations in the same order as the checkpointed simulation.
+    The first call to `hoomd.Simulation.run` restores the state of the
+    operations.
+
+    Note:
+        GSD files store the particle data in single precision. In double
+        precision builds, the restarted simulation follows a trajectory that
+        differs from the original by round-off.
+
+    Note:
+        Kernel parameters are tuned on each rank independently. `Checkpoint`
+        saves those of the root rank and only the kernel parameters of
+        operations that completed tuning.
+
+    Note:
+        `Checkpoint` does not save the HPMC acceptance counters, which
+        `hoomd.hpmc.integrate.HPMCIntegrator` reports per run.
+
+    .. rubric:: Example:
+
+    .. code-block:: python
+
+        checkpoint = hoomd.write.Checkpoint(
+            trigger=hoomd.trigger.Periodic(100_000),
+            filename=checkpoint_filename)
+        simulation.operations.writers.append(checkpoint)
+
+    Attributes:
+        filename (str): File name to write.
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                filename = checkpoint.filename
+
+        parallel_write (bool): When `True` in MPI simulations with domain
+            decomposition, each rank writes the particles it owns to the
+            file with collective MPI-IO.
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                checkpoint.parallel_write = True
+
+        asynchronous (bool): When `True`, the simulation continues while the
+            checkpoint is flushed to disk and moved into place.
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                checkpoint.asynchronous = True
+    """
+    _internal_class = _CheckpointInternal
+    _wrap_methods = ("wait",)
@@ -10,7 +10,7 @@
 """
 
 from collections.abc import Mapping, Collection
-from hoomd.trigger import Periodic
+from hoomd.trigger import Periodic, Trigger
 from hoomd import _hoomd
 from hoomd.util import _dict_flatten
 from hoomd.data.typeconverter import OnlyFrom, RequiredArg
@@ -56,6 +56,110 @@ def _finalize_gsd(weak_writer, cpp_obj):
     cpp_obj.flush()
 
 
+# Per-particle fields and categories that may be dynamic.
+_PARTICLE_DYNAMIC = [
+    'attribute',
+    'property',
+    'momentum',
+    'configuration/box',
+    'particles/N',
+    'particles/position',
+    'particles/orientation',
+    'particles/velocity',
+    'particles/angmom',
+    'particles/image',
+    'particles/types',
+    'particles/typeid',
+    'particles/mass',
+    'particles/charge',
+    'particles/diameter',
+    'particles/body',
+    'particles/moment_inertia',
+]
+
+
+class GSDStream:
+    """Additional frames that a `GSD` writer writes to its file.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): Select the timesteps to write.
+        filter (hoomd.filter.filter_like): Select the particles to write.
+            Defaults to `hoomd.filter.All`.
+        dynamic (list[str]): Field names and/or field categories to save in
+            all frames. Defaults to ``['property']``.
+
+    Pass `GSDStream` objects to the ``streams`` argument of `GSD` to write
+    frames of several selections of particles at different rates and with
+    different fields to one file. `dynamic` accepts the same values as
+    `GSD.dynamic`, except ``'topology'``. See `GSD` for details.
+
+    .. rubric:: Example:
+
+    .. code-block:: python
+
+        probe = hoomd.write.GSDStream(
+            trigger=hoomd.trigger.Periodic(100),
+            filter=hoomd.filter.Tags([0, 1, 2, 3]),
+            dynamic=['property', 'momentum'])
+
+    Attributes:
+        trigger (hoomd.trigger.Trigger): Select the timesteps to write
+            (*read-only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                trigger = probe.trigger
+
+        filter (hoomd.filter.filter_like): Select the particles to write
+            (*read-only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                filter_ = probe.filter
+
+        dynamic (list[str]): Field names and/or field categories to save in
+            all frames (*read-only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                dynamic = probe.dynamic
+    """
+
+    def __init__(self, trigger, filter=All(), dynamic=None):
+        dynamic = ['property'] if dynamic is None else dynamic
+        param_dict = ParameterDict(
+            trigger=Trigger,
+            filter=ParticleFilter,
+            dynamic=[OnlyFrom(_PARTICLE_DYNAMIC,
+                              preprocess=_array_to_strings)])
+        param_dict.update(dict(trigger=trigger, filter=filter,
+                               dynamic=dynamic))
+        self._param_dict = param_dict
+
+    @property
+    def trigger(self):
+        return self._param_dict['trigger']
+
+    @property
+    def filter(self):
+        return self._param_dict['filter']
+
+    @property
+    def dynamic(self):
+        return list(self._param_dict['dynamic'])
+
+    def __eq__(self, other):
+        return (type(self) is type(other) and self.trigger == other.trigger
+                and self.filter == other.filter
+                and self.dynamic == other.dynamic)
+
+
 class GSD(Writer):
     r"""Write simulation trajectories in the GSD format.
 
@@ -71,6 +175,8 @@ class GSD(Writer):
             all frames. Defaults to ``['property']``.
         logger (hoomd.logging.Logger): Provide log quantities to write. Defaults
             to `None`.
+        streams (list[GSDStream]): Additional frames to write to the same
+            file. Defaults to ``()``.
 
     `GSD` writes the simulation trajectory to the specified file in the GSD
     format. `GSD` can store all particle, bond, angle, dihedral, improper,
@@ -144,6 +250,30 @@ class GSD(Writer):
     When you set a category string (``'property'``, ``'momentum'``,
     ``'attribute'``), `GSD` makes all the category member's fields dynamic.
 
+    .. rubric:: Streams
+
+    Each `GSDStream` in `streams` writes frames of its own selection of
+    particles with its own `trigger <GSDStream.trigger>` and `dynamic
+    <GSDStream.dynamic>` fields into the same file. For example, write a few
+    probe particles every 100 steps and the whole system every 100,000 steps
+    to reduce the size of the file while keeping the time resolution where
+    needed. The `GSD` arguments ``trigger``, ``filter``, and ``dynamic``
+    define the main stream.
+
+    `GSD` triggers when any stream does and writes one frame for each stream
+    that triggers, the main stream first. Every frame includes the log
+    quantity ``hoomd/write/GSD/stream``: 0 in frames of the main stream and
+    *i* + 1 in frames of ``streams[i]``. Select the frames of one stream by
+    this value when reading the file. The first frame that `GSD` writes to a
+    file is always a frame of the main stream.
+
+    A GSD reader takes the fields missing from frame *i* from frame 0. Frames
+    of a stream that selects the same particles (same ``filter``) as the
+    main stream write the fields in its `dynamic <GSDStream.dynamic>` list.
+    Frames of streams that select other particles write every field that is
+    non-default in the frame or in frame 0. Frames of streams do not include
+    the quantities of `logger` or topology.
+
     Warning:
         `GSD` buffers writes in memory. Abnormal exits (e.g. ``kill``,
         ``scancel``, reaching walltime limits) may cause loss of data. Ensure
@@ -179,6 +309,19 @@ class GSD(Writer):
                               filename=gsd_filename)
         simulation.operations.writers.append(gsd)
 
+    .. rubric:: Example with a stream:
+
+    .. code-block:: python
+
+        probe = hoomd.write.GSDStream(
+            trigger=hoomd.trigger.Periodic(1_000),
+            filter=hoomd.filter.Tags([0, 1, 2, 3]),
+            dynamic=['property', 'momentum'])
+        gsd = hoomd.write.GSD(trigger=hoomd.trigger.Periodic(1_000_000),
+                              filename=gsd_filename,
+                              mode='wb',
+                              streams=[probe])
+
     Attributes:
         filename (str): File name to write (*read-only*).
 
@@ -251,6 +394,30 @@ class GSD(Writer):
             .. code-block:: python
 
                 gsd.maximum_write_buffer_size = 128 * 1024**2
+
+        parallel_write (bool): When `True` in MPI simulations with domain
+            decomposition, each rank writes the per-particle data it owns
+            directly to the file with collective MPI-IO. When `False`, `GSD`
+            gathers the whole frame on rank 0, which then writes the file.
+            Both modes produce identical files. Parallel writes avoid the
+            memory and time cost of the gather in large simulations, but
+            require a file system that supports MPI-IO (such as Lustre or
+            GPFS). Defaults to `False`.
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                gsd.parallel_write = True
+
+        streams (tuple[GSDStream]): Additional frames to write to the same
+            file (*read-only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                streams = gsd.streams
     """
 
     def __init__(self,
@@ -260,30 +427,12 @@ class GSD(Writer):
                  mode='ab',
                  truncate=False,
                  dynamic=None,
-                 logger=None):
+                 logger=None,
+                 streams=()):
 
         super().__init__(trigger)
 
-        dynamic_validation = OnlyFrom([
-            'attribute',
-            'property',
-            'momentum',
-            'topology',
-            'configuration/box',
-            'particles/N',
-            'particles/position',
-            'particles/orientation',
-            'particles/velocity',
-            'particles/angmom',
-            'particles/image',
-            'particles/types',
-            'particles/typeid',
-            'particles/mass',
-            'particles/charge',
-            'particles/diameter',
-            'particles/body',
-            'particles/moment_inertia',
-        ],
+        dynamic_validation = OnlyFrom(_PARTICLE_DYNAMIC + ['topology'],
                                       preprocess=_array_to_strings)
 
         dynamic = ['property'] if dynamic is None else dynamic
@@ -295,16 +444,28 @@ class GSD(Writer):
                           dynamic=[dynamic_validation],
                           write_diameter=False,
                           maximum_write_buffer_size=64 * 1024 * 1024,
+                          parallel_write=False,
                           _defaults=dict(filter=filter, dynamic=dynamic)))
 
         self._logger = None if logger is None else _GSDLogWriter(logger)
 
+        for stream in streams:
+            if not isinstance(stream, GSDStream):
+                raise TypeError("GSD.streams must be a list of GSDStream.")
+        self._streams = tuple(streams)
+
     def _attach_hook(self):
         self._cpp_obj = _hoomd.GSDDumpWriter(
             self._simulation.state._cpp_sys_def, self.trigger, self.filename,
             self._simulation.state._get_group(self.filter), self.mode,
             self.truncate)
 
+        for stream in self._streams:
+            self._cpp_obj.addStream(
+                stream.trigger,
+                self._simulation.state._get_group(stream.filter),
+                stream.dynamic)
+
         self._cpp_obj.log_writer = self.logger
 
         # Maintain a list of open gsd writers
@@ -338,6 +499,10 @@ class GSD(Writer):
         writer.analyze(state._simulation.timestep)
         writer.flush()
 
+    @property
+    def streams(self):
+        return self._streams
+
     @property
     def logger(self):
         """hoomd.logging.Logger: Provide log quantities to write.